@@ -0,0 +1,172 @@
+/**
+ * @file comfort.cpp
+ * @brief Fast comfort metric kernels implementation
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#include "comfort.h"
+
+// ==========================================
+// LOOKUP TABLES (flash)
+// ==========================================
+
+// ln(RH/100) in Q12 for RH = 20..100 %, and saturation vapour pressure
+// (Pa) for Td = -60..+60 °C, as used by the humidex formula.
+// Generated by tools/gen_comfort_tables.py
+// Max error over -40..+60 °C, 1..100 %RH: dew point 0.061 °C, humidex 0.35, heat index 0.0000 °C
+static const int16_t LN_RH_Q12[COMFORT_LN_POINTS] PROGMEM = {
+   -6592,  -6392,  -6202,  -6020,  -5845,  -5678,  -5518,  -5363,  -5214,
+   -5070,  -4931,  -4797,  -4667,  -4541,  -4419,  -4300,  -4185,  -4072,
+   -3963,  -3857,  -3753,  -3652,  -3553,  -3457,  -3363,  -3271,  -3181,
+   -3093,  -3006,  -2922,  -2839,  -2758,  -2678,  -2600,  -2524,  -2449,
+   -2375,  -2302,  -2231,  -2161,  -2092,  -2025,  -1958,  -1892,  -1828,
+   -1764,  -1702,  -1640,  -1580,  -1520,  -1461,  -1403,  -1346,  -1289,
+   -1233,  -1178,  -1124,  -1071,  -1018,   -966,   -914,   -863,   -813,
+    -763,   -714,   -666,   -618,   -570,   -524,   -477,   -432,   -386,
+    -342,   -297,   -253,   -210,   -167,   -125,    -83,    -41,      0,
+};
+static const uint16_t SAT_VAPOUR_PA[COMFORT_E_POINTS] PROGMEM = {
+      2,     3,     3,     3,     4,     4,     5,     5,     6,     6,     7,
+      8,     9,    10,    11,    12,    14,    15,    17,    18,    20,    22,
+     25,    27,    30,    33,    36,    40,    44,    48,    53,    58,    63,
+     69,    76,    83,    90,    99,   107,   117,   127,   139,   151,   164,
+    178,   193,   209,   227,   245,   266,   287,   311,   336,   362,   391,
+    422,   455,   490,   527,   568,   611,   656,   705,   757,   813,   872,
+    935,  1002,  1074,  1149,  1230,  1316,  1407,  1503,  1606,  1714,  1830,
+   1952,  2081,  2218,  2363,  2516,  2678,  2849,  3030,  3221,  3423,  3636,
+   3860,  4097,  4347,  4610,  4887,  5179,  5486,  5809,  6149,  6506,  6882,
+   7277,  7692,  8127,  8584,  9064,  9567, 10095, 10648, 11228, 11836, 12472,
+  13138, 13836, 14565, 15329, 16127, 16962, 17835, 18746, 19699, 20693, 21732,
+};
+
+#define LN2_Q12         2839        ///< ln(2) in Q12
+#define MAGNUS_A_Q12    70738L      ///< 17.27 in Q12
+#define MAGNUS_B10      2373L       ///< 237.3 °C × 10
+
+// ==========================================
+// PRIVATE HELPER FUNCTIONS
+// ==========================================
+
+/**
+ * @brief Integer division rounded to nearest (divisor > 0)
+ */
+static inline int32_t roundedDiv(int32_t n, int32_t d) {
+  return (n >= 0) ? (n + d / 2) / d : (n - d / 2) / d;
+}
+
+/**
+ * @brief ln(RH/100) in Q12 from %RH × 10
+ *
+ * Values below the table are doubled until they enter it, subtracting
+ * ln(2) each time, which keeps interpolation on the flat part of ln().
+ */
+static int32_t lnHumidityQ12(uint16_t hum10) {
+  int32_t result = 0;
+
+  while (hum10 < COMFORT_LN_FIRST * 10) {
+    hum10 *= 2;
+    result -= LN2_Q12;
+  }
+
+  uint16_t i = hum10 / 10 - COMFORT_LN_FIRST;
+  uint16_t frac = hum10 % 10;
+  if (i >= COMFORT_LN_POINTS - 1) {
+    return result + (int16_t)pgm_read_word(&LN_RH_Q12[COMFORT_LN_POINTS - 1]);
+  }
+
+  int32_t v0 = (int16_t)pgm_read_word(&LN_RH_Q12[i]);
+  int32_t v1 = (int16_t)pgm_read_word(&LN_RH_Q12[i + 1]);
+  return result + v0 + (v1 - v0) * frac / 10;
+}
+
+// ==========================================
+// FUNCTION IMPLEMENTATIONS
+// ==========================================
+
+/**
+ * @brief Dew point (Magnus-Tetens), fixed point
+ *
+ * γ = ln(RH/100) + a·T/(b+T),  Td = b·γ/(a-γ)
+ *
+ * Everything in Q12 / tenths: one table lookup and two integer divisions.
+ */
+int16_t dewPoint10(int16_t temp10, uint16_t hum10) {
+  if (hum10 < 1) hum10 = 1;
+  if (hum10 > 1000) hum10 = 1000;
+
+  int32_t gamma = lnHumidityQ12(hum10) + (MAGNUS_A_Q12 * temp10) / (MAGNUS_B10 + temp10);
+  return (int16_t)roundedDiv(MAGNUS_B10 * gamma, MAGNUS_A_Q12 - gamma);
+}
+
+/**
+ * @brief Humidex from temperature and dew point
+ *
+ * H = T + 0.5555·(e - 10), e = saturation vapour pressure at Td (hPa),
+ * read from the flash table with linear interpolation.
+ */
+int16_t humidex10(int16_t temp10, int16_t dew10) {
+  int32_t td = constrain(dew10, COMFORT_E_FIRST * 10,
+                         (COMFORT_E_FIRST + COMFORT_E_POINTS - 1) * 10);
+  int32_t offset = td - COMFORT_E_FIRST * 10;
+  uint16_t i = offset / 10;
+  uint16_t frac = offset % 10;
+
+  int32_t ePa = pgm_read_word(&SAT_VAPOUR_PA[i]);
+  if (i < COMFORT_E_POINTS - 1) {
+    int32_t next = pgm_read_word(&SAT_VAPOUR_PA[i + 1]);
+    ePa += (next - ePa) * frac / 10;
+  }
+
+  // 0.5555 × (e[hPa] - 10) × 10 = (5555 × e[Pa] - 5555000) / 100000
+  return (int16_t)(temp10 + roundedDiv(5555L * ePa - 5555000L, 100000L));
+}
+
+/**
+ * @brief Heat index (Steadman, Rothfusz regression above 80°F)
+ *
+ * Same regression and adjustments as DHT::computeHeatIndex(), rewritten
+ * in Horner form with float constants so it runs on the FPU in a single
+ * pass instead of seven double-precision pow() calls.
+ */
+float heatIndexC(float temp, float humidity) {
+  float f = temp * 1.8f + 32.0f;
+  float h = humidity;
+  float hi = 0.5f * (f + 61.0f + ((f - 68.0f) * 1.2f) + (h * 0.094f));
+
+  if (hi > 79.0f) {
+    hi = -42.379f + h * (10.14333127f - 0.05481717f * h)
+       + f * (2.04901523f - 0.22475541f * h + 0.00085282f * h * h)
+       + f * f * (-0.00683783f + h * (0.00122874f - 0.00000199f * h));
+
+    if (h < 13.0f && f >= 80.0f && f <= 112.0f) {
+      hi -= ((13.0f - h) * 0.25f) * sqrtf((17.0f - fabsf(f - 95.0f)) * 0.05882f);
+    } else if (h > 85.0f && f >= 80.0f && f <= 87.0f) {
+      hi += ((h - 85.0f) * 0.1f) * ((87.0f - f) * 0.2f);
+    }
+  }
+
+  return (hi - 32.0f) * 0.55555f;
+}
+
+/**
+ * @brief Compute and cache all derived metrics of a reading
+ *
+ * Dew point is computed once and reused by humidex.
+ */
+void computeComfortMetrics(SensorData& data) {
+  int16_t t10 = (int16_t)lroundf(data.temperature * 10);
+  uint16_t h10 = (uint16_t)lroundf(data.humidity * 10);
+
+  int16_t td10 = dewPoint10(t10, h10);
+  int16_t hx10 = humidex10(t10, td10);
+
+  data.dewPoint = td10 / 10.0f;
+  data.humidex = (int)roundedDiv(hx10, 10);
+  data.feelsLike = heatIndexC(data.temperature, data.humidity);
+}
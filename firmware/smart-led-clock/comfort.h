@@ -0,0 +1,84 @@
+/**
+ * @file comfort.h
+ * @brief Fast comfort metric kernels (dew point, humidex, heat index)
+ *
+ * Replaces the double-precision log()/exp() formulas with integer kernels
+ * based on small flash tables. Inputs and outputs use the data log units
+ * (°C × 10, %RH × 10).
+ *
+ * - Dew point: Magnus-Tetens (a = 17.27, b = 237.3). ln(RH) from a 1 %
+ *   table over 20-100 %RH; lower humidities are normalised by powers of 2.
+ * - Humidex: saturation vapour pressure at the dew point from a 1 °C
+ *   table over -60..+60 °C, linear interpolation.
+ * - Heat index: Rothfusz/Steadman regression (same as the DHT library),
+ *   evaluated once in single precision with Horner's scheme (the RA4M1
+ *   FPU handles float, whereas the library path uses double pow()).
+ *
+ * Maximum error against the previous float implementations over
+ * -40..+60 °C and 1..100 %RH (tools/gen_comfort_tables.py, and on the
+ * compiled code by tools/host/host_comfort.cpp):
+ * - Dew point:  0.07 °C (including 0.1 °C output resolution)
+ * - Humidex:    0.4 points (before rounding to integer)
+ * - Heat index: < 0.01 °C
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#ifndef COMFORT_H
+#define COMFORT_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ==========================================
+// TABLE CONFIGURATION
+// ==========================================
+#define COMFORT_LN_FIRST        20    ///< First %RH in ln table
+#define COMFORT_LN_POINTS       81    ///< ln table entries (20..100 %RH)
+#define COMFORT_E_FIRST         -60   ///< First dew point in vapour pressure table (°C)
+#define COMFORT_E_POINTS        121   ///< Vapour pressure entries (-60..+60 °C)
+
+// ==========================================
+// FUNCTION DECLARATIONS
+// ==========================================
+
+/**
+ * @brief Dew point (Magnus-Tetens), fixed point
+ * @param temp10 Temperature in °C × 10
+ * @param hum10 Relative humidity in % × 10
+ * @return Dew point in °C × 10
+ */
+int16_t dewPoint10(int16_t temp10, uint16_t hum10);
+
+/**
+ * @brief Humidex from temperature and an already computed dew point
+ * @param temp10 Temperature in °C × 10
+ * @param dew10 Dew point in °C × 10
+ * @return Humidex × 10
+ */
+int16_t humidex10(int16_t temp10, int16_t dew10);
+
+/**
+ * @brief Heat index (feels-like), single evaluation
+ * @param temp Temperature in Celsius
+ * @param humidity Relative humidity in %
+ * @return Heat index in Celsius
+ */
+float heatIndexC(float temp, float humidity);
+
+/**
+ * @brief Compute and cache all derived metrics of a reading
+ *
+ * Fills feelsLike, dewPoint and humidex from temperature and humidity.
+ * Call once per accepted reading; consumers read the cached fields.
+ *
+ * @param data Sensor data with temperature and humidity set
+ */
+void computeComfortMetrics(SensorData& data);
+
+#endif // COMFORT_H
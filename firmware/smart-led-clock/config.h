@@ -109,6 +109,25 @@
 #define DHT_TYPE                DHT22
 #define SENSOR_UPDATE           5       ///< Sensor read every 5 seconds
 
+// Per-sensor polling schedule (seconds, see sensor registry in sensors.cpp).
+// Each sensor also has a phase so reads are spread over different ticks.
+#define SENSOR_PERIOD_DHT       SENSOR_UPDATE ///< DHT22 poll period
+#define SENSOR_PERIOD_AIR       SENSOR_UPDATE ///< MQ135 poll period
+#define SENSOR_PERIOD_RTC_TEMP  60      ///< DS3231 die temperature (chip converts every 64 s)
+#define SENSOR_STALE_PERIODS    3       ///< Sensor is stale after this many periods without a good read
+
+// Sensor filtering (see filter.h). Units: temp/humidity × 10, raw ADC counts
+#define FILTER_TEMP_MEDIAN      5       ///< Median window for temperature
+#define FILTER_TEMP_EMA_SHIFT   2       ///< Temperature EMA alpha = 1/4
+#define FILTER_TEMP_MAX_STEP    20      ///< Reject temperature jumps > 2.0°C per reading
+#define FILTER_HUM_MEDIAN       5       ///< Median window for humidity
+#define FILTER_HUM_EMA_SHIFT    2       ///< Humidity EMA alpha = 1/4
+#define FILTER_HUM_MAX_STEP     80      ///< Reject humidity jumps > 8.0% per reading
+#define FILTER_AQ_MEDIAN        5       ///< Median window for MQ135 ADC
+#define FILTER_AQ_EMA_SHIFT     3       ///< MQ135 EMA alpha = 1/8
+#define FILTER_AQ_MAX_STEP      2400    ///< Reject MQ135 jumps > 2400 counts (14-bit) per reading
+#define FILTER_MAX_REJECTS      3       ///< Consecutive rejects before accepting a new level
+
 // ==========================================
 // DATA LOGGING CONFIGURATION
 // ==========================================
@@ -186,13 +205,15 @@ enum DisplayMode {
  * @brief Temperature and humidity sensor data container
  */
 struct SensorData {
-  float temperature;        ///< Temperature in Celsius
-  float humidity;          ///< Relative humidity in %
+  float temperature;        ///< Filtered temperature in Celsius
+  float humidity;          ///< Filtered relative humidity in %
   float feelsLike;         ///< Feels-like temperature in Celsius
   float dewPoint;          ///< Dew point in Celsius
   int humidex;            ///< Canadian humidex index
   bool valid;             ///< Data validity flag
   unsigned long lastUpdate; ///< Timestamp of last update (millis)
+  float rawTemperature;     ///< Unfiltered temperature (diagnostics)
+  float rawHumidity;        ///< Unfiltered humidity (diagnostics)
 };
 
 /**
@@ -200,13 +221,50 @@ struct SensorData {
  * @brief Air quality sensor data container
  */
 struct AirQualityData {
-  int rawADC;              ///< Raw ADC value from MQ135
+  int rawADC;              ///< Raw 14-bit oversampled ADC value from MQ135 (diagnostics)
+  int filteredADC;         ///< Filtered ADC value used for AQI
+  int ppm;                 ///< Compensated CO2-equivalent concentration (ppm)
   int estimatedAQI;        ///< Estimated Air Quality Index (0-500)
   const char* quality;     ///< Quality description string
   bool valid;             ///< Data validity flag
   unsigned long lastUpdate; ///< Timestamp of last update (millis)
 };
 
+/**
+ * @enum SensorChannelId
+ * @brief Logged/published sensor channels
+ * 
+ * One entry per scalar value. The data log, MQTT and web JSON iterate
+ * over these, so adding a sensor only means adding its channels here
+ * and its slot in the sensor registry (sensors.cpp).
+ */
+enum SensorChannelId {
+  CH_TEMP_INDOOR = 0,      ///< Indoor temperature (°C × 10)
+  CH_HUM_INDOOR,           ///< Indoor humidity (% × 10)
+  CH_TEMP_OUTDOOR,         ///< Outdoor temperature (°C × 10)
+  CH_HUM_OUTDOOR,          ///< Outdoor humidity (% × 10)
+  CH_AQI,                  ///< Air Quality Index
+  CH_TEMP_RTC,             ///< DS3231 die temperature (°C × 10)
+  SENSOR_CHANNEL_COUNT     ///< Total number of channels
+};
+
+#define SENSOR_VALUE_INVALID    INT16_MIN  ///< Scaled value marking a missing reading
+
+/**
+ * @struct SensorChannel
+ * @brief Latest value of one channel, in fixed point
+ */
+struct SensorChannel {
+  const char* key;         ///< Short JSON key (e.g. "tIn")
+  uint8_t decimals;        ///< Value scale: 0 = integer, 1 = × 10
+  int16_t rollupBase;      ///< Rollup quantization: lowest value (scaled)
+  uint8_t rollupStep;      ///< Rollup quantization: step (scaled), 254 steps
+  uint8_t deadband;        ///< Data log deadband (scaled): smaller moves are not logged
+  int16_t value;           ///< Latest filtered value (scaled)
+  bool valid;              ///< Data validity flag
+  unsigned long lastUpdate; ///< Timestamp of last update (millis)
+};
+
 // ==========================================
 // GLOBAL VARIABLES (extern declarations)
 // ==========================================
@@ -230,6 +288,7 @@ extern int animationHue;
 extern SensorData indoorData;
 extern SensorData outdoorData;
 extern AirQualityData airQuality;
+extern SensorChannel sensorChannels[SENSOR_CHANNEL_COUNT];
 extern int lastAirQualityValue;
 
 // WiFi & NTP state
@@ -0,0 +1,442 @@
+/**
+ * @file configparser.cpp
+ * @brief Validating JSON parser for configuration updates implementation
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#include "configparser.h"
+#include <stddef.h>
+
+// ==========================================
+// FIELD TABLE
+// ==========================================
+
+/**
+ * @struct ConfigField
+ * @brief Path of a field, where it lives in ClockConfig and its range
+ */
+struct ConfigField {
+  const char* path;
+  uint16_t offset;          ///< offsetof(ClockConfig, ...)
+  uint8_t size;             ///< 1 (int8_t / uint8_t) or 4 (uint32_t)
+  int32_t min;
+  int32_t max;
+};
+
+#define CONFIG_FIELD(path, member, low, high) \
+  {path, offsetof(ClockConfig, member), sizeof(((ClockConfig*)0)->member), low, high}
+
+// In ConfigFieldId order
+static const ConfigField fields[] = {
+  CONFIG_FIELD("timezoneOffset",   timezoneOffset, -12, 14),
+  CONFIG_FIELD("ntpSyncHour",      ntpSyncHour,    0, 23),
+  CONFIG_FIELD("ntpSyncMinute",    ntpSyncMinute,  0, 59),
+  CONFIG_FIELD("led.hour.r",       colorHourR,     0, 255),
+  CONFIG_FIELD("led.hour.g",       colorHourG,     0, 255),
+  CONFIG_FIELD("led.hour.b",       colorHourB,     0, 255),
+  CONFIG_FIELD("led.minute.r",     colorMinuteR,   0, 255),
+  CONFIG_FIELD("led.minute.g",     colorMinuteG,   0, 255),
+  CONFIG_FIELD("led.minute.b",     colorMinuteB,   0, 255),
+  CONFIG_FIELD("led.second.r",     colorSecondR,   0, 255),
+  CONFIG_FIELD("led.second.g",     colorSecondG,   0, 255),
+  CONFIG_FIELD("led.second.b",     colorSecondB,   0, 255),
+  CONFIG_FIELD("led.brightness",   ledBrightness,  0, 255),
+  CONFIG_FIELD("lcdTimeout",       lcdTimeout,     5000, 300000)
+};
+
+static_assert(sizeof(fields) / sizeof(fields[0]) == CONFIG_FIELD_COUNT,
+              "fields[] must have one entry per ConfigFieldId");
+
+/**
+ * @brief Field at a path
+ * @return Field index, -1 if none
+ */
+static int findField(const char* path) {
+  for (int i = 0; i < CONFIG_FIELD_COUNT; i++) {
+    if (strcmp(fields[i].path, path) == 0) return i;
+  }
+  return -1;
+}
+
+/**
+ * @brief Check whether a path is an object holding fields ("led.hour")
+ */
+static bool isObjectPath(const char* path, size_t length) {
+  for (int i = 0; i < CONFIG_FIELD_COUNT; i++) {
+    if (strncmp(fields[i].path, path, length) == 0 && fields[i].path[length] == '.') return true;
+  }
+  return false;
+}
+
+// ==========================================
+// TOKENIZER
+// ==========================================
+
+enum ConfigToken {
+  TOKEN_BEGIN_OBJECT,
+  TOKEN_END_OBJECT,
+  TOKEN_BEGIN_ARRAY,
+  TOKEN_END_ARRAY,
+  TOKEN_COLON,
+  TOKEN_COMMA,
+  TOKEN_STRING,
+  TOKEN_INTEGER,
+  TOKEN_NUMBER,             ///< Fraction or exponent
+  TOKEN_LITERAL,            ///< true, false, null
+  TOKEN_END,
+  TOKEN_INVALID
+};
+
+/**
+ * @struct ConfigScanner
+ * @brief Tokenizer position and last token
+ */
+struct ConfigScanner {
+  const char* data;
+  size_t length;
+  size_t pos;
+  size_t start;             ///< Offset of the last token
+  ConfigToken token;
+  char text[CONFIG_MAX_PATH];   ///< String token (cut to fit)
+  uint8_t textLength;
+  bool textCut;             ///< String longer than text
+  int32_t integer;          ///< Integer token
+  bool overflow;            ///< Integer beyond int32_t
+};
+
+static inline bool isDigit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+static inline bool isHex(char c) {
+  return isDigit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+/**
+ * @brief Add a string character to the token text
+ */
+static inline void textAppend(ConfigScanner* scan, char c) {
+  if (scan->textLength + 1 < CONFIG_MAX_PATH) {
+    scan->text[scan->textLength++] = c;
+    scan->text[scan->textLength] = '\0';
+  } else {
+    scan->textCut = true;
+  }
+}
+
+/**
+ * @brief Read a string (opening quote consumed)
+ *
+ * Escapes are checked; \u escapes are kept as '?', since no field name
+ * has one.
+ */
+static ConfigToken scanString(ConfigScanner* scan) {
+  scan->text[0] = '\0';
+  scan->textLength = 0;
+  scan->textCut = false;
+
+  while (scan->pos < scan->length) {
+    char c = scan->data[scan->pos++];
+    if (c == '"') return TOKEN_STRING;
+    if ((uint8_t)c < 0x20) return TOKEN_INVALID;
+    if (c != '\\') {
+      textAppend(scan, c);
+      continue;
+    }
+
+    if (scan->pos >= scan->length) return TOKEN_INVALID;
+    c = scan->data[scan->pos++];
+    switch (c) {
+      case '"': case '\\': case '/': textAppend(scan, c); break;
+      case 'b': textAppend(scan, '\b'); break;
+      case 'f': textAppend(scan, '\f'); break;
+      case 'n': textAppend(scan, '\n'); break;
+      case 'r': textAppend(scan, '\r'); break;
+      case 't': textAppend(scan, '\t'); break;
+      case 'u':
+        for (uint8_t i = 0; i < 4; i++) {
+          if (scan->pos >= scan->length || !isHex(scan->data[scan->pos])) return TOKEN_INVALID;
+          scan->pos++;
+        }
+        textAppend(scan, '?');
+        break;
+      default:
+        return TOKEN_INVALID;
+    }
+  }
+  return TOKEN_INVALID;
+}
+
+/**
+ * @brief Read a number: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+ */
+static ConfigToken scanNumber(ConfigScanner* scan) {
+  const char* d = scan->data;
+  bool negative = false;
+  int64_t value = 0;
+
+  scan->overflow = false;
+  if (d[scan->pos] == '-') {
+    negative = true;
+    scan->pos++;
+  }
+  if (scan->pos >= scan->length || !isDigit(d[scan->pos])) return TOKEN_INVALID;
+
+  if (d[scan->pos] == '0') {
+    scan->pos++;
+  } else {
+    while (scan->pos < scan->length && isDigit(d[scan->pos])) {
+      if (value <= INT32_MAX) value = value * 10 + (d[scan->pos] - '0');
+      scan->pos++;
+    }
+  }
+  if (value > INT32_MAX) scan->overflow = true;
+  scan->integer = (int32_t)(negative ? -value : value);
+
+  ConfigToken token = TOKEN_INTEGER;
+  if (scan->pos < scan->length && d[scan->pos] == '.') {
+    scan->pos++;
+    if (scan->pos >= scan->length || !isDigit(d[scan->pos])) return TOKEN_INVALID;
+    while (scan->pos < scan->length && isDigit(d[scan->pos])) scan->pos++;
+    token = TOKEN_NUMBER;
+  }
+  if (scan->pos < scan->length && (d[scan->pos] == 'e' || d[scan->pos] == 'E')) {
+    scan->pos++;
+    if (scan->pos < scan->length && (d[scan->pos] == '+' || d[scan->pos] == '-')) scan->pos++;
+    if (scan->pos >= scan->length || !isDigit(d[scan->pos])) return TOKEN_INVALID;
+    while (scan->pos < scan->length && isDigit(d[scan->pos])) scan->pos++;
+    token = TOKEN_NUMBER;
+  }
+  return token;
+}
+
+/**
+ * @brief Read true, false or null
+ */
+static ConfigToken scanLiteral(ConfigScanner* scan) {
+  static const char* const literals[] = {"true", "false", "null"};
+  for (uint8_t i = 0; i < 3; i++) {
+    size_t n = strlen(literals[i]);
+    if (scan->length - scan->pos >= n && memcmp(scan->data + scan->pos, literals[i], n) == 0) {
+      scan->pos += n;
+      return TOKEN_LITERAL;
+    }
+  }
+  return TOKEN_INVALID;
+}
+
+/**
+ * @brief Move to the next token
+ */
+static ConfigToken nextToken(ConfigScanner* scan) {
+  while (scan->pos < scan->length) {
+    char c = scan->data[scan->pos];
+    if (c != ' ' && c != '\t' && c != '\n' && c != '\r') break;
+    scan->pos++;
+  }
+  scan->start = scan->pos;
+
+  if (scan->pos >= scan->length) {
+    scan->token = TOKEN_END;
+    return scan->token;
+  }
+
+  char c = scan->data[scan->pos];
+  switch (c) {
+    case '{': scan->pos++; scan->token = TOKEN_BEGIN_OBJECT; break;
+    case '}': scan->pos++; scan->token = TOKEN_END_OBJECT; break;
+    case '[': scan->pos++; scan->token = TOKEN_BEGIN_ARRAY; break;
+    case ']': scan->pos++; scan->token = TOKEN_END_ARRAY; break;
+    case ':': scan->pos++; scan->token = TOKEN_COLON; break;
+    case ',': scan->pos++; scan->token = TOKEN_COMMA; break;
+    case '"': scan->pos++; scan->token = scanString(scan); break;
+    case 't': case 'f': case 'n': scan->token = scanLiteral(scan); break;
+    default:
+      scan->token = (c == '-' || isDigit(c)) ? scanNumber(scan) : TOKEN_INVALID;
+      break;
+  }
+  return scan->token;
+}
+
+/**
+ * @brief Check whether a token starts a value
+ */
+static inline bool isValue(ConfigToken token) {
+  return token == TOKEN_BEGIN_OBJECT || token == TOKEN_BEGIN_ARRAY || token == TOKEN_STRING ||
+         token == TOKEN_INTEGER || token == TOKEN_NUMBER || token == TOKEN_LITERAL;
+}
+
+// ==========================================
+// PARSER
+// ==========================================
+
+/**
+ * @struct ConfigParser
+ * @brief Parse state: tokenizer, path of the current key, output
+ */
+struct ConfigParser {
+  ConfigScanner scan;
+  char path[CONFIG_MAX_PATH];
+  uint8_t pathLength;
+  bool pathCut;             ///< A key did not fit: the path matches nothing
+  ConfigDelta* delta;
+  ConfigParseResult* result;
+};
+
+/**
+ * @brief Stop the parse with an error at the current token
+ * @return false
+ */
+static bool fail(ConfigParser* parser, ConfigParseError error) {
+  parser->result->error = error;
+  parser->result->position = (uint16_t)parser->scan.start;
+  memcpy(parser->result->field, parser->path, parser->pathLength + 1);
+  return false;
+}
+
+/**
+ * @brief Append the key just read to the path ("led" + "hour")
+ */
+static void pathPush(ConfigParser* parser) {
+  const ConfigScanner* scan = &parser->scan;
+  if (scan->textCut) parser->pathCut = true;
+
+  if (parser->pathLength > 0 && parser->pathLength + 1 < CONFIG_MAX_PATH) {
+    parser->path[parser->pathLength++] = '.';
+  }
+  for (uint8_t i = 0; i < scan->textLength; i++) {
+    if (parser->pathLength + 1 >= CONFIG_MAX_PATH) {
+      parser->pathCut = true;
+      break;
+    }
+    parser->path[parser->pathLength++] = scan->text[i];
+  }
+  parser->path[parser->pathLength] = '\0';
+}
+
+/**
+ * @brief Back to the path of the enclosing object
+ */
+static void pathPop(ConfigParser* parser, uint8_t length, bool cut) {
+  parser->pathLength = length;
+  parser->path[length] = '\0';
+  parser->pathCut = cut;
+}
+
+/**
+ * @brief Store a field value after its range check
+ */
+static bool storeField(ConfigParser* parser, int index) {
+  const ConfigScanner* scan = &parser->scan;
+  if (scan->token != TOKEN_INTEGER) {
+    return fail(parser, isValue(scan->token) ? CONFIG_PARSE_TYPE : CONFIG_PARSE_SYNTAX);
+  }
+  if (scan->overflow || scan->integer < fields[index].min || scan->integer > fields[index].max) {
+    return fail(parser, CONFIG_PARSE_RANGE);
+  }
+  parser->delta->fields |= (1U << index);
+  parser->delta->values[index] = scan->integer;
+  return true;
+}
+
+/**
+ * @brief Parse the members of an object (opening brace consumed)
+ *
+ * Recursion only follows the objects of the field table (two levels).
+ */
+static bool parseObject(ConfigParser* parser) {
+  ConfigScanner* scan = &parser->scan;
+
+  if (nextToken(scan) == TOKEN_END_OBJECT) return true;
+
+  while (true) {
+    if (scan->token != TOKEN_STRING) return fail(parser, CONFIG_PARSE_SYNTAX);
+
+    uint8_t parentLength = parser->pathLength;
+    bool parentCut = parser->pathCut;
+    pathPush(parser);
+
+    size_t keyStart = scan->start;
+    if (nextToken(scan) != TOKEN_COLON) return fail(parser, CONFIG_PARSE_SYNTAX);
+    nextToken(scan);
+
+    int index = parser->pathCut ? -1 : findField(parser->path);
+    if (index >= 0) {
+      if (!storeField(parser, index)) return false;
+    } else if (!parser->pathCut && isObjectPath(parser->path, parser->pathLength)) {
+      if (scan->token != TOKEN_BEGIN_OBJECT) {
+        return fail(parser, isValue(scan->token) ? CONFIG_PARSE_TYPE : CONFIG_PARSE_SYNTAX);
+      }
+      if (!parseObject(parser)) return false;
+    } else {
+      scan->start = keyStart;
+      return fail(parser, CONFIG_PARSE_UNKNOWN);
+    }
+
+    pathPop(parser, parentLength, parentCut);
+
+    nextToken(scan);
+    if (scan->token == TOKEN_END_OBJECT) return true;
+    if (scan->token != TOKEN_COMMA) return fail(parser, CONFIG_PARSE_SYNTAX);
+    nextToken(scan);
+  }
+}
+
+// ==========================================
+// PUBLIC API
+// ==========================================
+
+bool parseConfigJSON(const char* json, size_t length, ConfigDelta* delta, ConfigParseResult* result) {
+  ConfigParser parser;
+  parser.scan.data = json;
+  parser.scan.length = length;
+  parser.scan.pos = 0;
+  parser.path[0] = '\0';
+  parser.pathLength = 0;
+  parser.pathCut = false;
+  parser.delta = delta;
+  parser.result = result;
+
+  delta->fields = 0;
+  result->error = CONFIG_PARSE_OK;
+  result->field[0] = '\0';
+  result->position = 0;
+
+  if (nextToken(&parser.scan) != TOKEN_BEGIN_OBJECT) return fail(&parser, CONFIG_PARSE_SYNTAX);
+  if (!parseObject(&parser)) return false;
+  if (nextToken(&parser.scan) != TOKEN_END) return fail(&parser, CONFIG_PARSE_SYNTAX);
+  return true;
+}
+
+void applyConfigDelta(const ConfigDelta* delta, ClockConfig* config) {
+  uint8_t* base = (uint8_t*)config;
+
+  for (int i = 0; i < CONFIG_FIELD_COUNT; i++) {
+    if (!(delta->fields & (1U << i))) continue;
+
+    if (fields[i].size == 1) {
+      uint8_t value = (uint8_t)delta->values[i];      // int8_t fields: two's complement
+      memcpy(base + fields[i].offset, &value, 1);
+    } else {
+      uint32_t value = (uint32_t)delta->values[i];
+      memcpy(base + fields[i].offset, &value, 4);
+    }
+  }
+}
+
+const char* configParseErrorText(ConfigParseError error) {
+  switch (error) {
+    case CONFIG_PARSE_OK:      return "OK";
+    case CONFIG_PARSE_SYNTAX:  return "Malformed JSON";
+    case CONFIG_PARSE_UNKNOWN: return "Unknown field";
+    case CONFIG_PARSE_TYPE:    return "Integer expected";
+    case CONFIG_PARSE_RANGE:   return "Out of range";
+  }
+  return "Error";
+}
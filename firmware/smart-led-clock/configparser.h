@@ -0,0 +1,125 @@
+/**
+ * @file configparser.h
+ * @brief Validating JSON parser for configuration updates
+ *
+ * Single pass over the body of POST /api/config: a tokenizer reads each
+ * byte once and the parser follows the key path ("led.hour.r") through
+ * a table of the known fields, so a key only matches at its own place in
+ * the document (an "r" of the minute colour can't be taken for the hour
+ * one).
+ *
+ * Each field has a range. The result is a delta: the fields present and
+ * their values, applied to a ClockConfig only if the whole body is valid.
+ * On error, the offending field is named:
+ *
+ *   {"led":{"hour":{"r":300}}}   -> CONFIG_PARSE_RANGE, "led.hour.r"
+ *   {"brightnes":10}             -> CONFIG_PARSE_UNKNOWN, "brightnes"
+ *
+ * Only integers are accepted as values; unknown fields, arrays, strings
+ * or trailing bytes are errors, as is anything that isn't well-formed
+ * JSON. Nothing is copied: the body is read where it is.
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#ifndef CONFIGPARSER_H
+#define CONFIGPARSER_H
+
+#include <Arduino.h>
+#include "storage.h"
+
+// ==========================================
+// PARSER CONFIGURATION
+// ==========================================
+#define CONFIG_MAX_PATH         24      ///< Longest field path kept ("led.minute.r")
+
+// ==========================================
+// DATA STRUCTURES
+// ==========================================
+
+/**
+ * @enum ConfigFieldId
+ * @brief Fields accepted in a configuration update (bit in ConfigDelta::fields)
+ */
+enum ConfigFieldId {
+  CONFIG_TIMEZONE_OFFSET,   ///< "timezoneOffset" (-12 to +14)
+  CONFIG_NTP_SYNC_HOUR,     ///< "ntpSyncHour" (0-23)
+  CONFIG_NTP_SYNC_MINUTE,   ///< "ntpSyncMinute" (0-59)
+  CONFIG_HOUR_R,            ///< "led.hour.r" (0-255)
+  CONFIG_HOUR_G,
+  CONFIG_HOUR_B,
+  CONFIG_MINUTE_R,          ///< "led.minute.r" (0-255)
+  CONFIG_MINUTE_G,
+  CONFIG_MINUTE_B,
+  CONFIG_SECOND_R,          ///< "led.second.r" (0-255)
+  CONFIG_SECOND_G,
+  CONFIG_SECOND_B,
+  CONFIG_BRIGHTNESS,        ///< "led.brightness" (0-255)
+  CONFIG_LCD_TIMEOUT,       ///< "lcdTimeout" (5000-300000 ms)
+  CONFIG_FIELD_COUNT
+};
+
+/**
+ * @enum ConfigParseError
+ * @brief Outcome of a parse
+ */
+enum ConfigParseError {
+  CONFIG_PARSE_OK,
+  CONFIG_PARSE_SYNTAX,      ///< Not well-formed JSON (or not an object)
+  CONFIG_PARSE_UNKNOWN,     ///< Field not in the table
+  CONFIG_PARSE_TYPE,        ///< Wrong kind of value (object, string, fraction...)
+  CONFIG_PARSE_RANGE        ///< Integer outside the field's range
+};
+
+/**
+ * @struct ConfigDelta
+ * @brief Fields found in an update and their values
+ */
+struct ConfigDelta {
+  uint16_t fields;                        ///< Bit n: field n present
+  int32_t values[CONFIG_FIELD_COUNT];     ///< Value of each present field
+};
+
+/**
+ * @struct ConfigParseResult
+ * @brief Error report of a parse
+ */
+struct ConfigParseResult {
+  ConfigParseError error;
+  char field[CONFIG_MAX_PATH];  ///< Path where the error was found ("" at the top level)
+  uint16_t position;            ///< Body offset where the error was found
+};
+
+// ==========================================
+// FUNCTION DECLARATIONS
+// ==========================================
+
+/**
+ * @brief Parse a configuration update
+ *
+ * @param json Body (need not be null-terminated)
+ * @param length Body length
+ * @param delta Filled with the fields found (complete only on success)
+ * @param result Filled with the error, if any
+ * @return true if the whole body is valid
+ */
+bool parseConfigJSON(const char* json, size_t length, ConfigDelta* delta, ConfigParseResult* result);
+
+/**
+ * @brief Write the fields of a delta into a configuration
+ * @param delta Fields from a successful parse
+ * @param config Configuration to update (other fields kept)
+ */
+void applyConfigDelta(const ConfigDelta* delta, ClockConfig* config);
+
+/**
+ * @brief Short description of a parse error ("Out of range")
+ */
+const char* configParseErrorText(ConfigParseError error);
+
+#endif // CONFIGPARSER_H
@@ -11,6 +11,8 @@
  */
 
 #include "datalog.h"
+#include "printstream.h"
+#include "jsonwriter.h"
 
 
 // External flag to prevent I2C conflicts during MQTT
@@ -20,13 +22,11 @@ extern bool mqttBusy;
 // GLOBAL VARIABLES
 // ==========================================
 
-// Circular buffer for data storage
-DataPoint dataBuffer[MAX_DATA_POINTS];
-uint16_t bufferWriteIndex = 0;
-uint16_t bufferCount = 0;
+// Compressed ring buffer for data storage
+TsRing logRing;
 
 // Logging statistics
-DataLogStats logStats = {0, 0, 0, 0, 0, false};
+DataLogStats logStats = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, MQTT_DRAIN_INTERVAL_MIN, false};
 
 // MQTT client
 extern WiFiClient mqttWifiClient;
@@ -35,11 +35,443 @@ PubSubClient mqttClient;
 // Timing variables
 unsigned long lastLogTime = 0;
 unsigned long lastMQTTAttempt = 0;
+unsigned long lastHealthTime = 0;
+
+// Buffer drain pacing (adapted to publish success)
+unsigned long lastDrainTime = 0;
+unsigned long drainInterval = MQTT_DRAIN_INTERVAL_MIN;
+
+// Log interval statistics: every reading since the last logged point
+static RollupAccumulator intervalStats;
+static RollupAccumulator checkStats;        // Readings since the last deadband check
+static RollupAccumulator loggedInterval;    // Interval of the last logged point
+static unsigned long intervalFed[SENSOR_CHANNEL_COUNT];
+
+// Deadband reference: values of the last logged point (interval means)
+static int16_t deadbandRef[SENSOR_CHANNEL_COUNT];
+static unsigned long lastPointTime = 0;
+static bool deadbandArmed = false;          // false until the first point
+
+// ==========================================
+// PRIVATE HELPER FUNCTIONS
+// ==========================================
+
+/**
+ * @brief Payload serializer, called twice per publish (length, then data)
+ * 
+ * Must produce the same bytes on both calls.
+ */
+typedef void (*PayloadWriter)(Print& out, const void* context);
+
+/**
+ * @brief Publish a payload streamed straight into the MQTT client
+ * 
+ * Measures the payload with a first pass, then serializes it again
+ * between beginPublish() and endPublish(): no staging buffer, and no
+ * size limit from the PubSubClient buffer.
+ * 
+ * @return true if published completely
+ */
+static bool publishStream(const char* topic, PayloadWriter writer, const void* context, bool retained) {
+  LengthCounter counter;
+  writer(counter, context);
+  
+  // Set flag before publish to prevent I2C conflicts
+  mqttBusy = true;
+  bool success = mqttClient.beginPublish(topic, counter.count, retained);
+  if (success) {
+    BlockStream stream(mqttClient);
+    writer(stream, context);
+    stream.flush();
+    success = (mqttClient.endPublish() == 1) && stream.written == counter.count;
+  }
+  mqttBusy = false;
+  
+  return success;
+}
+
+/**
+ * @brief Write one data point as JSON object ({"ts":...,"tIn":...,...})
+ */
+static void writeDataPointJSON(JsonWriter& json, const DataPoint* dp) {
+  json.beginObject();
+  json.key("ts").number((unsigned long)dp->timestamp);
+  writeChannelsJSON(json, dp->values);
+  json.endObject();
+}
+
+/**
+ * @brief Store an integer little endian
+ * @return Position after the stored bytes
+ */
+static inline uint8_t* putLE(uint8_t* out, uint32_t v, uint8_t bytes) {
+  for (uint8_t i = 0; i < bytes; i++) {
+    *out++ = (uint8_t)(v >> (8 * i));
+  }
+  return out;
+}
+
+/**
+ * @brief Writer of one history row (JSON object or binary record)
+ * @param row Row number in the response (0 = first)
+ */
+typedef void (*HistoryRowWriter)(Print& out, const DataPoint* dp, uint16_t row);
+
+static void writeHistoryRowJSON(Print& out, const DataPoint* dp, uint16_t row) {
+  if (row > 0) out.print(',');
+  JsonWriter json(out);
+  writeDataPointJSON(json, dp);
+}
+
+static void writeHistoryRowBinary(Print& out, const DataPoint* dp, uint16_t) {
+  uint8_t record[HISTORY_BIN_RECORD_SIZE];
+  uint8_t* p = putLE(record, dp->timestamp, 4);
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    p = putLE(p, (uint16_t)dp->values[ch], 2);
+  }
+  out.write(record, sizeof(record));
+}
+
+/**
+ * @brief Value of the LTTB channel as a float (false if missing)
+ */
+static inline bool lttbValue(const DataPoint* dp, uint8_t channel, float* y) {
+  if (dp->values[channel] == SENSOR_VALUE_INVALID) return false;
+  *y = dp->values[channel];
+  return true;
+}
+
+/**
+ * @brief Write points [first, first + count) downsampled with LTTB
+ * 
+ * Largest-Triangle-Three-Buckets on one channel: keeps the first and
+ * last points and, in each bucket, the point forming the largest
+ * triangle with the previously kept point and the average of the next
+ * bucket. Streamed with two cursors (current and next bucket): every
+ * point is decoded twice, memory is constant.
+ */
+static void printDownsampled(Print& out, HistoryRowWriter writeRow, uint16_t first,
+                             uint16_t count, uint16_t points, uint8_t channel) {
+  TsCursor cursor, ahead;
+  DataPoint dp, best;
+  
+  // First point is always kept (A of the first triangle)
+  tsRingSeek(&logRing, &cursor, first);
+  tsRingNext(&logRing, &cursor, &best);
+  writeRow(out, &best, 0);
+  uint32_t t0 = best.timestamp;
+  float ax = 0, ay = 0;
+  bool aValid = lttbValue(&best, channel, &ay);
+  
+  // Bucket b covers [1 + b*(count-2)/(points-2), 1 + (b+1)*(count-2)/(points-2))
+  uint16_t buckets = points - 2;
+  uint16_t aheadIndex = 1;
+  ahead = cursor;
+  
+  for (uint16_t b = 0; b < buckets; b++) {
+    uint16_t start = 1 + (uint32_t)b * (count - 2) / buckets;
+    uint16_t next = 1 + (uint32_t)(b + 1) * (count - 2) / buckets;
+    uint16_t nextEnd = (b + 1 < buckets) ? 1 + (uint32_t)(b + 2) * (count - 2) / buckets : count;
+    
+    // C: average of the next bucket (the last point for the last bucket)
+    float cx = 0, cy = 0, y;
+    uint16_t cn = 0, cyn = 0;
+    for (; aheadIndex < nextEnd && tsRingNext(&logRing, &ahead, &dp); aheadIndex++) {
+      if (aheadIndex < next) continue;
+      cx += dp.timestamp - t0;
+      cn++;
+      if (lttbValue(&dp, channel, &y)) {
+        cy += y;
+        cyn++;
+      }
+    }
+    cx = cn ? cx / cn : ax;
+    cy = cyn ? cy / cyn : ay;
+    float refY = aValid ? ay : cy;
+    
+    // B: point of this bucket with the largest triangle A-B-C
+    // (missing values only win if the whole bucket is missing)
+    float bestArea = -2;
+    for (uint16_t i = start; i < next && tsRingNext(&logRing, &cursor, &dp); i++) {
+      float area = -1;
+      if (lttbValue(&dp, channel, &y)) {
+        float x = dp.timestamp - t0;
+        area = fabsf((ax - cx) * (y - refY) - (ax - x) * (cy - refY));
+      }
+      if (area > bestArea) {
+        bestArea = area;
+        best = dp;
+      }
+    }
+    
+    writeRow(out, &best, b + 1);
+    ax = best.timestamp - t0;
+    aValid = lttbValue(&best, channel, &ay);
+  }
+  
+  // Last point is always kept
+  if (tsRingNext(&logRing, &cursor, &dp)) {
+    writeRow(out, &dp, points - 1);
+  }
+}
+
+/**
+ * @brief Select the buffered points of a history query
+ * 
+ * @param first First point index
+ * @param count Points in the range
+ * @param rows Rows of the response (count, or query->points if downsampled)
+ */
+static void selectHistory(const HistoryQuery* query, uint16_t* first, uint16_t* count, uint16_t* rows) {
+  uint16_t total = tsRingCount(&logRing);
+  uint32_t lower = query->from;
+  if (query->since > 0 && query->since + 1 > lower) lower = query->since + 1;
+  uint32_t upper = query->to ? query->to : 0xFFFFFFFFUL;
+  
+  // Index range of the requested times: [first, end)
+  TsCursor cursor;
+  DataPoint dp;
+  uint16_t end = 0;
+  *first = total;
+  tsRingSeek(&logRing, &cursor, 0);
+  for (uint16_t i = 0; tsRingNext(&logRing, &cursor, &dp); i++) {
+    if (*first == total && dp.timestamp >= lower) *first = i;
+    if (dp.timestamp <= upper) end = i + 1;
+  }
+  *count = (*first < end) ? end - *first : 0;
+  
+  // Newest points only
+  if (query->limit > 0 && *count > query->limit) {
+    *first = end - query->limit;
+    *count = query->limit;
+  }
+  *rows = (query->points >= 3 && *count > query->points) ? query->points : *count;
+}
+
+/**
+ * @brief Write the rows selected by selectHistory()
+ */
+static void writeHistoryRows(Print& out, HistoryRowWriter writeRow, const HistoryQuery* query,
+                             uint16_t first, uint16_t count, uint16_t rows) {
+  if (rows < count) {
+    printDownsampled(out, writeRow, first, count, rows, query->channel);
+    return;
+  }
+  
+  TsCursor cursor;
+  DataPoint dp;
+  tsRingSeek(&logRing, &cursor, first);
+  for (uint16_t i = 0; i < count && tsRingNext(&logRing, &cursor, &dp); i++) {
+    writeRow(out, &dp, i);
+  }
+}
+
+/**
+ * @struct LiveSnapshot
+ * @brief Values of a live message, captured once for both passes
+ */
+struct LiveSnapshot {
+  DateTime now;
+  unsigned long uptime;
+  uint16_t bufferCount;
+  uint16_t bufferMax;
+  int16_t channels[SENSOR_CHANNEL_COUNT];   ///< Interval mean
+  int16_t min[SENSOR_CHANNEL_COUNT];        ///< Interval minimum
+  int16_t max[SENSOR_CHANNEL_COUNT];        ///< Interval maximum
+};
+
+/**
+ * @brief Serialize the live sensor message (MQTT_TOPIC_DATA)
+ */
+static void writeLiveJSON(Print& out, const void* context) {
+  const LiveSnapshot* live = (const LiveSnapshot*)context;
+  char timestamp[32];
+  snprintf(timestamp, sizeof(timestamp), "%04d-%02d-%02dT%02d:%02d:%02dZ",
+    live->now.year(), live->now.month(), live->now.day(),
+    live->now.hour(), live->now.minute(), live->now.second());
+  
+  JsonWriter json(out);
+  json.beginObject();
+  json.key("timestamp").string(timestamp);
+  json.key("uptime").number(live->uptime);
+  
+  json.key("indoor").beginObject();
+  json.key("temperature").number(indoorData.temperature, 1);
+  json.key("humidity").number(indoorData.humidity, 1);
+  json.key("dewPoint").number(indoorData.dewPoint, 1);
+  json.key("humidex").number(indoorData.humidex);
+  json.endObject();
+  
+  json.key("outdoor").beginObject();
+  json.key("temperature").number(outdoorData.temperature, 1);
+  json.key("humidity").number(outdoorData.humidity, 1);
+  json.key("dewPoint").number(outdoorData.dewPoint, 1);
+  json.endObject();
+  
+  json.key("airQuality").beginObject();
+  json.key("aqi").number(airQuality.estimatedAQI);
+  json.key("ppm").number(airQuality.ppm);
+  json.key("raw").number(airQuality.rawADC);
+  json.key("quality").string(airQuality.quality);
+  json.endObject();
+  
+  json.key("system").beginObject();
+  json.key("bufferCount").number(live->bufferCount);
+  json.key("bufferMax").number(live->bufferMax);
+  json.endObject();
+  
+  printChannelsJSON(json.key("channels").raw(), live->channels);
+  printChannelsJSON(json.key("min").raw(), live->min);
+  printChannelsJSON(json.key("max").raw(), live->max);
+  json.endObject();
+}
+
+/**
+ * @brief Current reading of a channel (SENSOR_VALUE_INVALID if invalid)
+ */
+static inline int16_t currentValue(uint8_t ch) {
+  return sensorChannels[ch].valid ? sensorChannels[ch].value : SENSOR_VALUE_INVALID;
+}
+
+/**
+ * @brief Value a point stores for a channel: mean of an interval
+ * 
+ * Falls back to the current reading if the channel was not updated
+ * during the interval.
+ */
+static int16_t meanOrCurrent(const RollupAccumulator* interval, uint8_t ch) {
+  if (interval->count[ch] > 0) return rollupMean(interval, ch);
+  return currentValue(ch);
+}
+
+/**
+ * @brief Logged value of a channel: mean of the last log interval
+ */
+static inline int16_t intervalValue(uint8_t ch) {
+  return meanOrCurrent(&loggedInterval, ch);
+}
+
+/**
+ * @brief Check whether the current log interval must produce a point
+ * 
+ * Compares the mean of the log interval that just ended with the value
+ * stored by the last point (also a mean): a single spike does not log a
+ * point, and a step is seen at the end of its interval however many
+ * intervals were skipped before it.
+ * 
+ * @param heartbeat Set to true if only the heartbeat triggered
+ * @return true if a channel moved more than its deadband or changed
+ *         validity since the last point, or the heartbeat expired
+ */
+static bool deadbandTriggered(unsigned long currentMillis, bool* heartbeat) {
+  *heartbeat = false;
+#if DATALOG_DEADBAND_ENABLED
+  if (!deadbandArmed) return true;
+  
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    int16_t value = meanOrCurrent(&checkStats, ch);
+    int16_t ref = deadbandRef[ch];
+    if ((value == SENSOR_VALUE_INVALID) != (ref == SENSOR_VALUE_INVALID)) return true;
+    if (value != SENSOR_VALUE_INVALID && abs((int32_t)value - ref) > sensorChannels[ch].deadband) {
+      return true;
+    }
+  }
+  
+  *heartbeat = (currentMillis - lastPointTime >= DATALOG_HEARTBEAT_INTERVAL);
+  return *heartbeat;
+#else
+  return true;
+#endif
+}
+
+/**
+ * @brief Take the logged point as the new deadband reference
+ */
+static void setDeadbandReference() {
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    deadbandRef[ch] = intervalValue(ch);
+  }
+  lastPointTime = millis();
+  deadbandArmed = true;
+}
+
+#if MQTT_BUFFER_BINARY
+/**
+ * @brief Pack the oldest buffered points as a binary chunk (schema v1)
+ * 
+ * Packs as many points as fit in size bytes (worst-case record size
+ * reserved), stopping early at a timestamp jump that needs a keyframe.
+ * 
+ * @param packed Number of points packed
+ * @return Payload length
+ */
+static uint16_t packBufferChunkBinary(uint8_t* payload, uint16_t size, uint16_t* packed) {
+  TsCursor cursor;
+  TsCodecState state;
+  DataPoint dp;
+  uint8_t* out = payload;
+  
+  *packed = 0;
+  if (!tsRingSeek(&logRing, &cursor, 0) || !tsRingNext(&logRing, &cursor, &dp)) {
+    return 0;
+  }
+  
+  // Header (count patched at the end) and raw first point
+  *out++ = MQTT_BINARY_VERSION;
+  *out++ = SENSOR_CHANNEL_COUNT;
+  out += 2;
+  out = putLE(out, dp.timestamp, 4);
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    out = putLE(out, (uint16_t)dp.values[ch], 2);
+  }
+  tsCodecStart(&state, &dp);
+  uint16_t count = 1;
+  
+  // Delta records
+  while (out + TSRING_MAX_RECORD <= payload + size && tsRingNext(&logRing, &cursor, &dp)) {
+    uint8_t len = tsCodecEncode(&state, &dp, out);
+    if (len == 0) break;
+    out += len;
+    count++;
+  }
+  
+  putLE(payload + 2, count, 2);
+  *packed = count;
+  return out - payload;
+}
+#else
+/**
+ * @brief Serialize the oldest buffered points as a JSON chunk
+ * 
+ * {"count":N,"data":[{"ts":...,"tIn":...},...]}
+ * 
+ * @param context Number of points (uint16_t)
+ */
+static void writeBufferChunkJSON(Print& out, const void* context) {
+  uint16_t count = *(const uint16_t*)context;
+  TsCursor cursor;
+  DataPoint dp;
+  
+  JsonWriter json(out);
+  json.beginObject();
+  json.key("count").number(count);
+  json.key("data").beginArray();
+  
+  // Oldest data first
+  tsRingSeek(&logRing, &cursor, 0);
+  for (uint16_t i = 0; i < count && tsRingNext(&logRing, &cursor, &dp); i++) {
+    writeDataPointJSON(json, &dp);
+  }
+  
+  json.endArray();
+  json.endObject();
+}
+#endif
 
 // ==========================================
 // FUNCTION IMPLEMENTATIONS
 // ==========================================
-void initDataLog(WiFiClient& wifiClient) {
+void initDataLog(WiFiClient&) {
   DEBUG_PRINTLN("Initializing data logging system...");
   
   DEBUG_PRINTLN("Using global WiFi client for MQTT");
@@ -48,8 +480,8 @@ void initDataLog(WiFiClient& wifiClient) {
   mqttClient.setClient(mqttWifiClient);
   mqttClient.setServer(mqttServer, atoi(mqttPort));
 
-  mqttClient.setBufferSize(512);
-  DEBUG_PRINTLN("MQTT buffer size set to 512 bytes");
+  mqttClient.setBufferSize(640);
+  DEBUG_PRINTLN("MQTT buffer size set to 640 bytes");
   
   // Réduire les timeouts
   mqttClient.setSocketTimeout(2);
@@ -60,23 +492,38 @@ void initDataLog(WiFiClient& wifiClient) {
   DEBUG_PRINT(":");
   DEBUG_PRINTLN(mqttPort);
   
-  // Initialize buffer
-  bufferWriteIndex = 0;
-  bufferCount = 0;
+  // Initialize buffer, restore unsent points from data flash
+  tsRingClear(&logRing);
+  initHistory(&logRing);
   
   // Reset statistics
-  logStats.bufferCount = 0;
+  logStats.bufferCount = tsRingCount(&logRing);
+  logStats.bufferMax = tsRingCapacity(&logRing);
+  logStats.bufferBytes = 0;
+  logStats.bufferEvicted = 0;
   logStats.totalLogged = 0;
   logStats.totalSent = 0;
+  logStats.deadbandSkipped = 0;
+  logStats.heartbeatLogged = 0;
   logStats.lastLogTime = 0;
   logStats.lastSendTime = 0;
+  logStats.drainInterval = MQTT_DRAIN_INTERVAL_MIN;
   logStats.mqttConnected = false;
   
+  // Start the first log interval with the next readings
+  rollupReset(&intervalStats);
+  rollupReset(&checkStats);
+  rollupReset(&loggedInterval);
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    intervalFed[ch] = sensorChannels[ch].lastUpdate;
+  }
+  deadbandArmed = false;
+  
   DEBUG_PRINT("Data buffer initialized: ");
-  DEBUG_PRINT(MAX_DATA_POINTS);
-  DEBUG_PRINT(" points (");
-  DEBUG_PRINT(sizeof(dataBuffer) / 1024);
-  DEBUG_PRINTLN(" KB)");
+  DEBUG_PRINT(TSRING_BYTES / 1024);
+  DEBUG_PRINT(" KB compressed ring (");
+  DEBUG_PRINT(tsRingCapacity(&logRing));
+  DEBUG_PRINTLN(" points minimum)");
   
   if (wifiConnected()) {
     DEBUG_PRINTLN("MQTT will connect in background...");
@@ -91,6 +538,9 @@ void initDataLog(WiFiClient& wifiClient) {
 void handleDataLog() {
   unsigned long currentMillis = millis();
   
+  // Accumulate every new reading into the current log interval
+  rollupAddNewReadings(&checkStats, intervalFed);
+  
 #if DEBUG_MODE
   static unsigned long lastDebugLog = 0;
   if (currentMillis - lastDebugLog >= 10000) {
@@ -147,13 +597,14 @@ void handleDataLog() {
             DEBUG_PRINTLN("Warning: Failed to publish status");
           }
           
-          // Send buffered data if any
-          if (bufferCount > 0) {
-            DEBUG_PRINT("Sending ");
-            DEBUG_PRINT(bufferCount);
+          // Buffered data is drained from the loop, one chunk at a time
+          if (tsRingCount(&logRing) > 0) {
+            DEBUG_PRINT("Draining ");
+            DEBUG_PRINT(tsRingCount(&logRing));
             DEBUG_PRINTLN(" buffered points...");
-            sendBufferToMQTT();
           }
+          drainInterval = MQTT_DRAIN_INTERVAL_MIN;
+          lastDrainTime = currentMillis;
         } else {
           DEBUG_PRINT(" (");
           DEBUG_PRINT(elapsed);
@@ -168,6 +619,17 @@ void handleDataLog() {
       if (mqttClient.connected()) {
         mqttClient.loop();  // Keep MQTT connection alive
       }
+      
+      // Drain buffered points: at most one chunk per call, faster while
+      // publishes succeed, backing off when they fail
+      if (tsRingCount(&logRing) > 0 && currentMillis - lastDrainTime >= drainInterval) {
+        lastDrainTime = currentMillis;
+        if (sendBufferToMQTT()) {
+          drainInterval = max(drainInterval / 2, (unsigned long)MQTT_DRAIN_INTERVAL_MIN);
+        } else {
+          drainInterval = min(drainInterval * 2, (unsigned long)MQTT_DRAIN_INTERVAL_MAX);
+        }
+      }
     }
   } else {
     logStats.mqttConnected = false;
@@ -178,17 +640,45 @@ void handleDataLog() {
                               DATALOG_INTERVAL_WIFI_OK : 
                               DATALOG_INTERVAL_WIFI_DOWN;
   
-  // Log data point if interval elapsed
+  // Log data point if interval elapsed and values moved (or heartbeat);
+  // otherwise the interval keeps accumulating into the next point
   if (currentMillis - lastLogTime >= logInterval) {
     lastLogTime = currentMillis;
-    logDataPoint();
+    bool heartbeat;
+    bool triggered = deadbandTriggered(currentMillis, &heartbeat);
+    
+    // The interval joins the next point, logged now or later
+    rollupMerge(&intervalStats, &checkStats);
+    rollupReset(&checkStats);
+    
+    if (triggered) {
+      if (logDataPoint() && heartbeat) {
+        logStats.heartbeatLogged++;
+      }
+    } else {
+      logStats.deadbandSkipped++;
+    }
+  }
+  
+  // Publish sensor health telemetry
+  if (mqttClient.connected() && currentMillis - lastHealthTime >= MQTT_HEALTH_INTERVAL) {
+    lastHealthTime = currentMillis;
+    sendHealthToMQTT();
   }
 }
 
 bool logDataPoint() {
-  // Validate sensor data
-  if (!indoorData.valid || !outdoorData.valid || !airQuality.valid) {
-    DEBUG_PRINTLN("WARNING: Invalid sensor data, skipping log");
+  // Close the log interval: the point carries its mean (min/max on MQTT)
+  loggedInterval = intervalStats;
+  rollupReset(&intervalStats);
+  
+  // Validate sensor data: a failed sensor only blanks its own channels
+  bool anyValid = false;
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    anyValid |= (intervalValue(ch) != SENSOR_VALUE_INVALID);
+  }
+  if (!anyValid) {
+    DEBUG_PRINTLN("WARNING: No valid sensor data, skipping log");
     return false;
   }
   
@@ -203,6 +693,7 @@ bool logDataPoint() {
       logStats.totalSent++;
       logStats.lastLogTime = millis();
       logStats.lastSendTime = millis();
+      setDeadbandReference();
       
       DEBUG_PRINTLN("Data sent directly via MQTT (no buffering)");
       return true;
@@ -215,30 +706,29 @@ bool logDataPoint() {
   // WiFi down or MQTT failed: store in buffer
   DataPoint dp;
   dp.timestamp = now.unixtime();
-  dp.tempIn = (int16_t)(indoorData.temperature * 10);
-  dp.humIn = (uint16_t)(indoorData.humidity * 10);
-  dp.tempOut = (int16_t)(outdoorData.temperature * 10);
-  dp.humOut = (uint16_t)(outdoorData.humidity * 10);
-  dp.aqi = airQuality.estimatedAQI;
-  
-  // Add to circular buffer
-  dataBuffer[bufferWriteIndex] = dp;
-  bufferWriteIndex = (bufferWriteIndex + 1) % MAX_DATA_POINTS;
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    dp.values[ch] = intervalValue(ch);
+  }
   
-  if (bufferCount < MAX_DATA_POINTS) {
-    bufferCount++;
+  // Add to compressed ring (evicts the oldest block when full),
+  // write the block it closed to data flash
+  if (tsRingAppend(&logRing, &dp)) {
+    historyPersistClosedBlock(&logRing);
   }
   
   // Update statistics
-  logStats.bufferCount = bufferCount;
+  logStats.bufferCount = tsRingCount(&logRing);
   logStats.totalLogged++;
   logStats.lastLogTime = millis();
+  setDeadbandReference();
   
   DEBUG_PRINT("Data buffered [");
-  DEBUG_PRINT(bufferCount);
+  DEBUG_PRINT(tsRingCount(&logRing));
+  DEBUG_PRINT(" points, ");
+  DEBUG_PRINT(tsRingBytesUsed(&logRing));
   DEBUG_PRINT("/");
-  DEBUG_PRINT(MAX_DATA_POINTS);
-  DEBUG_PRINTLN("]");
+  DEBUG_PRINT(TSRING_BYTES);
+  DEBUG_PRINTLN(" bytes]");
   
   return true;
 }
@@ -248,74 +738,21 @@ bool sendMQTTData() {
     return false;
   }
   
-  DateTime now = getCurrentTime();
-  
-  // ✅ Use static buffer instead of String (reduced to 384 bytes)
-  char json[384];  // Reduced from 512
-  
-  // Build entire JSON in one snprintf call (no heap allocations)
-  int len = snprintf(json, sizeof(json),
-    "{"
-    "\"timestamp\":\"%04d-%02d-%02dT%02d:%02d:%02dZ\","
-    "\"uptime\":%lu,"
-    "\"indoor\":{"
-      "\"temperature\":%.1f,"
-      "\"humidity\":%.1f,"
-      "\"dewPoint\":%.1f,"
-      "\"humidex\":%d"
-    "},"
-    "\"outdoor\":{"
-      "\"temperature\":%.1f,"
-      "\"humidity\":%.1f,"
-      "\"dewPoint\":%.1f"
-    "},"
-    "\"airQuality\":{"
-      "\"aqi\":%d,"
-      "\"raw\":%d,"
-      "\"quality\":\"%s\""
-    "},"
-    "\"system\":{"
-      "\"bufferCount\":%d,"
-      "\"bufferMax\":%d"
-    "}"
-    "}",
-    // Timestamp
-    now.year(), now.month(), now.day(),
-    now.hour(), now.minute(), now.second(),
-    // Uptime
-    millis() / 1000,
-    // Indoor data
-    indoorData.temperature,
-    indoorData.humidity,
-    indoorData.dewPoint,
-    indoorData.humidex,
-    // Outdoor data
-    outdoorData.temperature,
-    outdoorData.humidity,
-    outdoorData.dewPoint,
-    // Air quality
-    airQuality.estimatedAQI,
-    airQuality.rawADC,
-    airQuality.quality,
-    // System info
-    bufferCount,
-    MAX_DATA_POINTS
-  );
-  
-  // Check for buffer overflow
-  if (len >= sizeof(json)) {
-    DEBUG_PRINTLN("ERROR: JSON buffer overflow!");
-    return false;
+  // Capture values once: the payload is serialized twice
+  LiveSnapshot live;
+  live.now = getCurrentTime();
+  live.uptime = millis() / 1000;
+  live.bufferCount = tsRingCount(&logRing);
+  live.bufferMax = tsRingCapacity(&logRing);
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    bool sampled = loggedInterval.count[ch] > 0;
+    live.channels[ch] = intervalValue(ch);
+    live.min[ch] = sampled ? loggedInterval.min[ch] : live.channels[ch];
+    live.max[ch] = sampled ? loggedInterval.max[ch] : live.channels[ch];
   }
   
-  // Set flag before publish to prevent I2C conflicts
-  mqttBusy = true;
-  
-  // Publish to MQTT
-  bool success = mqttClient.publish(MQTT_TOPIC_DATA, json);
-  
-  // Clear flag after publish
-  mqttBusy = false;
+  // Stream straight into the MQTT client (no staging buffer)
+  bool success = publishStream(MQTT_TOPIC_DATA, writeLiveJSON, &live, false);
   
   if (success) {
     DEBUG_PRINTLN("MQTT data published successfully");
@@ -327,167 +764,135 @@ bool sendMQTTData() {
 }
 
 bool sendBufferToMQTT() {
+  uint16_t bufferCount = tsRingCount(&logRing);
   if (!mqttClient.connected() || bufferCount == 0) {
     return false;
   }
   
-  DEBUG_PRINT("Sending ");
-  DEBUG_PRINT(bufferCount);
-  DEBUG_PRINTLN(" buffered points via MQTT...");
+  uint16_t packed = 0;
+  bool success;
   
-  uint16_t sent = 0;
-  uint16_t readIndex = 0;
+#if MQTT_BUFFER_BINARY
+  uint8_t payload[MQTT_BINARY_CHUNK_BYTES];
+  uint16_t len = packBufferChunkBinary(payload, sizeof(payload), &packed);
   
-  // Determine start index for circular buffer
-  if (bufferCount == MAX_DATA_POINTS) {
-    // Buffer is full, start from write index (oldest data)
-    readIndex = bufferWriteIndex;
-  } else {
-    // Buffer not full, start from beginning
-    readIndex = 0;
-  }
+  // Set flag before publish to prevent I2C conflicts
+  mqttBusy = true;
+  success = mqttClient.publish(MQTT_TOPIC_BUFFER_BIN, payload, len);
+  mqttBusy = false;
+#else
+  packed = (bufferCount < MQTT_CHUNK_SIZE) ? bufferCount : MQTT_CHUNK_SIZE;
+  success = publishStream(MQTT_TOPIC_BUFFER, writeBufferChunkJSON, &packed, false);
+#endif
   
-  // Send in chunks
-  while (sent < bufferCount) {
-    uint16_t remaining = bufferCount - sent;
-    uint16_t toSend = (remaining < MQTT_CHUNK_SIZE) ? remaining : MQTT_CHUNK_SIZE;
-    
-    // ✅ Use static buffer (prevent memory fragmentation)
-    char json[384];  // Reduced from 512
-    int pos = 0;
-    
-    // Build JSON header
-    pos += snprintf(json + pos, sizeof(json) - pos, "{\"count\":%d,\"data\":[", toSend);
-    
-    // Add data points
-    for (uint16_t i = 0; i < toSend; i++) {
-      DataPoint* dp = &dataBuffer[readIndex];
-      
-      if (i > 0) {
-        pos += snprintf(json + pos, sizeof(json) - pos, ",");
-      }
-      
-      pos += snprintf(json + pos, sizeof(json) - pos,
-        "{\"ts\":%lu,\"tIn\":%.1f,\"hIn\":%.1f,\"tOut\":%.1f,\"hOut\":%.1f,\"aqi\":%d}",
-        dp->timestamp,
-        dp->tempIn / 10.0,
-        dp->humIn / 10.0,
-        dp->tempOut / 10.0,
-        dp->humOut / 10.0,
-        dp->aqi
-      );
-      
-      readIndex = (readIndex + 1) % MAX_DATA_POINTS;
-      
-      // Safety: prevent buffer overflow
-      if (pos >= sizeof(json) - 20) {
-        DEBUG_PRINTLN("WARNING: Buffer chunk too large, sending partial");
-        break;
-      }
-    }
-    
-    // Close JSON
-    pos += snprintf(json + pos, sizeof(json) - pos, "]}");
-    
-    // Publish chunk
-    bool success = mqttClient.publish(MQTT_TOPIC_BUFFER, json);
-    
-    if (success) {
-      sent += toSend;
-      logStats.totalSent += toSend;
-      
-      DEBUG_PRINT("Sent chunk: ");
-      DEBUG_PRINT(sent);
-      DEBUG_PRINT("/");
-      DEBUG_PRINTLN(bufferCount);
-      
-      // Small delay between chunks
-      delay(100);
-      mqttClient.loop();  // Keep connection alive
-    } else {
-      DEBUG_PRINTLN("Buffer send failed");
-      return false;
-    }
+  if (!success) {
+    DEBUG_PRINTLN("Buffer chunk send failed, will retry");
+    return false;
   }
   
-  // Clear buffer after successful transmission
-  clearBuffer();
+  // Advance only after a successful publish (persisted per block)
+  tsRingConsume(&logRing, packed);
+  historyRelease(&logRing);
   
-  DEBUG_PRINTLN("Buffer transmission complete");
+  logStats.totalSent += packed;
+  logStats.bufferCount = tsRingCount(&logRing);
   logStats.lastSendTime = millis();
   
+  DEBUG_PRINT("Sent chunk: ");
+  DEBUG_PRINT(packed);
+  DEBUG_PRINT(" points, ");
+  DEBUG_PRINT(tsRingCount(&logRing));
+  DEBUG_PRINTLN(" left");
+  
+  if (tsRingCount(&logRing) == 0) {
+    DEBUG_PRINTLN("Buffer transmission complete");
+  }
+  
   return true;
 }
 
-DataLogStats getLogStats() {
-  logStats.bufferCount = bufferCount;
-  logStats.mqttConnected = mqttClient.connected();
-  return logStats;
-}
-
-const char* getBufferJSON(uint16_t count) {
-  // ✅ Static buffer (reused, no heap allocation) - reduced size
-  static char json[768];  // Reduced from 1024 (still larger for web response)
-  int pos = 0;
-  
-  // Limit count for memory safety
-  if (count > bufferCount) count = bufferCount;
-  if (count > 20) count = 20;  // Reduced from 100 for safety
+bool sendHealthToMQTT() {
+  if (!mqttClient.connected()) {
+    return false;
+  }
   
-  // JSON header
-  pos += snprintf(json + pos, sizeof(json) - pos,
-    "{\"count\":%d,\"bufferTotal\":%d,\"data\":[",
-    count, bufferCount
-  );
+  char topic[48];
+  char json[352];
+  bool success = true;
   
-  if (count == 0) {
-    pos += snprintf(json + pos, sizeof(json) - pos, "]}");
-    return json;
+  // One retained message per sensor: home/clock/health/<name>
+  for (uint8_t i = 0; i < getSensorCount(); i++) {
+    if (formatSensorHealthJSON(i, json, sizeof(json)) == 0) {
+      DEBUG_PRINTLN("ERROR: Health JSON buffer overflow!");
+      success = false;
+      continue;
+    }
+    snprintf(topic, sizeof(topic), "%s/%s", MQTT_TOPIC_HEALTH, getSensorSlot(i)->name);
+    
+    mqttBusy = true;
+    success &= mqttClient.publish(topic, json, true);
+    mqttBusy = false;
   }
   
-  // Determine start index (get most recent data)
-  uint16_t startIndex;
-  if (bufferCount < MAX_DATA_POINTS) {
-    startIndex = (bufferCount >= count) ? (bufferCount - count) : 0;
+  if (success) {
+    DEBUG_PRINTLN("MQTT health published successfully");
   } else {
-    startIndex = (bufferWriteIndex + MAX_DATA_POINTS - count) % MAX_DATA_POINTS;
+    DEBUG_PRINTLN("MQTT health publish failed");
   }
   
-  // Build JSON array
-  for (uint16_t i = 0; i < count; i++) {
-    uint16_t idx = (startIndex + i) % MAX_DATA_POINTS;
-    DataPoint* dp = &dataBuffer[idx];
-    
-    if (i > 0) {
-      pos += snprintf(json + pos, sizeof(json) - pos, ",");
-    }
-    
-    pos += snprintf(json + pos, sizeof(json) - pos,
-      "{\"ts\":%lu,\"tIn\":%.1f,\"hIn\":%.1f,\"tOut\":%.1f,\"hOut\":%.1f,\"aqi\":%d}",
-      dp->timestamp,
-      dp->tempIn / 10.0,
-      dp->humIn / 10.0,
-      dp->tempOut / 10.0,
-      dp->humOut / 10.0,
-      dp->aqi
-    );
-    
-    // Safety check
-    if (pos >= sizeof(json) - 50) {
-      DEBUG_PRINTLN("WARNING: JSON buffer near limit");
-      break;
-    }
+  return success;
+}
+
+DataLogStats getLogStats() {
+  logStats.bufferCount = tsRingCount(&logRing);
+  logStats.bufferMax = tsRingCapacity(&logRing);
+  logStats.bufferBytes = tsRingBytesUsed(&logRing);
+  logStats.bufferEvicted = logRing.evicted;
+  logStats.drainInterval = drainInterval;
+  logStats.mqttConnected = mqttClient.connected();
+  return logStats;
+}
+
+void printHistoryJSON(Print& out, const HistoryQuery* query) {
+  uint16_t first, count, rows;
+  selectHistory(query, &first, &count, &rows);
+  
+  JsonWriter json(out);
+  json.beginObject();
+  json.key("count").number(rows);
+  json.key("bufferTotal").number(tsRingCount(&logRing));
+  json.key("data").beginArray();
+  // Rows place their own commas (the writer is shared with the binary format)
+  writeHistoryRows(out, writeHistoryRowJSON, query, first, count, rows);
+  json.endArray();
+  json.endObject();
+}
+
+void printHistoryBinary(Print& out, const HistoryQuery* query) {
+  uint16_t first, count, rows;
+  selectHistory(query, &first, &count, &rows);
+  
+  // Header: schema, then one descriptor per channel
+  uint8_t header[HISTORY_BIN_HEADER_SIZE];
+  uint8_t* p = header;
+  *p++ = HISTORY_BIN_VERSION;
+  *p++ = SENSOR_CHANNEL_COUNT;
+  p = putLE(p, rows, 2);
+  p = putLE(p, HISTORY_BIN_RECORD_SIZE, 2);
+  p = putLE(p, tsRingCount(&logRing), 2);
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    *p++ = sensorChannels[ch].decimals;
+    strncpy((char*)p, sensorChannels[ch].key, HISTORY_BIN_KEY_SIZE);
+    p += HISTORY_BIN_KEY_SIZE;
   }
+  out.write(header, sizeof(header));
   
-  // Close JSON
-  pos += snprintf(json + pos, sizeof(json) - pos, "]}");
-  
-  return json;
+  writeHistoryRows(out, writeHistoryRowBinary, query, first, count, rows);
 }
 
 void clearBuffer() {
-  bufferWriteIndex = 0;
-  bufferCount = 0;
+  tsRingClear(&logRing);
+  historyRelease(&logRing);
   logStats.bufferCount = 0;
   
   DEBUG_PRINTLN("Data buffer cleared");
@@ -4,10 +4,23 @@
  * 
  * Manages sensor data logging with intelligent buffering:
  * - WiFi OK: Send immediately every 2 minutes (no local storage)
- * - WiFi DOWN: Store in RAM buffer every 5 minutes (48h capacity)
- * - WiFi RESTORED: Send buffered data to MQTT
+ * - WiFi DOWN: Store in RAM buffer every 5 minutes
+ * - WiFi RESTORED: Drain buffered data to MQTT, one chunk per loop pass
  * 
- * Memory usage: ~8 KB RAM for 576 data points (48h at 5min interval)
+ * The buffer is a delta-compressed ring (tsring.h): 8 KB RAM hold
+ * ~1000 points at 5min interval (3-4 days), depending on how much the
+ * readings move. Closed ring blocks are written to data flash
+ * (history.h) and restored after a reboot until they are sent.
+ * 
+ * Every sensor reading is accumulated (count/sum/min/max per channel,
+ * constant memory) between two logged points: a point holds the mean of
+ * its interval, the live MQTT message also carries the min and max.
+ * 
+ * Deadband logging: at each interval a point is only logged when a
+ * channel's mean over that interval moved more than its deadband
+ * (SensorChannel::deadband) from the value of the last point, or
+ * changed validity, or DATALOG_HEARTBEAT_INTERVAL expired. Skipped
+ * intervals are merged into the next point's mean.
  * 
  * @author F. Baillon
  * @version 1.1.0
@@ -25,6 +38,10 @@
 #include <WiFiS3.h>
 #include "config.h"
 #include "rtc.h"
+#include "sensors.h"
+#include "tsring.h"
+#include "history.h"
+#include "rollup.h"
 
 
 // ==========================================
@@ -36,39 +53,78 @@
  */
 #define DATALOG_INTERVAL_WIFI_OK    120000  ///< 2 minutes when WiFi connected
 #define DATALOG_INTERVAL_WIFI_DOWN  300000  ///< 5 minutes when WiFi down
-#define MQTT_RETRY_INTERVAL         600000  ///< Retry MQTT connection every 10 min
+#ifndef MQTT_RETRY_INTERVAL
+#define MQTT_RETRY_INTERVAL         600000  ///< Retry MQTT connection every 10 min (config.h overrides)
+#endif
+#define MQTT_HEALTH_INTERVAL        600000  ///< Publish sensor health every 10 min
+#define DATALOG_DEADBAND_ENABLED    true    ///< false: log every interval
+#define DATALOG_HEARTBEAT_INTERVAL  1800000 ///< Max time between points (30 min)
+
+/**
+ * Buffer configuration (ring size: TSRING_BYTES in tsring.h)
+ */
+#define MQTT_CHUNK_SIZE             24      ///< Points per JSON MQTT message (~110 bytes each, streamed)
+#define MQTT_DRAIN_INTERVAL_MIN     250     ///< Min delay between buffer chunks (ms)
+#define MQTT_DRAIN_INTERVAL_MAX     8000    ///< Max delay after failed chunks (ms)
+
+/**
+ * Binary buffer uploads (optional, ~7 bytes per point instead of ~110)
+ * 
+ * Payload schema v1 (little endian), decoded by tools/decode_buffer.py:
+ *   uint8   version (MQTT_BINARY_VERSION)
+ *   uint8   channel count (SENSOR_CHANNEL_COUNT, order of config.h)
+ *   uint16  point count
+ *   uint32  timestamp + int16 × channels    first point, raw values
+ *   records (tsring.h format)               following points
+ * 
+ * Missing values are SENSOR_VALUE_INVALID (-32768) in the first point
+ * and absent from the validity mask in records.
+ */
+#ifndef MQTT_BUFFER_BINARY
+#define MQTT_BUFFER_BINARY          false   ///< true: send buffer on MQTT_TOPIC_BUFFER_BIN
+#endif
+#define MQTT_BINARY_VERSION         1       ///< Payload schema version
+#define MQTT_BINARY_CHUNK_BYTES     512     ///< Max binary payload (~70 points)
 
 /**
- * Buffer configuration
+ * Binary history (/api/history.bin), little endian:
+ *   uint8   version (HISTORY_BIN_VERSION)
+ *   uint8   channel count N
+ *   uint16  record count
+ *   uint16  record size (4 + 2 × N)
+ *   uint16  points in the whole buffer
+ *   N × { uint8 decimals, char key[HISTORY_BIN_KEY_SIZE] (zero padded) }
+ *   records: uint32 timestamp, int16 × N (SENSOR_VALUE_INVALID = missing)
  */
-#define MAX_DATA_POINTS             200     ///< 16h40 at 5min intervals (8 KB RAM)
-#define MQTT_CHUNK_SIZE             10      ///< Send 10 points per MQTT message
+#define HISTORY_BIN_VERSION         1
+#define HISTORY_BIN_KEY_SIZE        7
+#define HISTORY_BIN_HEADER_SIZE     (8 + SENSOR_CHANNEL_COUNT * (1 + HISTORY_BIN_KEY_SIZE))
+#define HISTORY_BIN_RECORD_SIZE     (4 + 2 * SENSOR_CHANNEL_COUNT)
 
 /**
  * MQTT configuration
  */
 #define MQTT_TOPIC_DATA             "home/clock/sensors"
 #define MQTT_TOPIC_BUFFER           "home/clock/buffer"
+#define MQTT_TOPIC_BUFFER_BIN       "home/clock/buffer/bin"
 #define MQTT_TOPIC_STATUS           "home/clock/status"
+#define MQTT_TOPIC_HEALTH           "home/clock/health"   ///< + "/<sensor name>"
 
 // ==========================================
 // DATA STRUCTURES
 // ==========================================
 
 /**
- * @struct DataPoint
- * @brief Compact sensor data point for buffer storage
- * 
- * Size: 14 bytes per point
- * Total buffer size: 576 points * 14 bytes = 8064 bytes (~8 KB)
+ * @struct HistoryQuery
+ * @brief Selection of buffered points (printHistoryJSON)
  */
-struct DataPoint {
-  uint32_t timestamp;     ///< Unix timestamp (4 bytes)
-  int16_t tempIn;         ///< Indoor temp * 10 (2 bytes, e.g., 21.5°C = 215)
-  uint16_t humIn;         ///< Indoor humidity * 10 (2 bytes)
-  int16_t tempOut;        ///< Outdoor temp * 10 (2 bytes)
-  uint16_t humOut;        ///< Outdoor humidity * 10 (2 bytes)
-  uint16_t aqi;           ///< Air Quality Index (2 bytes)
+struct HistoryQuery {
+  uint32_t since;                 ///< Only points after this time, for incremental refresh (0 = all)
+  uint32_t from;                  ///< First time, inclusive (0 = oldest)
+  uint32_t to;                    ///< Last time, inclusive (0 = newest)
+  uint16_t limit;                 ///< Keep the newest points only (0 = no limit)
+  uint16_t points;                ///< Downsample to this many points (LTTB, 0 = off)
+  uint8_t channel;                ///< Channel whose shape LTTB preserves
 };
 
 /**
@@ -77,10 +133,16 @@ struct DataPoint {
  */
 struct DataLogStats {
   uint16_t bufferCount;           ///< Current number of points in buffer
+  uint16_t bufferMax;             ///< Estimated buffer capacity (points, at current compression)
+  uint16_t bufferBytes;           ///< Bytes used in the compressed buffer
+  uint32_t bufferEvicted;         ///< Oldest points overwritten since boot
   uint16_t totalLogged;           ///< Total points logged since boot
   uint16_t totalSent;             ///< Total points sent via MQTT
+  uint32_t deadbandSkipped;       ///< Intervals not logged (all channels within deadband)
+  uint32_t heartbeatLogged;       ///< Points logged (successfully) only because the heartbeat expired
   unsigned long lastLogTime;      ///< Timestamp of last log
   unsigned long lastSendTime;     ///< Timestamp of last MQTT send
+  unsigned long drainInterval;    ///< Current delay between buffer chunks (ms)
   bool mqttConnected;             ///< MQTT connection status
 };
 
@@ -89,9 +151,7 @@ struct DataLogStats {
 // ==========================================
 
 extern WiFiClient mqttWifiClient;
-extern DataPoint dataBuffer[MAX_DATA_POINTS];
-extern uint16_t bufferWriteIndex;
-extern uint16_t bufferCount;
+extern TsRing logRing;
 extern DataLogStats logStats;
 extern PubSubClient mqttClient;
 
@@ -102,8 +162,9 @@ extern PubSubClient mqttClient;
 /**
  * @brief Initialize data logging system
  * 
- * Sets up MQTT client and initializes buffer.
- * Call once in setup() after WiFi is initialized.
+ * Sets up MQTT client and initializes buffer, restoring unsent
+ * points from the persistent history.
+ * Call once in setup(), whether or not WiFi is connected.
  * 
  * @param wifiClient Reference to WiFiClient for MQTT
  */
@@ -113,9 +174,10 @@ void initDataLog(WiFiClient& wifiClient);
  * @brief Main data logging loop handler
  * 
  * Call this in main loop(). Handles:
- * - Adaptive logging (2min WiFi OK / 5min WiFi DOWN)
+ * - Adaptive logging (2min WiFi OK / 5min WiFi DOWN), deadband filtered
  * - MQTT connection management
- * - Automatic buffer transmission when WiFi restored
+ * - Buffer drain when MQTT is connected (one chunk per call,
+ *   paced by publish success)
  * 
  * Non-blocking, returns immediately if nothing to do.
  */
@@ -128,6 +190,15 @@ void handleDataLog();
  * - WiFi OK: Send immediately via MQTT (no buffer storage)
  * - WiFi DOWN: Store in circular buffer
  * 
+ * Each channel is the mean of the readings taken since the previous
+ * point (the current reading if there was none). Called by
+ * handleDataLog() when the deadband or heartbeat triggers. Channels of a failed
+ * sensor are stored as missing (null in JSON); the point is only
+ * skipped when no channel is valid.
+ * 
+ * Blocking when a buffered point closes a ring block: the block is
+ * written to data flash before returning (see history.h).
+ * 
  * @return true if logged successfully
  */
 bool logDataPoint();
@@ -135,22 +206,38 @@ bool logDataPoint();
 /**
  * @brief Send current sensor data via MQTT
  * 
- * Sends real-time data to MQTT broker.
+ * Sends real-time data to MQTT broker: current readings, plus the
+ * mean ("channels"), "min" and "max" of the last log interval.
  * 
  * @return true if sent successfully
  */
 bool sendMQTTData();
 
 /**
- * @brief Send buffered data to MQTT
+ * @brief Send the oldest buffered chunk to MQTT
  * 
- * Sends all buffered data points in chunks.
- * Called automatically when WiFi is restored.
+ * Publishes the oldest points (MQTT_CHUNK_SIZE points as JSON, or as
+ * many as fit MQTT_BINARY_CHUNK_BYTES with MQTT_BUFFER_BINARY), then
+ * drops them from the buffer. Nothing is dropped if the publish fails, so
+ * the same points are retried and never duplicated by a partial send.
+ * Called by handleDataLog() while MQTT is connected and the buffer is
+ * not empty.
  * 
- * @return true if all data sent successfully
+ * @return true if a chunk was published
  */
 bool sendBufferToMQTT();
 
+/**
+ * @brief Send sensor health telemetry via MQTT
+ * 
+ * Publishes one retained JSON message per registered sensor on
+ * MQTT_TOPIC_HEALTH/<name> (counters, staleness, read durations).
+ * Called every MQTT_HEALTH_INTERVAL by handleDataLog().
+ * 
+ * @return true if all messages were published
+ */
+bool sendHealthToMQTT();
+
 /**
  * @brief Get data logging statistics
  * 
@@ -159,18 +246,39 @@ bool sendBufferToMQTT();
 DataLogStats getLogStats();
 
 /**
- * @brief Get buffer data as JSON
+ * @brief Stream buffered data points as JSON
  * 
- * Returns last N data points from buffer as JSON array.
- * Used for web API endpoint.
+ * Writes {"count":N,"bufferTotal":M,"data":[{"ts":...,"tIn":...},...]}
+ * straight to the client, oldest point first, one row at a time (no
+ * size limit, constant memory). Used for the /api/history endpoint.
+ * 
+ * Only points not yet delivered are in the buffer: while MQTT is up,
+ * points are published directly and the drain empties the buffer, so
+ * the history is empty when online. Continuous trends come from the
+ * rollup tiers (printRollupJSON()).
+ * 
+ * The time range assumes increasing timestamps along the buffer. With
+ * query->points, the range is downsampled with Largest-Triangle-Three-
+ * Buckets on query->channel: the rows are real points, chosen to keep
+ * the shape of that channel.
+ * 
+ * @param out Output: many small prints, give a buffered sink (the web
+ *            response stream), not a bare WiFiClient
+ * @param query Points to send
+ */
+void printHistoryJSON(Print& out, const HistoryQuery* query);
+
+/**
+ * @brief Stream buffered data points as packed binary records
  * 
- * ⚠️ WARNING: Returns pointer to static buffer - copy immediately if needed!
- * The buffer will be overwritten on next call.
+ * Same selection as printHistoryJSON(), in the HISTORY_BIN format:
+ * no text formatting on the MCU, 16 bytes per point instead of ~110.
+ * Used for the /api/history.bin endpoint.
  * 
- * @param count Number of points to retrieve (max 20 for memory safety)
- * @return Pointer to static JSON buffer (valid until next call)
+ * @param out Output (buffered, as for printHistoryJSON())
+ * @param query Points to send
  */
-const char* getBufferJSON(uint16_t count);
+void printHistoryBinary(Print& out, const HistoryQuery* query);
 
 /**
  * @brief Clear all buffered data
@@ -11,6 +11,7 @@
  */
 
 #include "display.h"
+#include "jobs.h"
 
 // ==========================================
 // GLOBAL LCD OBJECT
@@ -54,6 +55,7 @@ void initDisplay() {
  * @brief Update LCD display based on current mode
  * 
  * Routes display update to appropriate mode function:
+ * - Background job running → displayJobProgress()
  * - MODE_TEMP_HUMIDITY → displayTempHumidity()
  * - MODE_FEELS_LIKE → displayFeelsLike()
  * - MODE_HUMIDEX → displayHumidex()
@@ -63,6 +65,22 @@ void initDisplay() {
  * @param now Current DateTime from RTC
  */
 void updateLCDDisplay(DateTime now) {
+  static bool jobShown = false;
+  
+  // A running background job takes the screen
+  const Job* job = getRunningJob();
+  if (job != NULL) {
+    if (!jobShown) forceDisplay = true;
+    jobShown = true;
+    displayJobProgress(getJobLabel(job->type), job->progress);
+    return;
+  }
+  if (jobShown) {
+    jobShown = false;
+    lcd.clear();
+    forceDisplay = true;
+  }
+  
   switch (currentDisplayMode) {
     case MODE_TEMP_HUMIDITY:
       displayTempHumidity(now);
@@ -317,6 +335,55 @@ void displayTempCelcius(float temperature) {
   }
 }
 
+/**
+ * @brief Display the progress of a background job
+ * 
+ * Shown instead of the display mode while a job runs. Only the bar and
+ * the percentage are rewritten as the job advances.
+ * 
+ * Example display:
+ * ```
+ * CALIBRATION LUNE...
+ * 
+ * ████████------------
+ *         42%
+ * ```
+ * 
+ * @param label Job label (line 1)
+ * @param progress Percentage (0-100)
+ */
+void displayJobProgress(const char* label, uint8_t progress) {
+  static const char* lastLabel = NULL;
+  static uint8_t lastProgress = 255;
+  
+  if (forceDisplay || label != lastLabel) {
+    lcd.clear();
+    lcd.setCursor(0, 0);
+    lcd.print(label);
+    lastLabel = label;
+    lastProgress = 255;
+    forceDisplay = false;
+  }
+  
+  if (progress == lastProgress) return;
+  lastProgress = progress;
+  
+  uint8_t filled = (uint16_t)progress * LCD_COLUMNS / 100;
+  lcd.setCursor(0, 2);              // LCD line 3
+  for (uint8_t i = 0; i < LCD_COLUMNS; i++) {
+    if (i < filled) {
+      lcd.write((uint8_t)255);      // Full block (HD44780 ROM)
+    } else {
+      lcd.print("-");
+    }
+  }
+  
+  char text[8];
+  snprintf(text, sizeof(text), "%3u%%", progress);
+  lcd.setCursor((LCD_COLUMNS - 4) / 2, 3);   // LCD line 4
+  lcd.print(text);
+}
+
 /**
  * @brief Display startup message
  * 
@@ -15,6 +15,7 @@
  * - Optimized updates (only refresh changed data)
  * - Custom degree symbol character
  * - Startup messages
+ * - Background job progress (moon calibration, NTP sync)
  * 
  * @author F. Baillon
  * @version 1.1.0
@@ -77,6 +78,13 @@ void displayHumidex(DateTime now);
  */
 void displayTempCelcius(float temperature);
 
+/**
+ * Display the progress of a background job
+ * @param label Job label (line 1)
+ * @param progress Percentage (0-100)
+ */
+void displayJobProgress(const char* label, uint8_t progress);
+
 /**
  * Display startup message
  * @param message Message to display
@@ -0,0 +1,116 @@
+/**
+ * @file filter.cpp
+ * @brief Fixed-point sensor filtering implementation
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#include "filter.h"
+
+// ==========================================
+// PRIVATE HELPER FUNCTIONS
+// ==========================================
+
+/**
+ * @brief Median of the accepted-sample window
+ *
+ * Insertion sort on a stack copy: at most FILTER_MEDIAN_MAX (7) elements,
+ * so this is cheaper than any selection algorithm here.
+ */
+static int16_t windowMedian(const SensorFilter* filter) {
+  int16_t sorted[FILTER_MEDIAN_MAX];
+  uint8_t n = filter->windowCount;
+
+  for (uint8_t i = 0; i < n; i++) {
+    int16_t v = filter->window[i];
+    int8_t j = i - 1;
+    while (j >= 0 && sorted[j] > v) {
+      sorted[j + 1] = sorted[j];
+      j--;
+    }
+    sorted[j + 1] = v;
+  }
+
+  return sorted[n / 2];
+}
+
+/**
+ * @brief Seed the whole chain on a new level
+ */
+static void seedFilter(SensorFilter* filter, int16_t sample) {
+  filter->windowCount = 0;
+  filter->windowHead = 0;
+  filter->rejectRun = 0;
+  filter->ema = (int32_t)sample << 8;
+  filter->output = sample;
+  filter->primed = true;
+}
+
+// ==========================================
+// FUNCTION IMPLEMENTATIONS
+// ==========================================
+
+void initFilter(SensorFilter* filter, const FilterConfig* config) {
+  filter->config = config;
+  filter->rejected = 0;
+  resetFilter(filter);
+}
+
+void resetFilter(SensorFilter* filter) {
+  filter->windowCount = 0;
+  filter->windowHead = 0;
+  filter->rejectRun = 0;
+  filter->primed = false;
+  filter->ema = 0;
+  filter->output = 0;
+}
+
+/**
+ * @brief Feed one raw sample through gate -> median -> EMA
+ *
+ * The gate compares the raw sample against the current filtered output.
+ * A rejected sample leaves the filter untouched and returns the previous
+ * output. After maxRejects consecutive rejections the step is considered
+ * genuine (e.g. a window was opened) and the chain re-seeds on it.
+ */
+int16_t applyFilter(SensorFilter* filter, int16_t sample) {
+  const FilterConfig* cfg = filter->config;
+
+  if (!filter->primed) {
+    seedFilter(filter, sample);
+  } else if (cfg->maxStep > 0 && abs(sample - filter->output) > cfg->maxStep) {
+    filter->rejected++;
+    if (++filter->rejectRun < cfg->maxRejects) {
+      return filter->output;
+    }
+    seedFilter(filter, sample);
+  } else {
+    filter->rejectRun = 0;
+  }
+
+  // Median-of-N stage
+  int16_t value = sample;
+  if (cfg->medianSize > 1) {
+    uint8_t size = min(cfg->medianSize, (uint8_t)FILTER_MEDIAN_MAX);
+    filter->window[filter->windowHead] = sample;
+    filter->windowHead = (filter->windowHead + 1) % size;
+    if (filter->windowCount < size) filter->windowCount++;
+    value = windowMedian(filter);
+  }
+
+  // EMA stage (Q8): ema += (x - ema) / 2^shift
+  if (cfg->emaShift > 0) {
+    filter->ema += (((int32_t)value << 8) - filter->ema) >> cfg->emaShift;
+    value = (int16_t)((filter->ema + 128) >> 8);
+  } else {
+    filter->ema = (int32_t)value << 8;
+  }
+
+  filter->output = value;
+  return value;
+}
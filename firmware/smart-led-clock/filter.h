@@ -0,0 +1,97 @@
+/**
+ * @file filter.h
+ * @brief Fixed-point sensor filtering pipeline
+ *
+ * Per-channel filter chain applied to every raw sensor sample before it
+ * reaches the display, LEDs, MQTT and the data log:
+ *
+ *   raw sample -> rate-of-change gate -> median-of-N -> EMA -> filtered value
+ *
+ * - Rate-of-change gate: rejects isolated spikes whose step from the
+ *   current filtered value exceeds maxStep. If the new level persists for
+ *   maxRejects samples in a row, the filter re-seeds on it (real change).
+ * - Median-of-N: removes remaining single-sample glitches.
+ * - EMA: smooths jitter, alpha = 1 / 2^emaShift (Q8 state, no division).
+ *
+ * All arithmetic is integer, all state is static (no heap). Channel values
+ * use the same scaled units as the data log (temperature/humidity × 10,
+ * raw ADC counts for analog sensors).
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#ifndef FILTER_H
+#define FILTER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ==========================================
+// FILTER CONFIGURATION
+// ==========================================
+#define FILTER_MEDIAN_MAX       7     ///< Largest supported median window
+
+// ==========================================
+// DATA STRUCTURES
+// ==========================================
+
+/**
+ * @struct FilterConfig
+ * @brief Tuning of one filter chain (may be shared by several channels)
+ */
+struct FilterConfig {
+  uint8_t medianSize;      ///< Median window size (1 = bypass, max FILTER_MEDIAN_MAX)
+  uint8_t emaShift;        ///< EMA alpha = 1/2^emaShift (0 = bypass)
+  int16_t maxStep;         ///< Max accepted step per sample, channel units (0 = gate off)
+  uint8_t maxRejects;      ///< Consecutive rejections before re-seeding on the new level
+};
+
+/**
+ * @struct SensorFilter
+ * @brief Runtime state of one filtered channel
+ *
+ * Size: ~32 bytes per channel
+ */
+struct SensorFilter {
+  const FilterConfig* config;          ///< Filter tuning
+  int16_t window[FILTER_MEDIAN_MAX];   ///< Last accepted samples (circular)
+  uint8_t windowCount;                 ///< Samples currently in window
+  uint8_t windowHead;                  ///< Next write position in window
+  uint8_t rejectRun;                   ///< Current run of rejected samples
+  bool primed;                         ///< True once the first sample was accepted
+  int32_t ema;                         ///< EMA state (Q8 fixed point)
+  int16_t output;                      ///< Last filtered value
+  uint16_t rejected;                   ///< Total samples rejected by the gate
+};
+
+// ==========================================
+// FUNCTION DECLARATIONS
+// ==========================================
+
+/**
+ * @brief Initialize a filter channel
+ * @param filter Filter state to initialize
+ * @param config Filter tuning (must outlive the filter)
+ */
+void initFilter(SensorFilter* filter, const FilterConfig* config);
+
+/**
+ * @brief Clear filter history (next sample re-seeds the chain)
+ * @param filter Filter state
+ */
+void resetFilter(SensorFilter* filter);
+
+/**
+ * @brief Feed one raw sample through the filter chain
+ * @param filter Filter state
+ * @param sample Raw sample in channel units
+ * @return Filtered value in channel units
+ */
+int16_t applyFilter(SensorFilter* filter, int16_t sample);
+
+#endif // FILTER_H
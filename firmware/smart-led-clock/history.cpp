@@ -0,0 +1,322 @@
+/**
+ * @file history.cpp
+ * @brief Persistent data log history implementation
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#include "history.h"
+#include "datalog.h"
+#include "storage.h"
+
+// ==========================================
+// PRIVATE VARIABLES
+// ==========================================
+
+static HistoryPageHeader pages[HISTORY_PAGES];  // RAM copy of page headers
+static uint8_t headPage = HISTORY_PAGES - 1;    // Page being filled
+static uint8_t headFill = HISTORY_SLOTS;        // Records in head page
+static uint32_t nextSeq = 1;                    // Sequence number of next record
+static uint32_t deliveredSeq = 0;               // Saved history cursor
+static uint32_t blockSeq[TSRING_BLOCKS];        // Record of each ring block (0 = not stored)
+static const TsRing* historyRing = NULL;
+static HistoryStats historyStats = {0, 0, 0, 0, 0, 0, 0, 0};
+
+// ==========================================
+// PRIVATE HELPER FUNCTIONS
+// ==========================================
+
+static inline int pageAddr(uint8_t page) {
+  return EEPROM_HISTORY_ADDR + page * HISTORY_PAGE_SIZE;
+}
+
+static inline int recordAddr(uint8_t page, uint8_t slot) {
+  return pageAddr(page) + sizeof(HistoryPageHeader) + slot * HISTORY_RECORD_SIZE;
+}
+
+/**
+ * @brief Checksum of page header (sum of all bytes except checksum)
+ */
+static uint16_t calculatePageChecksum(const HistoryPageHeader* header) {
+  HistoryPageHeader copy = *header;
+  copy.checksum = 0;
+  uint16_t sum = 0;
+  const uint8_t* data = (const uint8_t*)&copy;
+  for (size_t i = 0; i < sizeof(HistoryPageHeader); i++) {
+    sum += data[i];
+  }
+  return sum;
+}
+
+static inline bool isPageValid(const HistoryPageHeader* header) {
+  return header->magic == HISTORY_PAGE_MAGIC &&
+         header->checksum == calculatePageChecksum(header) &&
+         header->openSeq != 0;
+}
+
+/**
+ * @brief CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF)
+ */
+static uint16_t crc16(const uint8_t* data, uint16_t len) {
+  uint16_t crc = 0xFFFF;
+  for (uint16_t i = 0; i < len; i++) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+/**
+ * @brief Check that a slot holds the expected record (header only)
+ */
+static bool probeRecord(uint8_t page, uint8_t slot, uint32_t seq) {
+  HistoryRecordHeader header;
+  EEPROM.get(recordAddr(page, slot), header);
+  return header.magic == HISTORY_RECORD_MAGIC && header.seq == seq;
+}
+
+/**
+ * @brief Read a record and verify its CRC
+ * @param block Output, TSRING_BLOCK_SIZE bytes
+ */
+static bool readRecord(uint8_t page, uint8_t slot, uint32_t seq, uint8_t* block) {
+  HistoryRecordHeader header;
+  int addr = recordAddr(page, slot);
+  EEPROM.get(addr, header);
+  if (header.magic != HISTORY_RECORD_MAGIC || header.seq != seq) {
+    return false;
+  }
+
+  addr += sizeof(HistoryRecordHeader);
+  for (uint16_t i = 0; i < TSRING_BLOCK_SIZE; i++) {
+    block[i] = EEPROM.read(addr + i);
+  }
+  return header.crc == crc16(block, TSRING_BLOCK_SIZE);
+}
+
+/**
+ * @brief Reopen the oldest page as head page
+ *
+ * Its previous records become stale (sequence numbers below openSeq).
+ */
+static void openNextPage() {
+  headPage = (headPage + 1) % HISTORY_PAGES;
+
+  HistoryPageHeader* header = &pages[headPage];
+  header->cycles = isPageValid(header) ? header->cycles + 1 : 1;
+  header->magic = HISTORY_PAGE_MAGIC;
+  header->openSeq = nextSeq;
+  header->checksum = calculatePageChecksum(header);
+  EEPROM.put(pageAddr(headPage), *header);
+
+  headFill = 0;
+  historyStats.pageOpens++;
+  historyStats.bytesWritten += sizeof(HistoryPageHeader);
+  if (header->cycles > historyStats.maxPageCycles) {
+    historyStats.maxPageCycles = header->cycles;
+  }
+}
+
+// ==========================================
+// FUNCTION IMPLEMENTATIONS
+// ==========================================
+
+/**
+ * @brief Initialize the history store
+ *
+ * Only the page headers and the head page's record headers are scanned
+ * to locate the end of the log; records are read (and CRC-checked) only
+ * if they still need to be delivered.
+ */
+void initHistory(TsRing* ring) {
+  DEBUG_PRINTLN("Initializing data log history...");
+
+  historyRing = ring;
+  memset(blockSeq, 0, sizeof(blockSeq));
+
+  // Find head page (highest openSeq)
+  bool found = false;
+  for (uint8_t p = 0; p < HISTORY_PAGES; p++) {
+    EEPROM.get(pageAddr(p), pages[p]);
+    if (!isPageValid(&pages[p])) continue;
+
+    if (!found || pages[p].openSeq > pages[headPage].openSeq) {
+      headPage = p;
+      found = true;
+    }
+    if (pages[p].cycles > historyStats.maxPageCycles) {
+      historyStats.maxPageCycles = pages[p].cycles;
+    }
+  }
+
+  // Fill level of head page (blank store: first record opens page 0)
+  if (found) {
+    headFill = 0;
+    while (headFill < HISTORY_SLOTS &&
+           probeRecord(headPage, headFill, pages[headPage].openSeq + headFill)) {
+      headFill++;
+    }
+    nextSeq = pages[headPage].openSeq + headFill;
+  }
+
+  HistoryCursor cursor = {};
+  deliveredSeq = loadHistoryCursor(&cursor) ? cursor.deliveredSeq : 0;
+  DEBUG_PRINT("History: delivered up to record ");
+  DEBUG_PRINTLN(deliveredSeq);
+
+  // Cursor ahead of the log (store erased): continue after the cursor
+  if (deliveredSeq >= nextSeq) {
+    nextSeq = deliveredSeq + 1;
+    headFill = HISTORY_SLOTS;
+  }
+
+  // Restore undelivered records, oldest page first (the one after head)
+  uint8_t block[TSRING_BLOCK_SIZE];
+  uint32_t lastSeq = deliveredSeq;
+  for (uint8_t i = 1; found && i <= HISTORY_PAGES; i++) {
+    uint8_t p = (headPage + i) % HISTORY_PAGES;
+    if (!isPageValid(&pages[p])) continue;
+
+    uint8_t slots = (p == headPage) ? headFill : HISTORY_SLOTS;
+    for (uint8_t slot = 0; slot < slots; slot++) {
+      uint32_t seq = pages[p].openSeq + slot;
+      if (seq <= lastSeq || seq >= nextSeq) continue;
+
+      if (readRecord(p, slot, seq, block) && tsRingLoadBlock(ring, block)) {
+        blockSeq[tsRingBlockId(ring, tsRingBlocks(ring) - 1)] = seq;
+        historyStats.recordsLoaded++;
+        lastSeq = seq;
+      } else {
+        historyStats.crcErrors++;
+      }
+    }
+  }
+
+  DEBUG_PRINT("History: ");
+  DEBUG_PRINT(historyStats.recordsLoaded);
+  DEBUG_PRINT(" records restored (");
+  DEBUG_PRINT(tsRingCount(ring));
+  DEBUG_PRINT(" points), next record ");
+  DEBUG_PRINT(nextSeq);
+  DEBUG_PRINT(", max page cycles ");
+  DEBUG_PRINTLN(historyStats.maxPageCycles);
+  if (historyStats.crcErrors > 0) {
+    DEBUG_PRINT("WARNING: ");
+    DEBUG_PRINT(historyStats.crcErrors);
+    DEBUG_PRINTLN(" history records rejected");
+  }
+}
+
+/**
+ * @brief Persist the ring's closed block
+ *
+ * Header and block go out in one EEPROM.put(), which still updates the
+ * slot byte by byte (HISTORY_RECORD_SIZE flash writes, see history.h).
+ * Blocks the caller until done. A torn write fails the CRC at boot.
+ */
+void historyPersistClosedBlock(const TsRing* ring) {
+  uint8_t blocks = tsRingBlocks(ring);
+  if (blocks == 0) return;
+
+  // Newest block is open, not stored yet
+  blockSeq[tsRingBlockId(ring, blocks - 1)] = 0;
+  if (blocks < 2) return;
+
+  uint8_t id = tsRingBlockId(ring, blocks - 2);
+  if (blockSeq[id] != 0) return;  // Restored from flash
+
+  if (headFill >= HISTORY_SLOTS) {
+    openNextPage();
+  }
+
+  static HistoryRecord record;
+  memcpy(record.block, tsRingBlock(ring, blocks - 2), TSRING_BLOCK_SIZE);
+  record.header.seq = nextSeq;
+  record.header.crc = crc16(record.block, TSRING_BLOCK_SIZE);
+  record.header.magic = HISTORY_RECORD_MAGIC;
+  EEPROM.put(recordAddr(headPage, headFill), record);
+
+  TsBlockHeader blockHeader;
+  memcpy(&blockHeader, record.block, sizeof(blockHeader));
+
+  blockSeq[id] = nextSeq++;
+  headFill++;
+  historyStats.recordWrites++;
+  historyStats.bytesWritten += HISTORY_RECORD_SIZE;
+  historyStats.pointsWritten += blockHeader.count;
+
+  DEBUG_PRINT("History: record ");
+  DEBUG_PRINT(blockSeq[id]);
+  DEBUG_PRINT(" written to page ");
+  DEBUG_PRINT(headPage);
+  DEBUG_PRINT(" slot ");
+  DEBUG_PRINTLN(headFill - 1);
+}
+
+/**
+ * @brief Save the history cursor after a delivery
+ *
+ * Everything before the oldest block still in the ring was delivered
+ * (a partly sent oldest block is restored whole: its sent points may be
+ * delivered twice after a reboot, never lost).
+ */
+void historyRelease(const TsRing* ring) {
+  uint32_t delivered = nextSeq - 1;
+  if (tsRingBlocks(ring) > 0) {
+    uint32_t oldest = blockSeq[tsRingBlockId(ring, 0)];
+    if (oldest != 0) delivered = oldest - 1;
+  }
+
+  // Only write when a whole record was released
+  if (delivered <= deliveredSeq) return;
+
+  HistoryCursor cursor = {};
+  cursor.deliveredSeq = delivered;
+  if (!saveHistoryCursor(&cursor)) {
+    DEBUG_PRINTLN("History: cursor not saved, records may be sent again");
+  }
+  deliveredSeq = delivered;
+  historyStats.bytesWritten += sizeof(HistoryCursor);
+}
+
+/**
+ * @brief Get flash usage statistics
+ *
+ * The endurance horizon assumes the worst case of one erase per byte
+ * written and continuous outage logging at DATALOG_INTERVAL_WIFI_DOWN.
+ * Two blocks wear out: a page (HISTORY_ERASES_PER_ROTATION per rotation)
+ * and the cursor's block, rewritten for every delivered record.
+ */
+HistoryStats getHistoryStats() {
+  uint32_t rotations = HISTORY_FLASH_ENDURANCE / HISTORY_ERASES_PER_ROTATION;
+  rotations = (historyStats.maxPageCycles < rotations) ? rotations - historyStats.maxPageCycles : 0;
+  uint32_t records = rotations * HISTORY_PAGES * HISTORY_SLOTS;
+
+  // Cursor erases so far: at most one cursor per record ever written
+  uint32_t cursorErases = 0;
+  for (uint8_t p = 0; p < HISTORY_PAGES; p++) {
+    if (isPageValid(&pages[p])) cursorErases += pages[p].cycles * HISTORY_SLOTS * sizeof(HistoryCursor);
+  }
+  uint32_t cursorLeft = (cursorErases < HISTORY_FLASH_ENDURANCE) ?
+                        (HISTORY_FLASH_ENDURANCE - cursorErases) / sizeof(HistoryCursor) : 0;
+  if (cursorLeft < records) records = cursorLeft;
+
+  // Points per record: measured, else estimated from the ring
+  uint32_t pointsPerRecord;
+  if (historyStats.recordWrites > 0) {
+    pointsPerRecord = historyStats.pointsWritten / historyStats.recordWrites;
+  } else {
+    pointsPerRecord = historyRing ? tsRingCapacity(historyRing) / TSRING_BLOCKS : 0;
+  }
+
+  uint64_t points = (uint64_t)records * pointsPerRecord;
+  historyStats.enduranceDays = (uint32_t)(points * (DATALOG_INTERVAL_WIFI_DOWN / 1000) / 86400UL);
+  return historyStats;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file history.h
+ * @brief Persistent data log history in data flash
+ *
+ * Log-structured, append-only store for the compressed data log blocks
+ * (tsring.h), so that points buffered during a WiFi outage survive a
+ * reboot or brown-out. The RAM ring stays the working copy and acts as a
+ * write-back cache: each block is written once, when it is closed.
+ *
+ * Flash layout (EEPROM emulation of the RA4M1 8 KB data flash, 1 KB
+ * erase blocks rated for 100k cycles):
+ *
+ *   EEPROM_HISTORY_ADDR + page * HISTORY_PAGE_SIZE
+ *   ┌──────────────────────┐
+ *   │ HistoryPageHeader    │  magic, erase cycles, first sequence number
+ *   ├──────────────────────┤
+ *   │ HistoryRecordHeader  │  sequence number, CRC-16, magic
+ *   │ ring block (256 B)   │
+ *   ├──────────────────────┤
+ *   │ ... HISTORY_SLOTS    │
+ *   └──────────────────────┘
+ *
+ * - Pages are filled in rotation (wear levelling: every page sees the
+ *   same number of cycles). The oldest page is reopened when the head
+ *   page is full.
+ * - Record N of a page holds sequence number openSeq + N. Records left
+ *   over from a previous cycle have an older sequence number and are
+ *   ignored; torn writes fail the CRC.
+ * - Boot recovery reads the page headers only (plus the record headers
+ *   of the head page to find its fill level), then loads the records
+ *   that were not yet sent into the RAM ring.
+ *
+ * The newest ring block is only persisted once it is closed: up to one
+ * block of points (~30 at 5 min, 2-3 hours) is lost on power failure.
+ *
+ * Cost: the R4 EEPROM library writes byte by byte (EEPROM.put() is one
+ * EEPROM.update() per byte), and each changed byte may rewrite its whole
+ * 1 KB block. Storing a record is HISTORY_RECORD_SIZE such writes,
+ * synchronous, inside logDataPoint() (every ~30 points while WiFi is
+ * down): the main loop stalls until it is done. The endurance estimate
+ * counts one erase per byte written.
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include "config.h"
+#include "tsring.h"
+
+// ==========================================
+// HISTORY CONFIGURATION
+// ==========================================
+#define EEPROM_HISTORY_ADDR       1024    ///< First page (after config, MQ135 baseline, cursor)
+#define HISTORY_PAGE_SIZE         1024    ///< One data flash erase block per page
+#define HISTORY_PAGES             7       ///< Pages in rotation (1 KB - 8 KB)
+#define HISTORY_PAGE_MAGIC        0x4850  ///< "HP"
+#define HISTORY_RECORD_MAGIC      0x4852  ///< "HR"
+#define HISTORY_FLASH_ENDURANCE   100000UL ///< Rated erase cycles per data flash block
+
+// ==========================================
+// DATA STRUCTURES
+// ==========================================
+
+/**
+ * @struct HistoryPageHeader
+ * @brief Header at the start of each page
+ */
+struct HistoryPageHeader {
+  uint16_t magic;              ///< HISTORY_PAGE_MAGIC
+  uint16_t checksum;           ///< Sum of all bytes except checksum
+  uint32_t cycles;             ///< Times this page was (re)opened
+  uint32_t openSeq;            ///< Sequence number of the first record
+};
+
+/**
+ * @struct HistoryRecordHeader
+ * @brief Header in front of each stored ring block
+ */
+struct HistoryRecordHeader {
+  uint32_t seq;                ///< Sequence number (openSeq + slot)
+  uint16_t crc;                ///< CRC-16/CCITT of the block
+  uint16_t magic;              ///< HISTORY_RECORD_MAGIC
+};
+
+/**
+ * @struct HistoryRecord
+ * @brief A stored ring block with its header (one slot of a page)
+ */
+struct HistoryRecord {
+  HistoryRecordHeader header;
+  uint8_t block[TSRING_BLOCK_SIZE];
+};
+
+#define HISTORY_RECORD_SIZE   sizeof(HistoryRecord)
+#define HISTORY_SLOTS         ((HISTORY_PAGE_SIZE - sizeof(HistoryPageHeader)) / HISTORY_RECORD_SIZE)
+
+/**
+ * Worst-case erase cycles of a page per rotation, if the EEPROM layer
+ * erases the whole block for every byte written: the page header, then
+ * every byte of each record.
+ */
+#define HISTORY_ERASES_PER_ROTATION   (sizeof(HistoryPageHeader) + HISTORY_SLOTS * HISTORY_RECORD_SIZE)
+
+/**
+ * @struct HistoryStats
+ * @brief Flash usage statistics
+ */
+struct HistoryStats {
+  uint32_t recordWrites;       ///< Records written since boot
+  uint32_t bytesWritten;       ///< Bytes written since boot (headers included)
+  uint32_t pointsWritten;      ///< Points in written records since boot
+  uint16_t pageOpens;          ///< Pages opened since boot
+  uint16_t recordsLoaded;      ///< Records restored at boot
+  uint16_t crcErrors;          ///< Records rejected at boot
+  uint32_t maxPageCycles;      ///< Highest page cycle count (lifetime)
+  uint32_t enduranceDays;      ///< Estimated days of outage logging left
+};
+
+// ==========================================
+// FUNCTION DECLARATIONS
+// ==========================================
+
+/**
+ * @brief Initialize the history store and restore unsent blocks
+ *
+ * Scans the page headers (a blank store needs no formatting: the first
+ * record opens page 0) and loads the records newer than the saved
+ * history cursor into the ring.
+ * Call once after the ring has been cleared.
+ *
+ * @param ring Ring to restore into
+ */
+void initHistory(TsRing* ring);
+
+/**
+ * @brief Persist the ring's closed block
+ *
+ * Call after tsRingAppend() returned true. Writes the block that was
+ * closed by the append, unless it is already stored (restored block).
+ *
+ * @param ring Ring that was appended to
+ */
+void historyPersistClosedBlock(const TsRing* ring);
+
+/**
+ * @brief Record that blocks were released from the ring
+ *
+ * Call after the ring was consumed or cleared once its points were
+ * delivered. Saves the history cursor when a block was released, so
+ * the block is not restored at next boot.
+ *
+ * @param ring Ring that was consumed
+ */
+void historyRelease(const TsRing* ring);
+
+/**
+ * @brief Get flash usage statistics
+ *
+ * @return Statistics, including the endurance estimate at the current
+ *         outage logging rate
+ */
+HistoryStats getHistoryStats();
+
+#endif // HISTORY_H
@@ -0,0 +1,245 @@
+/**
+ * @file httpparser.cpp
+ * @brief Incremental HTTP/1.1 request parser implementation
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#include "httpparser.h"
+
+// ==========================================
+// PRIVATE HELPER FUNCTIONS
+// ==========================================
+
+/**
+ * @brief Finish the parse with an error status
+ */
+static inline void fail(HttpRequest* request, uint16_t status) {
+  request->error = status;
+  request->state = HTTP_PARSE_DONE;
+}
+
+/**
+ * @brief Check the token read so far against a lowercase name
+ */
+static inline bool tokenIs(const HttpRequest* request, const char* name) {
+  return request->length == strlen(name) && memcmp(request->token, name, request->length) == 0;
+}
+
+/**
+ * @brief Check the start of the token against a lowercase name
+ */
+static inline bool tokenStartsWith(const HttpRequest* request, const char* name) {
+  size_t n = strlen(name);
+  return request->length >= n && n <= HTTP_MAX_TOKEN && memcmp(request->token, name, n) == 0;
+}
+
+/**
+ * @brief Add a character to the token (lowercase)
+ *
+ * Names too long to be kept can never match: the length is pushed past
+ * the buffer.
+ */
+static inline void tokenAppend(HttpRequest* request, char c) {
+  if (request->length < HTTP_MAX_TOKEN) {
+    request->token[request->length] = (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+  }
+  if (request->length < 255) request->length++;
+}
+
+/**
+ * @brief End of the header block: body or done
+ */
+static void endHeaders(HttpRequest* request) {
+  if (request->contentLength == 0) {
+    request->state = HTTP_PARSE_DONE;
+  } else if (request->contentLength >= HTTP_MAX_BODY) {
+    fail(request, 413);
+  } else {
+    request->state = HTTP_PARSE_BODY;
+  }
+}
+
+/**
+ * @brief Parse one byte of the request line or headers
+ */
+static void parseHeaderByte(HttpRequest* request, char c) {
+  switch (request->state) {
+    case HTTP_PARSE_METHOD:
+      if (c == ' ') {
+        request->method = tokenIs(request, "get") ? HTTP_GET :
+                          tokenIs(request, "post") ? HTTP_POST : HTTP_OTHER;
+        request->length = 0;
+        request->state = HTTP_PARSE_PATH;
+      } else if (c == '\r' || c == '\n') {
+        fail(request, 400);
+      } else {
+        tokenAppend(request, c);
+      }
+      break;
+
+    case HTTP_PARSE_PATH:
+      if (c == ' ' || c == '?') {
+        request->path[request->length] = '\0';
+        request->length = 0;
+        request->state = (c == '?') ? HTTP_PARSE_QUERY : HTTP_PARSE_VERSION;
+      } else if (c == '\r' || c == '\n') {
+        fail(request, 400);
+      } else if (request->length < HTTP_MAX_PATH - 1) {
+        request->path[request->length++] = c;
+      } else {
+        request->path[request->length] = '\0';
+        fail(request, 414);
+      }
+      break;
+
+    case HTTP_PARSE_QUERY:
+      if (c == ' ') {
+        request->query[request->length] = '\0';
+        request->length = 0;
+        request->state = HTTP_PARSE_VERSION;
+      } else if (c == '\r' || c == '\n') {
+        fail(request, 400);
+      } else if (request->length < HTTP_MAX_QUERY - 1) {
+        request->query[request->length++] = c;
+      } else {
+        request->query[request->length] = '\0';
+        fail(request, 414);
+      }
+      break;
+
+    case HTTP_PARSE_VERSION:
+      if (c == '\n') {
+        // Persistent by default from HTTP/1.1 on
+        request->version = tokenIs(request, "http/1.0") ? 10 : 11;
+        request->keepAlive = request->version >= 11;
+        request->length = 0;
+        request->state = HTTP_PARSE_HEADER_NAME;
+      } else if (c != '\r') {
+        tokenAppend(request, c);
+      }
+      break;
+
+    case HTTP_PARSE_HEADER_NAME:
+      if (c == '\n') {
+        // Empty line ends the headers, a line without ':' is ignored
+        if (request->length == 0) {
+          endHeaders(request);
+        }
+        request->length = 0;
+      } else if (c == ':') {
+        if (tokenIs(request, "content-length")) {
+          request->contentLength = 0;
+          request->state = HTTP_PARSE_HEADER_LENGTH;
+        } else if (tokenIs(request, "if-none-match")) {
+          request->length = 0;
+          request->state = HTTP_PARSE_HEADER_ETAG;
+        } else if (tokenIs(request, "connection")) {
+          request->length = 0;
+          request->state = HTTP_PARSE_HEADER_CONNECTION;
+        } else {
+          request->state = HTTP_PARSE_HEADER_SKIP;
+        }
+      } else if (c != '\r') {
+        tokenAppend(request, c);
+      }
+      break;
+
+    case HTTP_PARSE_HEADER_LENGTH:
+      if (c >= '0' && c <= '9') {
+        if (request->contentLength < 100000UL) {
+          request->contentLength = request->contentLength * 10 + (c - '0');
+        }
+      } else if (c == '\n') {
+        request->length = 0;
+        request->state = HTTP_PARSE_HEADER_NAME;
+      }
+      break;
+
+    case HTTP_PARSE_HEADER_CONNECTION:
+      if (c == '\n') {
+        if (tokenStartsWith(request, "close")) request->keepAlive = false;
+        if (tokenStartsWith(request, "keep-alive")) request->keepAlive = true;
+        request->length = 0;
+        request->state = HTTP_PARSE_HEADER_NAME;
+      } else if (c != ' ' && c != '\r') {
+        tokenAppend(request, c);
+      }
+      break;
+
+    case HTTP_PARSE_HEADER_ETAG:
+      // Entity tags are case-sensitive: kept as received
+      if (c == '\n') {
+        request->ifNoneMatch[request->length] = '\0';
+        request->length = 0;
+        request->state = HTTP_PARSE_HEADER_NAME;
+      } else if (c != '\r' && (c != ' ' || request->length > 0) &&
+                 request->length < HTTP_MAX_IF_NONE_MATCH - 1) {
+        request->ifNoneMatch[request->length++] = c;
+      }
+      break;
+
+    case HTTP_PARSE_HEADER_SKIP:
+      if (c == '\n') {
+        request->length = 0;
+        request->state = HTTP_PARSE_HEADER_NAME;
+      }
+      break;
+
+    default:
+      break;
+  }
+}
+
+// ==========================================
+// FUNCTION IMPLEMENTATIONS
+// ==========================================
+
+void httpRequestInit(HttpRequest* request) {
+  request->state = HTTP_PARSE_METHOD;
+  request->error = 0;
+  request->method = HTTP_OTHER;
+  request->path[0] = '\0';
+  request->query[0] = '\0';
+  request->body[0] = '\0';
+  request->ifNoneMatch[0] = '\0';
+  request->bodyLength = 0;
+  request->contentLength = 0;
+  request->headerBytes = 0;
+  request->version = 10;
+  request->keepAlive = false;
+  request->length = 0;
+}
+
+size_t httpRequestFeed(HttpRequest* request, const uint8_t* data, size_t size) {
+  size_t i = 0;
+  while (i < size && request->state != HTTP_PARSE_DONE) {
+    char c = (char)data[i++];
+
+    if (request->state == HTTP_PARSE_BODY) {
+      request->body[request->bodyLength++] = c;
+      if (request->bodyLength == request->contentLength) {
+        request->body[request->bodyLength] = '\0';
+        request->state = HTTP_PARSE_DONE;
+      }
+      continue;
+    }
+
+    if (++request->headerBytes > HTTP_MAX_HEADER_BYTES) {
+      fail(request, 431);
+      break;
+    }
+    parseHeaderByte(request, c);
+  }
+
+  return i;
+}
+
+bool httpRequestComplete(const HttpRequest* request) {
+  return request->state == HTTP_PARSE_DONE;
+}
@@ -0,0 +1,126 @@
+/**
+ * @file httpparser.h
+ * @brief Incremental HTTP/1.1 request parser
+ *
+ * Single-pass state machine fed with the bytes as they arrive (any chunk
+ * size): each byte is looked at once, whatever the header size.
+ *
+ * - Request line: method, path and query string are split on the fly
+ *   into fixed buffers (no copy of the raw request).
+ * - Headers: names are matched case-insensitively while they are read;
+ *   only Content-Length, Connection and If-None-Match are kept, other
+ *   values are skipped.
+ * - Body: read up to Content-Length into a fixed buffer.
+ *
+ * Oversized parts end the parse with an HTTP error status (414, 431,
+ * 413) instead of being truncated silently. Bare LF line endings are
+ * accepted.
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#ifndef HTTPPARSER_H
+#define HTTPPARSER_H
+
+#include <Arduino.h>
+
+// ==========================================
+// PARSER CONFIGURATION
+// ==========================================
+#define HTTP_MAX_PATH           32      ///< Longest path (without query)
+#define HTTP_MAX_QUERY          128     ///< Longest query string
+#define HTTP_MAX_BODY           256     ///< Largest body (POST /api/config)
+#define HTTP_MAX_HEADER_BYTES   2048    ///< Request line + headers
+#define HTTP_MAX_TOKEN          20      ///< Method / header name kept for matching
+#define HTTP_MAX_ETAG           24      ///< Longest entity tag of a document
+#define HTTP_MAX_IF_NONE_MATCH  64      ///< If-None-Match value kept (a few tags; longer is cut)
+
+// ==========================================
+// DATA STRUCTURES
+// ==========================================
+
+/**
+ * @enum HttpMethod
+ * @brief Request methods (order used by the route table)
+ */
+enum HttpMethod {
+  HTTP_GET,
+  HTTP_POST,
+  HTTP_OTHER
+};
+
+/**
+ * @enum HttpParseState
+ * @brief Parser position
+ */
+enum HttpParseState {
+  HTTP_PARSE_METHOD,        ///< Request line: method
+  HTTP_PARSE_PATH,          ///< Request line: path
+  HTTP_PARSE_QUERY,         ///< Request line: query string
+  HTTP_PARSE_VERSION,       ///< Request line: protocol version
+  HTTP_PARSE_HEADER_NAME,   ///< Header name (empty line ends headers)
+  HTTP_PARSE_HEADER_LENGTH, ///< Content-Length value
+  HTTP_PARSE_HEADER_CONNECTION, ///< Connection value
+  HTTP_PARSE_HEADER_ETAG,   ///< If-None-Match value
+  HTTP_PARSE_HEADER_SKIP,   ///< Other header value
+  HTTP_PARSE_BODY,          ///< Body bytes
+  HTTP_PARSE_DONE           ///< Complete (check error)
+};
+
+/**
+ * @struct HttpRequest
+ * @brief Parsed request and parser state
+ */
+struct HttpRequest {
+  HttpParseState state;           ///< Parser position
+  uint16_t error;                 ///< HTTP error status (0 = none)
+  HttpMethod method;              ///< Request method
+  char path[HTTP_MAX_PATH];       ///< Path, null-terminated
+  char query[HTTP_MAX_QUERY];     ///< Query string without '?', null-terminated
+  char body[HTTP_MAX_BODY];       ///< Body, null-terminated
+  uint16_t bodyLength;            ///< Body bytes received
+  uint32_t contentLength;         ///< Content-Length header (0 if absent)
+  uint16_t headerBytes;           ///< Request line + header bytes parsed
+  uint8_t version;                ///< Protocol version × 10 (10 = HTTP/1.0: no chunked responses)
+  bool keepAlive;                 ///< Connection stays open (HTTP/1.1 default, Connection header)
+  char ifNoneMatch[HTTP_MAX_IF_NONE_MATCH];  ///< If-None-Match header, null-terminated ("" if absent)
+  char token[HTTP_MAX_TOKEN];     ///< Method or header name being read
+  uint8_t length;                 ///< Length of the part being read
+};
+
+// ==========================================
+// FUNCTION DECLARATIONS
+// ==========================================
+
+/**
+ * @brief Reset a request before parsing
+ * @param request Request to reset
+ */
+void httpRequestInit(HttpRequest* request);
+
+/**
+ * @brief Feed received bytes to the parser
+ *
+ * Parsing stops at the end of the request: the bytes left belong to
+ * the next request of a keep-alive connection.
+ *
+ * @param request Request being parsed
+ * @param data Received bytes
+ * @param size Number of bytes
+ * @return Number of bytes used (size unless the request completed)
+ */
+size_t httpRequestFeed(HttpRequest* request, const uint8_t* data, size_t size);
+
+/**
+ * @brief Check whether parsing is finished
+ * @param request Request being parsed
+ * @return true if complete or failed
+ */
+bool httpRequestComplete(const HttpRequest* request);
+
+#endif // HTTPPARSER_H
@@ -0,0 +1,281 @@
+/**
+ * @file jobs.cpp
+ * @brief Background jobs implementation
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#include "jobs.h"
+#include "jsonwriter.h"
+
+// ==========================================
+// JOB TABLE
+// ==========================================
+static Job jobs[JOB_SLOTS];
+static int8_t runningSlot = -1;         // Slot of the running job, -1 if none
+static uint16_t nextJobId = 1;
+
+// ==========================================
+// MOON CALIBRATION JOB
+// ==========================================
+
+// Calibration scan, then move to the current phase (both in slices)
+static struct {
+  MoonCalibration cal;
+  bool positioning;
+  int targetSteps;
+  int moveSteps;                        // Steps of the move to the phase
+} moonJob;
+
+static void beginMoonJob() {
+  beginMoonCalibration(&moonJob.cal);
+  moonJob.positioning = false;
+}
+
+static bool stepMoonJob(Job* job) {
+  if (!moonJob.positioning) {
+    bool done = stepMoonCalibration(&moonJob.cal);
+    job->progress = moonCalibrationProgress(&moonJob.cal) * 9 / 10;
+    if (!done) return false;
+
+    job->moon = moonJob.cal.result;
+    lastCalibResult = moonJob.cal.result;
+    if (!job->moon.success) {
+      job->state = JOB_FAILED;
+      return true;
+    }
+
+    // Home found: the current phase is reached in slices too
+    DateTime now = getCurrentTime();
+    moonData.lastCalib = now.unixtime();
+    checkAndIncrementMoonCycle(now.unixtime());
+    moonJob.targetSteps = exactPhaseToSteps(calculateExactMoonPhase(now.unixtime()));
+    moonJob.moveSteps = (MOON_STEPS_PER_REV + moonJob.targetSteps - moonData.currentSteps) % MOON_STEPS_PER_REV;
+    moonJob.positioning = true;
+    return false;
+  }
+
+  bool done = stepMoonToward(moonJob.targetSteps, MOON_MOVE_SLICE_STEPS);
+  if (moonJob.moveSteps > 0) {
+    int left = (MOON_STEPS_PER_REV + moonJob.targetSteps - moonData.currentSteps) % MOON_STEPS_PER_REV;
+    job->progress = 90 + (long)(moonJob.moveSteps - left) * 10 / moonJob.moveSteps;
+  }
+  if (!done) return false;
+
+  // Already in place: only the phase data is updated
+  DateTime now = getCurrentTime();
+  updateMoonPosition(now.unixtime());
+  job->state = JOB_SUCCEEDED;
+  return true;
+}
+
+// ==========================================
+// NTP SYNC JOB
+// ==========================================
+static NtpSync ntpJob;
+
+static void beginNtpJob() {
+  beginNTPSync(&ntpJob);
+}
+
+static bool stepNtpJob(Job* job) {
+  bool done = stepNTPSync(&ntpJob);
+  job->progress = min(99, ntpJob.attempts * 100 / NTP_SYNC_ATTEMPTS);
+  if (!done) return false;
+
+  job->state = ntpJob.success ? JOB_SUCCEEDED : JOB_FAILED;
+  return true;
+}
+
+// ==========================================
+// HANDLER TABLE
+// ==========================================
+
+/**
+ * @struct JobHandler
+ * @brief How a type of job is run
+ */
+struct JobHandler {
+  const char* name;                     ///< JSON name
+  const char* label;                    ///< LCD line
+  void (*begin)();                      ///< Prepare the run
+  bool (*step)(Job* job);               ///< One slice; true when over (state set)
+};
+
+// In JobType order
+static const JobHandler handlers[] = {
+  {"moonCalibration", STR_MOON_CALIBRATION, beginMoonJob, stepMoonJob},
+  {"ntpSync",         STR_SYNCING_TIME,     beginNtpJob,  stepNtpJob}
+};
+
+static_assert(sizeof(handlers) / sizeof(handlers[0]) == JOB_TYPE_COUNT,
+              "handlers[] must have one entry per JobType");
+
+static const char* const JOB_STATE_NAMES[] = {"queued", "running", "succeeded", "failed"};
+
+// ==========================================
+// PRIVATE HELPER FUNCTIONS
+// ==========================================
+
+static inline bool isFinished(const Job* job) {
+  return job->state == JOB_SUCCEEDED || job->state == JOB_FAILED;
+}
+
+/**
+ * @brief Slot for a new job: free, else the oldest finished job
+ * @return Slot index, -1 if all jobs are unfinished
+ */
+static int findFreeSlot() {
+  int slot = -1;
+  unsigned long oldest = 0;
+  unsigned long now = millis();
+
+  for (int i = 0; i < JOB_SLOTS; i++) {
+    if (jobs[i].id == 0) return i;
+    if (isFinished(&jobs[i]) && (slot < 0 || now - jobs[i].finishedAt > oldest)) {
+      slot = i;
+      oldest = now - jobs[i].finishedAt;
+    }
+  }
+  return slot;
+}
+
+/**
+ * @brief Next job to run: the one queued first
+ * @return Slot index, -1 if none
+ */
+static int findNextQueued() {
+  int slot = -1;
+  unsigned long oldest = 0;
+  unsigned long now = millis();
+
+  for (int i = 0; i < JOB_SLOTS; i++) {
+    if (jobs[i].id != 0 && jobs[i].state == JOB_QUEUED && (slot < 0 || now - jobs[i].queuedAt > oldest)) {
+      slot = i;
+      oldest = now - jobs[i].queuedAt;
+    }
+  }
+  return slot;
+}
+
+// ==========================================
+// PUBLIC API
+// ==========================================
+
+uint16_t startJob(JobType type) {
+  for (int i = 0; i < JOB_SLOTS; i++) {
+    if (jobs[i].id != 0 && jobs[i].type == type && !isFinished(&jobs[i])) return jobs[i].id;
+  }
+
+  int slot = findFreeSlot();
+  if (slot < 0) {
+    DEBUG_PRINTLN("[JOBS] Queue full");
+    return 0;
+  }
+
+  Job* job = &jobs[slot];
+  memset(job, 0, sizeof(Job));
+  job->id = nextJobId++;
+  if (nextJobId == 0) nextJobId = 1;
+  job->type = type;
+  job->state = JOB_QUEUED;
+  job->queuedAt = millis();
+
+  DEBUG_PRINT("[JOBS] Queued #");
+  DEBUG_PRINT(job->id);
+  DEBUG_PRINT(" ");
+  DEBUG_PRINTLN(handlers[type].name);
+  return job->id;
+}
+
+void handleJobs() {
+  if (runningSlot < 0) {
+    runningSlot = findNextQueued();
+    if (runningSlot < 0) return;
+
+    Job* job = &jobs[runningSlot];
+    job->state = JOB_RUNNING;
+    job->startedAt = millis();
+    DEBUG_PRINT("[JOBS] Started #");
+    DEBUG_PRINTLN(job->id);
+    handlers[job->type].begin();
+  }
+
+  Job* job = &jobs[runningSlot];
+  if (!handlers[job->type].step(job)) return;
+
+  job->progress = 100;
+  job->finishedAt = millis();
+  runningSlot = -1;
+
+  DEBUG_PRINT("[JOBS] Finished #");
+  DEBUG_PRINT(job->id);
+  DEBUG_PRINT(" ");
+  DEBUG_PRINT(JOB_STATE_NAMES[job->state]);
+  DEBUG_PRINT(" in ");
+  DEBUG_PRINT(job->finishedAt - job->startedAt);
+  DEBUG_PRINTLN(" ms");
+}
+
+const Job* findJob(uint16_t id) {
+  if (id == 0) return NULL;
+  for (int i = 0; i < JOB_SLOTS; i++) {
+    if (jobs[i].id == id) return &jobs[i];
+  }
+  return NULL;
+}
+
+const Job* getRunningJob() {
+  return runningSlot < 0 ? NULL : &jobs[runningSlot];
+}
+
+const char* getJobTypeName(JobType type) {
+  return handlers[type].name;
+}
+
+const char* getJobLabel(JobType type) {
+  return handlers[type].label;
+}
+
+void printJobJSON(Print& out, const Job* job) {
+  unsigned long elapsed = 0;
+  if (job->state == JOB_RUNNING) elapsed = millis() - job->startedAt;
+  if (isFinished(job)) elapsed = job->finishedAt - job->startedAt;
+
+  JsonWriter json(out);
+  json.beginObject();
+  json.key("id").number(job->id);
+  json.key("type").string(handlers[job->type].name);
+  json.key("state").string(JOB_STATE_NAMES[job->state]);
+  json.key("progress").number(job->progress);
+  json.key("elapsed").number(elapsed);
+
+  if (isFinished(job)) {
+    json.key("result").beginObject();
+    json.key("success").boolean(job->state == JOB_SUCCEEDED);
+    if (job->type == JOB_MOON_CALIBRATION) {
+      json.key("peakValue").number(job->moon.peakValue);
+      json.key("peakStep").number(job->moon.peakStep);
+      json.key("finalValue").number(job->moon.finalValue);
+      json.key("difference").number(job->moon.difference);
+      json.key("duration").number(job->moon.duration);
+    }
+    json.endObject();
+  }
+
+  json.endObject();
+}
+
+void printJobsJSON(Print& out) {
+  JsonWriter json(out);
+  json.beginArray();
+  for (int i = 0; i < JOB_SLOTS; i++) {
+    if (jobs[i].id != 0) printJobJSON(json.raw(), &jobs[i]);
+  }
+  json.endArray();
+}
@@ -0,0 +1,137 @@
+/**
+ * @file jobs.h
+ * @brief Background jobs: long operations run in slices from the loop
+ *
+ * A moon calibration scans a full revolution (about a minute) and an NTP
+ * sync retries for seconds: run inline, they froze the clock, the LEDs,
+ * MQTT and every web client until they ended. They are queued as jobs
+ * instead:
+ * - startJob() returns the job ID at once (a web action answers with it)
+ * - handleJobs(), called from the loop, advances the running job by one
+ *   short slice per pass (a few motor steps, one LDR reading, one NTP
+ *   request); waits between slices don't block
+ * - one job runs at a time (they share the motor and the WiFi module),
+ *   the others wait in queue order
+ *
+ * The last JOB_SLOTS jobs are kept with their state, progress and result:
+ * GET /api/jobs/<id> reports them, the LCD shows the running one.
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#ifndef JOBS_H
+#define JOBS_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "moon.h"
+#include "rtc.h"
+
+// ==========================================
+// JOB CONFIGURATION
+// ==========================================
+#define JOB_SLOTS               4       ///< Jobs kept (queued, running and finished)
+
+// ==========================================
+// DATA STRUCTURES
+// ==========================================
+
+/**
+ * @enum JobType
+ * @brief Kinds of background jobs
+ */
+enum JobType {
+  JOB_MOON_CALIBRATION,     ///< Calibration scan, then move to the current phase
+  JOB_NTP_SYNC,             ///< RTC synchronization with NTP
+  JOB_TYPE_COUNT
+};
+
+/**
+ * @enum JobState
+ * @brief Life cycle of a job
+ */
+enum JobState {
+  JOB_QUEUED,
+  JOB_RUNNING,
+  JOB_SUCCEEDED,
+  JOB_FAILED
+};
+
+/**
+ * @struct Job
+ * @brief One job and its outcome
+ */
+struct Job {
+  uint16_t id;                    ///< Job ID (0: free slot)
+  JobType type;
+  JobState state;
+  uint8_t progress;               ///< Percentage (0-100)
+  unsigned long queuedAt;         ///< millis() when queued
+  unsigned long startedAt;        ///< millis() when started
+  unsigned long finishedAt;       ///< millis() when finished
+  MoonCalibrationResult moon;     ///< Result of JOB_MOON_CALIBRATION
+};
+
+// ==========================================
+// FUNCTION DECLARATIONS
+// ==========================================
+
+/**
+ * @brief Queue a job
+ *
+ * A job of the same type already queued or running is not queued
+ * twice: its ID is returned.
+ *
+ * @param type Kind of job
+ * @return Job ID, 0 if every slot holds an unfinished job
+ */
+uint16_t startJob(JobType type);
+
+/**
+ * @brief Advance the running job by one slice (call from the loop)
+ *
+ * Starts the next queued job when none is running.
+ */
+void handleJobs();
+
+/**
+ * @brief Find a job by ID
+ * @return The job, NULL if unknown or no longer kept
+ */
+const Job* findJob(uint16_t id);
+
+/**
+ * @brief Job being run
+ * @return The job, NULL if none
+ */
+const Job* getRunningJob();
+
+/**
+ * @brief Name of a job type ("moonCalibration")
+ */
+const char* getJobTypeName(JobType type);
+
+/**
+ * @brief LCD label of a job type
+ */
+const char* getJobLabel(JobType type);
+
+/**
+ * @brief Print a job as JSON (state, progress, result when finished)
+ * @param out Output (client, stream, buffer)
+ * @param job Job to print
+ */
+void printJobJSON(Print& out, const Job* job);
+
+/**
+ * @brief Print the jobs kept as a JSON array
+ * @param out Output (client, stream, buffer)
+ */
+void printJobsJSON(Print& out);
+
+#endif // JOBS_H
@@ -0,0 +1,167 @@
+/**
+ * @file jsonwriter.h
+ * @brief Streaming JSON writer over any Print sink
+ *
+ * Writes objects, arrays, numbers and escaped strings as they are
+ * produced: nothing is held in RAM but the nesting state, so a document
+ * has no size limit and can't be silently truncated. The sink decides
+ * where the bytes go:
+ * - SegmentStream / BlockStream: web response, MQTT stream
+ * - LengthCounter: length pass before an MQTT packet
+ * - BufferStream: fixed buffer (cached documents, events)
+ *
+ * Commas and colons are placed by the writer:
+ *
+ *   JsonWriter json(out);
+ *   json.beginObject();
+ *   json.key("temp").number(21.5f, 1);
+ *   json.key("valid").boolean(true);
+ *   json.endObject();                  // {"temp":21.5,"valid":true}
+ *
+ * Numbers are formatted by snprintf, as the static buffers they replace
+ * were: the output is byte for byte the same.
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#ifndef JSONWRITER_H
+#define JSONWRITER_H
+
+#include <Arduino.h>
+
+#define JSON_MAX_DEPTH          32      ///< Deepest nesting of objects / arrays
+
+/**
+ * @class JsonWriter
+ * @brief Writes one JSON document to a Print sink
+ */
+class JsonWriter {
+public:
+  explicit JsonWriter(Print& out) : out(out) {}
+
+  void beginObject() { open('{'); }
+  void endObject() { close('}'); }
+  void beginArray() { open('['); }
+  void endArray() { close(']'); }
+
+  /**
+   * @brief Start an object member: the next call writes its value
+   */
+  JsonWriter& key(const char* name) {
+    separate();
+    writeString(name);
+    out.write(':');
+    afterKey = true;
+    return *this;
+  }
+
+  void string(const char* value) {
+    separate();
+    writeString(value);
+  }
+
+  void number(int value) { number((long)value); }
+  void number(unsigned int value) { number((unsigned long)value); }
+  void number(long value) { format("%ld", value); }
+  void number(unsigned long value) { format("%lu", value); }
+
+  /**
+   * @brief Fixed-point number ("%.*f")
+   */
+  void number(double value, uint8_t decimals) { format("%.*f", (int)decimals, value); }
+
+  void boolean(bool value) { literal(value ? "true" : "false"); }
+  void null() { literal("null"); }
+
+  /**
+   * @brief Start a value written by another serializer
+   * @return The sink, to print one complete JSON value to
+   */
+  Print& raw() {
+    separate();
+    return out;
+  }
+
+private:
+  Print& out;
+  uint32_t filled = 0;      ///< Bit n: container at depth n has a member
+  uint8_t depth = 0;
+  bool afterKey = false;
+
+  /**
+   * @brief Comma before every member but the first (none after a key)
+   */
+  void separate() {
+    if (afterKey) {
+      afterKey = false;
+    } else if (depth > 0) {
+      uint32_t bit = 1UL << (depth - 1);
+      if (filled & bit) out.write(',');
+      filled |= bit;
+    }
+  }
+
+  void open(char c) {
+    separate();
+    out.write(c);
+    if (depth < JSON_MAX_DEPTH) depth++;
+    filled &= ~(1UL << (depth - 1));
+  }
+
+  void close(char c) {
+    out.write(c);
+    if (depth > 0) depth--;
+  }
+
+  void literal(const char* text) {
+    separate();
+    out.write((const uint8_t*)text, strlen(text));
+  }
+
+  template <typename... Args>
+  void format(const char* pattern, Args... args) {
+    char text[24];
+    int len = snprintf(text, sizeof(text), pattern, args...);
+    if (len >= (int)sizeof(text)) len = sizeof(text) - 1;
+    separate();
+    out.write((const uint8_t*)text, len);
+  }
+
+  /**
+   * @brief Quoted string, '"' '\' and control characters escaped
+   *
+   * Other bytes (UTF-8 included) are written as they are, in runs.
+   */
+  void writeString(const char* value) {
+    out.write('"');
+    const char* run = value;
+    for (const char* p = value; *p != '\0'; p++) {
+      uint8_t c = (uint8_t)*p;
+      if (c >= 0x20 && c != '"' && c != '\\') continue;
+
+      out.write((const uint8_t*)run, p - run);
+      run = p + 1;
+      char escape[8];
+      switch (c) {
+        case '"':  out.write((const uint8_t*)"\\\"", 2); break;
+        case '\\': out.write((const uint8_t*)"\\\\", 2); break;
+        case '\n': out.write((const uint8_t*)"\\n", 2); break;
+        case '\r': out.write((const uint8_t*)"\\r", 2); break;
+        case '\t': out.write((const uint8_t*)"\\t", 2); break;
+        default:
+          snprintf(escape, sizeof(escape), "\\u%04x", c);
+          out.write((const uint8_t*)escape, 6);
+          break;
+      }
+    }
+    out.write((const uint8_t*)run, strlen(run));
+    out.write('"');
+  }
+};
+
+#endif // JSONWRITER_H
@@ -9,6 +9,7 @@
  */
 
 #include "moon.h"
+#include "jobs.h"
 
 
 // ==========================================
@@ -222,125 +223,100 @@ bool initMoon() {
 // CALIBRATION
 // ==========================================
 
+/**
+ * @brief Run a whole calibration, blocking (startup)
+ * 
+ * At runtime calibrations run as a job (jobs.h), in slices.
+ */
 MoonCalibrationResult calibrateMoonHome() {
-  MoonCalibrationResult result = {false, 0, 0, 0, 0, 0};
-  unsigned long startTime = millis();
+  MoonCalibration cal;
+  beginMoonCalibration(&cal);
+  while (!stepMoonCalibration(&cal)) {
+    delay(1);
+  }
+  return cal.result;
+}
+
+void beginMoonCalibration(MoonCalibration* cal) {
+  memset(cal, 0, sizeof(MoonCalibration));
+  cal->stage = MOON_CALIB_SCAN_MOVE;
+  cal->startTime = millis();
+  cal->waitUntil = cal->startTime;
+  cal->wasCalibrated = moonData.isCalibrated;
+  
+  // Position unknown until the end: no other move meanwhile
+  moonData.isCalibrated = false;
   
   DEBUG_PRINTLN("[MOON] === Gaussian Peak Calibration ===");
   DEBUG_PRINTLN("[MOON] Scanning for brightness peak...");
   
   moonStepper.setSpeed(MOON_SPEED_CALIB);
   
-  // Storage for peak detection
-  int peakStep = 0;
-  int peakValue = 0;
-  int currentStep = 0;
-  
-  // LED blink state
-  unsigned long lastBlink = 0;
-  bool ledState = false;
-  
   // Turn on LED to indicate calibration started
   digitalWrite(PIN_MOON_CALIB_LED, HIGH);
-  
-  // Scan full revolution
-  for (currentStep = 0; currentStep < MOON_STEPS_PER_REV; currentStep += MOON_CALIB_STEP_SIZE) {
-    // Blink LED during search
-    if (millis() - lastBlink > MOON_CALIB_LED_BLINK) {
-      ledState = !ledState;
-      digitalWrite(PIN_MOON_CALIB_LED, ledState);
-      lastBlink = millis();
-    }
-    
-    // Move motor
-    moonStepper.step(MOON_CALIB_STEP_SIZE);
-    delay(20);  // Stabilization delay
-    
-    // Read LDR
-    int ldrValue = readLDR();
-    
-    // Update peak if new maximum found
-    if (ldrValue > peakValue) {
-      peakValue = ldrValue;
-      peakStep = currentStep;
-    }
-  }
-  
-  // Celebrate with LED blinks but keep LED ON for verification
-  digitalWrite(PIN_MOON_CALIB_LED, HIGH);
-  delay(200);
-  digitalWrite(PIN_MOON_CALIB_LED, LOW);
-  delay(200);
-  digitalWrite(PIN_MOON_CALIB_LED, HIGH);
-  delay(200);
-  digitalWrite(PIN_MOON_CALIB_LED, LOW);
-  delay(200);
-  digitalWrite(PIN_MOON_CALIB_LED, HIGH);
-  delay(200);
-  digitalWrite(PIN_MOON_CALIB_LED, LOW);
-  delay(200);
-  
+}
+
+/**
+ * @brief End of the scan: check the peak, then return to it
+ */
+static void endMoonScan(MoonCalibration* cal) {
   // Keep LED ON for positioning and verification
   digitalWrite(PIN_MOON_CALIB_LED, HIGH);
   
   DEBUG_PRINTLN("[MOON] Scan complete!");
   DEBUG_PRINT("[MOON] Peak detected at step: ");
-  DEBUG_PRINTLN(peakStep);
+  DEBUG_PRINTLN(cal->peakStep);
   DEBUG_PRINT("[MOON] Peak brightness value: ");
-  DEBUG_PRINT(peakValue);
+  DEBUG_PRINT(cal->peakValue);
   DEBUG_PRINTLN(" / 1023");
   
   // Validate peak quality
-  if (peakValue < MOON_MIN_PEAK_VALUE) {
+  if (cal->peakValue < MOON_MIN_PEAK_VALUE) {
     DEBUG_PRINTLN("[MOON] ✗ ERROR: Peak value too low (< " + String(MOON_MIN_PEAK_VALUE) + ")");
     DEBUG_PRINTLN("[MOON] Check: hole size, LDR positioning, ambient light");
     digitalWrite(PIN_MOON_CALIB_LED, LOW);
     disableMoonMotor();
-    result.success = false;
-    result.peakValue = peakValue;
-    result.duration = millis() - startTime;
-    return result;
+    // A full revolution was made: back where it started
+    moonData.isCalibrated = cal->wasCalibrated;
+    cal->result.success = false;
+    cal->result.peakValue = cal->peakValue;
+    cal->result.duration = millis() - cal->startTime;
+    cal->stage = MOON_CALIB_DONE;
+    return;
   }
   
   DEBUG_PRINTLN("[MOON] Peak quality is good");
   
   // Calculate forward movement back to peak (unidirectional rotation only)
-  int stepsToMove = (MOON_STEPS_PER_REV + peakStep - (MOON_STEPS_PER_REV % MOON_CALIB_STEP_SIZE)) % MOON_STEPS_PER_REV;
+  cal->stepsLeft = (MOON_STEPS_PER_REV + cal->peakStep - (MOON_STEPS_PER_REV % MOON_CALIB_STEP_SIZE)) % MOON_STEPS_PER_REV;
   
   DEBUG_PRINTLN("[MOON] Returning to peak position...");
   DEBUG_PRINT("[MOON] Forward movement: ");
-  DEBUG_PRINT(stepsToMove);
+  DEBUG_PRINT(cal->stepsLeft);
   DEBUG_PRINTLN(" steps");
   
-  moonStepper.step(stepsToMove);
-  
-  // Disable motor to prevent heating
-  disableMoonMotor();
-  
-  // Set this as our home position (New Moon = phase 0)
-  moonData.currentSteps = 0;
-  moonData.isCalibrated = true;
-  moonData.lastCalib = millis() / 1000;  // Store as seconds since boot (will be updated with epoch later)
-  
-  DEBUG_PRINTLN("[MOON] Positioned at peak (home position)");
-  
-  // Verify final position BEFORE turning off LED
-  delay(200);  // Let motor settle
+  cal->stage = MOON_CALIB_RETURN;
+}
+
+/**
+ * @brief At the peak: verify the position and fill the result
+ */
+static void verifyMoonHome(MoonCalibration* cal) {
   int finalValue = readLDR();
   
   DEBUG_PRINT("[MOON] Final LDR reading: ");
   DEBUG_PRINT(finalValue);
   DEBUG_PRINTLN(" / 1023");
   
-  int difference = abs(finalValue - peakValue);
+  int difference = abs(finalValue - cal->peakValue);
   
   if (difference < 50) {
     DEBUG_PRINTLN("[MOON] ✓ Position verified - at maximum brightness");
-    result.success = true;
+    cal->result.success = true;
   } else {
     DEBUG_PRINTLN("[MOON] ⚠ Position verification warning");
     DEBUG_PRINT("[MOON] Expected: ");
-    DEBUG_PRINT(peakValue);
+    DEBUG_PRINT(cal->peakValue);
     DEBUG_PRINT(", Got: ");
     DEBUG_PRINTLN(finalValue);
     DEBUG_PRINT("[MOON] Difference: ");
@@ -352,7 +328,7 @@ MoonCalibrationResult calibrateMoonHome() {
     }
     
     // Still mark as success if peak was good, just position might be slightly off
-    result.success = (peakValue >= MOON_MIN_PEAK_VALUE);
+    cal->result.success = (cal->peakValue >= MOON_MIN_PEAK_VALUE);
   }
   
   DEBUG_PRINTLN("[MOON] ✓✓✓ CALIBRATION COMPLETE ✓✓✓");
@@ -362,13 +338,108 @@ MoonCalibrationResult calibrateMoonHome() {
   digitalWrite(PIN_MOON_CALIB_LED, LOW);
   
   // Fill result structure
-  result.peakStep = peakStep;
-  result.peakValue = peakValue;
-  result.finalValue = finalValue;
-  result.difference = difference;
-  result.duration = millis() - startTime;
+  cal->result.peakStep = cal->peakStep;
+  cal->result.peakValue = cal->peakValue;
+  cal->result.finalValue = finalValue;
+  cal->result.difference = difference;
+  cal->result.duration = millis() - cal->startTime;
+}
+
+bool stepMoonCalibration(MoonCalibration* cal) {
+  if (cal->stage == MOON_CALIB_DONE) return true;
+  if ((long)(millis() - cal->waitUntil) < 0) return false;
+  
+  switch (cal->stage) {
+    case MOON_CALIB_SCAN_MOVE:
+      // Blink LED during search
+      if (millis() - cal->lastBlink > MOON_CALIB_LED_BLINK) {
+        cal->ledState = !cal->ledState;
+        digitalWrite(PIN_MOON_CALIB_LED, cal->ledState);
+        cal->lastBlink = millis();
+      }
+      
+      // Move motor, then let it stabilize before reading
+      moonStepper.step(MOON_CALIB_STEP_SIZE);
+      cal->waitUntil = millis() + 20;
+      cal->stage = MOON_CALIB_SCAN_READ;
+      break;
+      
+    case MOON_CALIB_SCAN_READ: {
+      int ldrValue = readLDR();
+      
+      // Update peak if new maximum found
+      if (ldrValue > cal->peakValue) {
+        cal->peakValue = ldrValue;
+        cal->peakStep = cal->currentStep;
+      }
+      
+      // Scan full revolution
+      cal->currentStep += MOON_CALIB_STEP_SIZE;
+      cal->stage = (cal->currentStep < MOON_STEPS_PER_REV) ? MOON_CALIB_SCAN_MOVE : MOON_CALIB_BLINK;
+      break;
+    }
+      
+    case MOON_CALIB_BLINK:
+      // Celebrate with LED blinks (3 on / off)
+      if (cal->blinks < 6) {
+        digitalWrite(PIN_MOON_CALIB_LED, (cal->blinks % 2 == 0) ? HIGH : LOW);
+        cal->blinks++;
+        cal->waitUntil = millis() + 200;
+      } else {
+        endMoonScan(cal);
+      }
+      break;
+      
+    case MOON_CALIB_RETURN:
+      if (cal->stepsLeft > 0) {
+        int steps = min(cal->stepsLeft, MOON_CALIB_STEP_SIZE);
+        moonStepper.step(steps);
+        cal->stepsLeft -= steps;
+      }
+      if (cal->stepsLeft == 0) {
+        // Disable motor to prevent heating
+        disableMoonMotor();
+        
+        // Set this as our home position (New Moon = phase 0)
+        moonData.currentSteps = 0;
+        moonData.isCalibrated = true;
+        moonData.lastCalib = millis() / 1000;  // Store as seconds since boot (will be updated with epoch later)
+        
+        DEBUG_PRINTLN("[MOON] Positioned at peak (home position)");
+        
+        // Verify final position BEFORE turning off LED: let motor settle
+        cal->waitUntil = millis() + 200;
+        cal->stage = MOON_CALIB_VERIFY;
+      }
+      break;
+      
+    case MOON_CALIB_VERIFY:
+      verifyMoonHome(cal);
+      cal->stage = MOON_CALIB_DONE;
+      break;
+      
+    case MOON_CALIB_DONE:
+      break;
+  }
   
-  return result;
+  return cal->stage == MOON_CALIB_DONE;
+}
+
+uint8_t moonCalibrationProgress(const MoonCalibration* cal) {
+  switch (cal->stage) {
+    case MOON_CALIB_SCAN_MOVE:
+    case MOON_CALIB_SCAN_READ:
+      return (uint8_t)((long)cal->currentStep * 80 / MOON_STEPS_PER_REV);
+    case MOON_CALIB_BLINK:
+      return 80 + cal->blinks;
+    case MOON_CALIB_RETURN:
+      return (uint8_t)(98 - (long)cal->stepsLeft * 12 / MOON_STEPS_PER_REV);
+    case MOON_CALIB_VERIFY:
+      return 99;
+    case MOON_CALIB_DONE:
+      break;
+  }
+  return 100;
 }
 
 bool checkAndRecalibrate(unsigned long currentEpoch) {
@@ -383,16 +454,13 @@ bool checkAndRecalibrate(unsigned long currentEpoch) {
     DEBUG_PRINT("[MOON] Days since last calibration: ");
     DEBUG_PRINTLN(daysSinceCalib);
     
-    MoonCalibrationResult result = calibrateMoonHome();
-    
-    if (result.success) {
-      moonData.lastCalib = currentEpoch;
-      DEBUG_PRINTLN("[MOON] ✓ Recalibration successful");
+    // Run as a job: the scan takes about a minute
+    if (startJob(JOB_MOON_CALIBRATION) != 0) {
+      DEBUG_PRINTLN("[MOON] Recalibration queued");
       return true;
-    } else {
-      DEBUG_PRINTLN("[MOON] ✗ Recalibration failed");
-      return false;
     }
+    DEBUG_PRINTLN("[MOON] ✗ Recalibration not queued (job queue full)");
+    return false;
   }
   
   return false;  // No recalibration needed
@@ -450,7 +518,7 @@ bool updateMoonPosition(unsigned long currentEpoch) {
       
   // Check if monthly recalibration is needed
   if (checkAndRecalibrate(currentEpoch)) {
-    DEBUG_PRINTLN("[MOON] Monthly recalibration completed");
+    DEBUG_PRINTLN("[MOON] Monthly recalibration started");
   }
   
   return true;
@@ -489,6 +557,33 @@ bool moveMoonToPhase(uint8_t phase) {
   return true;
 }
 
+/**
+ * @brief Move forward toward a position, a few steps per call
+ * 
+ * Same unidirectional move as moveMoonToPhase(), split so that a job
+ * never holds the loop for more than maxSteps.
+ * 
+ * @param targetSteps Motor position to reach (steps)
+ * @param maxSteps Most steps moved by this call
+ * @return true once at the target (motor disabled)
+ */
+bool stepMoonToward(int targetSteps, int maxSteps) {
+  int stepsToMove = (MOON_STEPS_PER_REV + targetSteps - moonData.currentSteps) % MOON_STEPS_PER_REV;
+  int steps = min(stepsToMove, maxSteps);
+  
+  if (steps > 0) {
+    moonStepper.setSpeed(MOON_SPEED_NORMAL);
+    moonStepper.step(steps);
+    moonData.currentSteps = (moonData.currentSteps + steps) % MOON_STEPS_PER_REV;
+  }
+  
+  if (steps < stepsToMove) return false;
+  
+  disableMoonMotor();
+  moonData.lastUpdate = millis();
+  return true;
+}
+
 // ==========================================
 // ASTRONOMICAL CALCULATIONS (Hybrid Meeus + Average Cycle)
 // ==========================================
@@ -55,6 +55,7 @@
 #define MOON_SPEED_CALIB        5     ///< RPM for calibration scan
 #define MOON_SPEED_NORMAL       10    ///< RPM for normal positioning
 #define MOON_CALIB_STEP_SIZE    8     ///< Steps between LDR readings during calibration
+#define MOON_MOVE_SLICE_STEPS   16    ///< Steps per slice when moving as a job
 
 // ==========================================
 // SENSOR CONFIGURATION
@@ -126,6 +127,41 @@ struct MoonCalibrationResult {
   unsigned long duration;     ///< Calibration duration in milliseconds
 };
 
+/**
+ * @enum MoonCalibrationStage
+ * @brief Step of a calibration run in slices
+ */
+enum MoonCalibrationStage {
+  MOON_CALIB_SCAN_MOVE,       ///< Move to the next scan position
+  MOON_CALIB_SCAN_READ,       ///< Read the LDR there (after stabilization)
+  MOON_CALIB_BLINK,           ///< Scan done: LED blinks
+  MOON_CALIB_RETURN,          ///< Move forward to the peak
+  MOON_CALIB_VERIFY,          ///< Read the LDR at the peak (after settling)
+  MOON_CALIB_DONE             ///< Result filled
+};
+
+/**
+ * @struct MoonCalibration
+ * @brief State of a calibration run in slices
+ * 
+ * Each call to stepMoonCalibration() does one short slice (a few steps
+ * of the motor or one LDR reading); waits are left to the caller.
+ */
+struct MoonCalibration {
+  MoonCalibrationStage stage;
+  int currentStep;            ///< Scan position (steps)
+  int peakStep;               ///< Scan position of the brightest reading
+  int peakValue;              ///< Brightest reading so far
+  int stepsLeft;              ///< Steps to the peak (MOON_CALIB_RETURN)
+  uint8_t blinks;             ///< LED toggles done (MOON_CALIB_BLINK)
+  bool ledState;
+  bool wasCalibrated;         ///< Calibration state before the run
+  unsigned long startTime;
+  unsigned long lastBlink;
+  unsigned long waitUntil;    ///< No slice before this time (millis)
+  MoonCalibrationResult result;
+};
+
 // ==========================================
 // GLOBAL VARIABLES (extern declarations)
 // ==========================================
@@ -151,9 +187,33 @@ bool initMoon();
 MoonCalibrationResult calibrateMoonHome();
 
 /**
- * @brief Check if monthly recalibration is needed and perform if necessary
+ * @brief Start a calibration run in slices
+ * 
+ * The position is unknown until the run ends: the moon is marked not
+ * calibrated meanwhile, so no other move is made.
+ * 
+ * @param cal Run state to initialize
+ */
+void beginMoonCalibration(MoonCalibration* cal);
+
+/**
+ * @brief Do one slice of a calibration run
+ * @param cal Run state
+ * @return true when the run is over (cal->result filled)
+ */
+bool stepMoonCalibration(MoonCalibration* cal);
+
+/**
+ * @brief Progress of a calibration run
+ * @param cal Run state
+ * @return Percentage (0-100)
+ */
+uint8_t moonCalibrationProgress(const MoonCalibration* cal);
+
+/**
+ * @brief Check if monthly recalibration is needed and queue it if so
  * @param currentEpoch Current Unix timestamp
- * @return true if recalibration was performed
+ * @return true if a recalibration job was queued
  */
 bool checkAndRecalibrate(unsigned long currentEpoch);
 
@@ -172,6 +232,14 @@ bool updateMoonPosition(unsigned long currentEpoch);
  */
 bool moveMoonToPhase(uint8_t phase);
 
+/**
+ * @brief Move forward toward a position, a few steps per call
+ * @param targetSteps Motor position to reach (steps)
+ * @param maxSteps Most steps moved by this call
+ * @return true once at the target (motor disabled)
+ */
+bool stepMoonToward(int targetSteps, int maxSteps);
+
 // Astronomical calculations
 /**
  * @brief Calculate lunar age using hybrid Meeus + average cycle approach
@@ -0,0 +1,248 @@
+/**
+ * @file mq135.cpp
+ * @brief MQ135 calibration and compensation implementation
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#include "mq135.h"
+
+// ==========================================
+// LOOKUP TABLES (flash)
+// ==========================================
+
+// Power-law fit of the datasheet CO2 curve: ppm = 116.602 * (Rs/R0)^-2.769
+// Generated by tools/gen_mq135_table.py (max interpolation error 0.48 % + 1 ppm)
+static const MQ135CurvePoint MQ135_CURVE[MQ135_CURVE_POINTS] PROGMEM = {
+  {  614, 22332}, {  652, 18911}, {  693, 15972}, {  735, 13571},
+  {  781, 11471}, {  829,  9725}, {  880,  8243}, {  934,  6990},
+  {  992,  5916}, { 1053,  5015}, { 1118,  4248}, { 1187,  3599},
+  { 1260,  3051}, { 1338,  2583}, { 1420,  2191}, { 1508,  1855},
+  { 1601,  1572}, { 1700,  1331}, { 1805,  1128}, { 1916,   956},
+  { 2034,   810}, { 2160,   686}, { 2293,   581}, { 2434,   493},
+  { 2584,   418}, { 2744,   354}, { 2913,   300}, { 3093,   254},
+  { 3284,   215}, { 3486,   182}, { 3701,   154}, { 3930,   131},
+  { 4172,   111}, { 4429,    94}, { 4703,    80}, { 4993,    67},
+  { 5301,    57}, { 5628,    48}, { 5975,    41}, { 6343,    35},
+  { 6735,    29}, { 7150,    25}, { 7591,    21}, { 8060,    18},
+  { 8557,    15}, { 9085,    13}, { 9645,    11}, {10240,     9},
+};
+
+// CO2-equivalent ppm -> index breakpoints (indoor CO2 guidance),
+// aligned with the existing AQI categories (50 good, 100 moderate, ...)
+static const uint16_t MQ135_INDEX_PPM[MQ135_INDEX_POINTS] PROGMEM = {
+  400, 600, 1000, 1500, 2000, 5000, 10000
+};
+static const uint16_t MQ135_INDEX_VALUE[MQ135_INDEX_POINTS] PROGMEM = {
+  0,   50,  100,  150,  200,  300,  500
+};
+
+// Temperature/humidity correction coefficients (datasheet Fig. 4 fit)
+#define MQ135_CORA  0.00035
+#define MQ135_CORB  0.02718
+#define MQ135_CORC  1.39538
+#define MQ135_CORD  0.0018
+#define MQ135_CORE  -0.003333333
+#define MQ135_CORF  -0.001923077
+#define MQ135_CORG  1.130128205
+
+// ==========================================
+// GLOBAL VARIABLES
+// ==========================================
+static MQ135State mq135 = {MQ135_DEFAULT_R0_KOHM, 0, 0, 0, false, 0};
+static unsigned long warmupStart = 0;   ///< millis() at initMQ135()
+static bool warmedUp = false;           ///< Latched: millis() wrapping never re-enters warm-up
+
+// ==========================================
+// PRIVATE HELPER FUNCTIONS
+// ==========================================
+
+/**
+ * @brief Commit the current window maximum as a new baseline and persist it
+ */
+static void commitBaseline() {
+  float candidate = mq135.windowMaxRs / MQ135_CLEAN_AIR_RATIO;
+
+  if (!mq135.baselineValid) {
+    mq135.r0 = candidate;
+  } else {
+    // Slow blend: one stuffy day must not drag the baseline down
+    mq135.r0 += (candidate - mq135.r0) / (1 << MQ135_BASELINE_SHIFT);
+  }
+  mq135.baselineValid = true;
+  mq135.daysLearned++;
+
+  MQ135Baseline baseline;
+  baseline.r0 = mq135.r0;
+  baseline.daysLearned = mq135.daysLearned;
+  saveMQ135Baseline(&baseline);
+
+  DEBUG_PRINT("[MQ135] Baseline committed, R0 = ");
+  DEBUG_PRINT(mq135.r0);
+  DEBUG_PRINTLN(" kOhm");
+}
+
+// ==========================================
+// FUNCTION IMPLEMENTATIONS
+// ==========================================
+
+void initMQ135() {
+  MQ135Baseline baseline;
+
+  if (loadMQ135Baseline(&baseline)) {
+    mq135.r0 = baseline.r0;
+    mq135.daysLearned = baseline.daysLearned;
+    mq135.baselineValid = true;
+    DEBUG_PRINT("[MQ135] Stored baseline R0 = ");
+    DEBUG_PRINT(mq135.r0);
+    DEBUG_PRINTLN(" kOhm");
+  } else {
+    DEBUG_PRINTLN("[MQ135] No baseline stored, learning from scratch");
+  }
+
+  mq135.windowMaxRs = 0;
+  mq135.windowStart = millis();
+  warmupStart = millis();
+  warmedUp = false;
+}
+
+/**
+ * @brief Read MQ135 with 14-bit resolution and oversampling
+ *
+ * The RA4M1 ADC is natively 14-bit; the core defaults to 10-bit for
+ * AVR compatibility. Resolution is raised for the burst and restored
+ * afterwards so other analogRead() users (moon LDR) are unaffected.
+ */
+uint16_t readMQ135Oversampled() {
+  uint32_t sum = 0;
+
+  analogReadResolution(MQ135_ADC_BITS);
+  for (uint8_t i = 0; i < MQ135_OVERSAMPLE; i++) {
+    sum += analogRead(PIN_AIR_QUALITY_SENSOR);
+  }
+  analogReadResolution(MQ135_DEFAULT_ADC_BITS);
+
+  return (uint16_t)((sum + MQ135_OVERSAMPLE / 2) / MQ135_OVERSAMPLE);
+}
+
+/**
+ * @brief Convert ADC value to sensor resistance
+ *
+ * Voltage divider: Rs = RL × (Vcc - Vout) / Vout
+ */
+float mq135Resistance(uint16_t adc) {
+  if (adc == 0 || adc >= MQ135_ADC_MAX) {
+    return 0;
+  }
+  return MQ135_RLOAD_KOHM * (float)(MQ135_ADC_MAX - adc) / adc;
+}
+
+/**
+ * @brief Temperature/humidity correction factor
+ *
+ * Two-segment fit of the datasheet dependency curve (normalised at
+ * 20°C / 33 %RH): quadratic in temperature below 20°C, linear above.
+ */
+float mq135CorrectionFactor(float temp, float humidity) {
+  if (temp < 20) {
+    return MQ135_CORA * temp * temp - MQ135_CORB * temp + MQ135_CORC - (humidity - 33.0) * MQ135_CORD;
+  }
+  return MQ135_CORE * temp + MQ135_CORF * humidity + MQ135_CORG;
+}
+
+/**
+ * @brief Convert Rs/R0 ratio to ppm
+ *
+ * Binary search over geometrically spaced knots, then linear
+ * interpolation. Ratios outside the table are clamped to its ends.
+ */
+uint16_t mq135RatioToPPM(float ratio) {
+  long q = lroundf(ratio * 4096);
+
+  uint16_t firstRatio = pgm_read_word(&MQ135_CURVE[0].ratioQ12);
+  uint16_t lastRatio = pgm_read_word(&MQ135_CURVE[MQ135_CURVE_POINTS - 1].ratioQ12);
+  if (q <= firstRatio) return pgm_read_word(&MQ135_CURVE[0].ppm);
+  if (q >= lastRatio) return pgm_read_word(&MQ135_CURVE[MQ135_CURVE_POINTS - 1].ppm);
+
+  uint8_t lo = 0;
+  uint8_t hi = MQ135_CURVE_POINTS - 1;
+  while (hi - lo > 1) {
+    uint8_t mid = (lo + hi) / 2;
+    if (pgm_read_word(&MQ135_CURVE[mid].ratioQ12) <= q) lo = mid;
+    else hi = mid;
+  }
+
+  int32_t r0 = pgm_read_word(&MQ135_CURVE[lo].ratioQ12);
+  int32_t r1 = pgm_read_word(&MQ135_CURVE[hi].ratioQ12);
+  int32_t p0 = pgm_read_word(&MQ135_CURVE[lo].ppm);
+  int32_t p1 = pgm_read_word(&MQ135_CURVE[hi].ppm);
+
+  // Rounded to the nearest ppm (the curve falls: num <= 0)
+  int32_t num = (p1 - p0) * (q - r0);
+  int32_t den = r1 - r0;
+  return (uint16_t)(p0 + (num - den / 2) / den);
+}
+
+/**
+ * @brief Convert ppm to index with piecewise linear breakpoints
+ */
+uint16_t mq135PPMToIndex(uint16_t ppm) {
+  if (ppm <= pgm_read_word(&MQ135_INDEX_PPM[0])) return 0;
+
+  for (uint8_t i = 1; i < MQ135_INDEX_POINTS; i++) {
+    int32_t c1 = pgm_read_word(&MQ135_INDEX_PPM[i]);
+    if (ppm <= c1) {
+      int32_t c0 = pgm_read_word(&MQ135_INDEX_PPM[i - 1]);
+      int32_t i0 = pgm_read_word(&MQ135_INDEX_VALUE[i - 1]);
+      int32_t i1 = pgm_read_word(&MQ135_INDEX_VALUE[i]);
+      return (uint16_t)(i0 + (i1 - i0) * (ppm - c0) / (c1 - c0));
+    }
+  }
+
+  return pgm_read_word(&MQ135_INDEX_VALUE[MQ135_INDEX_POINTS - 1]);
+}
+
+/**
+ * @brief Feed the R0 baseline learner
+ *
+ * - Ignored during the post-boot heater warm-up
+ * - Tracks the highest compensated Rs of the current window
+ * - Until a first baseline exists, R0 follows that maximum provisionally
+ *   so readings are usable from the first day
+ * - At the end of each 24 h window the maximum is committed and persisted
+ */
+void mq135LearnBaseline(float rs) {
+  mq135.rs = rs;
+
+  if (!warmedUp) {
+    if (millis() - warmupStart < MQ135_WARMUP_MS) return;
+    warmedUp = true;
+  }
+  if (rs <= 0) {
+    return;
+  }
+
+  if (rs > mq135.windowMaxRs) {
+    mq135.windowMaxRs = rs;
+    if (!mq135.baselineValid) {
+      mq135.r0 = rs / MQ135_CLEAN_AIR_RATIO;
+    }
+  }
+
+  if (millis() - mq135.windowStart >= MQ135_BASELINE_WINDOW_MS) {
+    if (mq135.windowMaxRs > 0) {
+      commitBaseline();
+    }
+    mq135.windowMaxRs = 0;
+    mq135.windowStart = millis();
+  }
+}
+
+const MQ135State& getMQ135State() {
+  return mq135;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file mq135.h
+ * @brief MQ135 calibration and compensation engine
+ *
+ * Converts the MQ135 analog output into a CO2-equivalent concentration
+ * and an air quality index:
+ *
+ *   14-bit oversampled ADC -> sensor resistance Rs
+ *   -> temperature/humidity compensation (indoor DHT22)
+ *   -> Rs/R0 ratio -> ppm (flash lookup table, no pow())
+ *   -> index 0-500 (flash breakpoint table)
+ *
+ * R0 (sensor resistance in clean air) is learned automatically: the
+ * highest compensated Rs seen over each 24 h window is taken as the
+ * clean-air level (the room is aired at least once a day) and blended
+ * into the stored baseline, which is persisted in EEPROM.
+ *
+ * Note: MQ135 requires 24-48h burn-in before the baseline is meaningful.
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#ifndef MQ135_H
+#define MQ135_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "storage.h"
+
+// ==========================================
+// MQ135 CONFIGURATION
+// ==========================================
+#define MQ135_ADC_BITS            14        ///< RA4M1 native ADC resolution
+#define MQ135_ADC_MAX             16383     ///< Full scale at MQ135_ADC_BITS
+#define MQ135_DEFAULT_ADC_BITS    10        ///< Resolution restored after sampling (LDR code expects 10 bits)
+#define MQ135_OVERSAMPLE          16        ///< Samples averaged per reading
+#define MQ135_RLOAD_KOHM          10.0      ///< Load resistor on the MQ135 module (kΩ)
+#define MQ135_CLEAN_AIR_RATIO     0.6407    ///< Rs/R0 at 400 ppm CO2 (from curve fit)
+#define MQ135_DEFAULT_R0_KOHM     76.63     ///< Fallback R0 before any baseline is learned
+#define MQ135_WARMUP_MS           1800000UL ///< No baseline learning for 30 min after boot
+#define MQ135_BASELINE_WINDOW_MS  86400000UL ///< Baseline learning window (24 h)
+#define MQ135_BASELINE_SHIFT      2         ///< Baseline blend: R0 += (candidate - R0) / 4
+
+#define MQ135_CURVE_POINTS        48        ///< Knots in the ratio -> ppm table
+#define MQ135_INDEX_POINTS        7         ///< Breakpoints in the ppm -> index table
+
+// ==========================================
+// DATA STRUCTURES
+// ==========================================
+
+/**
+ * @struct MQ135CurvePoint
+ * @brief One knot of the Rs/R0 -> ppm curve (stored in flash)
+ */
+struct MQ135CurvePoint {
+  uint16_t ratioQ12;       ///< Rs/R0 × 4096
+  uint16_t ppm;            ///< CO2-equivalent concentration
+};
+
+/**
+ * @struct MQ135State
+ * @brief Calibration state (for diagnostics / web API)
+ */
+struct MQ135State {
+  float r0;                ///< Current clean-air resistance (kΩ)
+  float rs;                ///< Last compensated sensor resistance (kΩ)
+  float windowMaxRs;       ///< Highest compensated Rs in current window (kΩ)
+  uint16_t daysLearned;    ///< Number of baseline windows committed
+  bool baselineValid;      ///< True once R0 comes from a learned/stored baseline
+  unsigned long windowStart; ///< Start of current learning window (millis)
+};
+
+// ==========================================
+// FUNCTION DECLARATIONS
+// ==========================================
+
+/**
+ * @brief Initialize MQ135 engine and load stored baseline from EEPROM
+ */
+void initMQ135();
+
+/**
+ * @brief Read MQ135 with 14-bit resolution and oversampling
+ * @return Averaged ADC value (0 - MQ135_ADC_MAX)
+ */
+uint16_t readMQ135Oversampled();
+
+/**
+ * @brief Convert ADC value to sensor resistance
+ * @param adc ADC value at MQ135_ADC_BITS resolution
+ * @return Sensor resistance Rs in kΩ (0 if ADC reading unusable)
+ */
+float mq135Resistance(uint16_t adc);
+
+/**
+ * @brief Temperature/humidity correction factor (Rs_actual / Rs_20°C,33%RH)
+ * @param temp Temperature in Celsius
+ * @param humidity Relative humidity in %
+ * @return Correction factor (divide Rs by it)
+ */
+float mq135CorrectionFactor(float temp, float humidity);
+
+/**
+ * @brief Convert Rs/R0 ratio to CO2-equivalent ppm (flash table lookup)
+ * @param ratio Rs/R0
+ * @return Concentration in ppm
+ */
+uint16_t mq135RatioToPPM(float ratio);
+
+/**
+ * @brief Convert CO2-equivalent ppm to air quality index (0-500)
+ * @param ppm Concentration in ppm
+ * @return Index value
+ */
+uint16_t mq135PPMToIndex(uint16_t ppm);
+
+/**
+ * @brief Feed a compensated resistance to the R0 baseline learner
+ *
+ * Commits (and persists) a new baseline once per 24 h window.
+ *
+ * @param rs Compensated sensor resistance in kΩ
+ */
+void mq135LearnBaseline(float rs);
+
+/**
+ * @brief Get calibration state
+ * @return Reference to MQ135State structure
+ */
+const MQ135State& getMQ135State();
+
+#endif // MQ135_H
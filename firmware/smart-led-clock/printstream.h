@@ -0,0 +1,182 @@
+/**
+ * @file printstream.h
+ * @brief Print sinks shared by the MQTT payloads and the web responses
+ *
+ * - LengthCounter: counts the bytes a serializer would write, so that
+ *   an MQTT packet length can be sent before a payload that is never
+ *   held in RAM.
+ * - BlockStream: groups small writes into STREAM_BLOCK_SIZE blocks.
+ * - SegmentStream: coalesces a whole HTTP response into segment-sized
+ *   writes.
+ * - BufferStream: fills a fixed buffer (cached documents, events).
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#ifndef PRINTSTREAM_H
+#define PRINTSTREAM_H
+
+#include <Arduino.h>
+
+#define STREAM_BLOCK_SIZE       64      ///< Bytes per WiFi write when streaming
+
+/**
+ * @class LengthCounter
+ * @brief Print sink that only counts bytes (length pass)
+ */
+class LengthCounter : public Print {
+public:
+  size_t count = 0;
+  size_t write(uint8_t) override { count++; return 1; }
+  size_t write(const uint8_t*, size_t size) override { count += size; return size; }
+};
+
+/**
+ * @class BlockStream
+ * @brief Print sink forwarding to a client in small blocks
+ *
+ * PubSubClient and WiFiClient pass each write() straight to the WiFi
+ * module, and every write is a round trip over its serial link: bytes
+ * are grouped into STREAM_BLOCK_SIZE writes instead. Call flush() at
+ * the end.
+ */
+class BlockStream : public Print {
+public:
+  size_t written = 0;
+
+  explicit BlockStream(Print& out) : out(out) {}
+
+  size_t write(uint8_t b) override {
+    block[used++] = b;
+    if (used == sizeof(block)) flush();
+    return 1;
+  }
+
+  size_t write(const uint8_t* buffer, size_t size) override {
+    for (size_t i = 0; i < size; i++) write(buffer[i]);
+    return size;
+  }
+
+  void flush() override {
+    if (used > 0) {
+      written += out.write(block, used);
+      used = 0;
+    }
+  }
+
+private:
+  Print& out;
+  uint8_t block[STREAM_BLOCK_SIZE];
+  uint8_t used = 0;
+};
+
+/**
+ * @class SegmentStream
+ * @brief Print sink coalescing a whole response into buffer-sized writes
+ *
+ * Headers and body are gathered in a caller-provided buffer and written
+ * when it is full or on flush(): a response that fits goes out in a
+ * single write. A run of at least a full buffer arriving while it is
+ * empty is written from where it is, without a copy (pages in flash).
+ * After a short write (connection lost) nothing more is sent.
+ */
+class SegmentStream : public Print {
+public:
+  size_t length = 0;        ///< Bytes printed
+  uint16_t writes = 0;      ///< Writes to the output
+  bool failed = false;      ///< A write was short
+
+  SegmentStream(Print& out, uint8_t* buffer, size_t size) : out(out), buffer(buffer), size(size) {}
+
+  size_t write(uint8_t b) override {
+    buffer[used++] = b;
+    length++;
+    if (used == size) flush();
+    return 1;
+  }
+
+  size_t write(const uint8_t* data, size_t count) override {
+    size_t n = 0;
+    while (n < count) {
+      if (used == 0 && count - n >= size) {
+        send(data + n, size);
+        n += size;
+        continue;
+      }
+      size_t room = min(size - used, count - n);
+      memcpy(buffer + used, data + n, room);
+      used += room;
+      n += room;
+      if (used == size) flush();
+    }
+    length += count;
+    return count;
+  }
+
+  void flush() override {
+    if (used > 0) {
+      send(buffer, used);
+      used = 0;
+    }
+  }
+
+private:
+  Print& out;
+  uint8_t* buffer;
+  size_t size;
+  size_t used = 0;
+
+  void send(const uint8_t* data, size_t count) {
+    if (failed) return;
+    writes++;
+    if (out.write(data, count) != count) failed = true;
+  }
+};
+
+/**
+ * @class BufferStream
+ * @brief Print sink filling a fixed buffer, kept null-terminated
+ *
+ * Bytes that don't fit are dropped and set overflow; rewind() returns
+ * to an earlier length (e.g. to drop a part that did not fit).
+ */
+class BufferStream : public Print {
+public:
+  size_t length = 0;
+  bool overflow = false;
+
+  BufferStream(char* buffer, size_t size) : buffer(buffer), size(size) { buffer[0] = '\0'; }
+
+  size_t write(uint8_t b) override {
+    if (length + 1 >= size) {
+      overflow = true;
+      return 0;
+    }
+    buffer[length++] = b;
+    buffer[length] = '\0';
+    return 1;
+  }
+
+  size_t write(const uint8_t* data, size_t count) override {
+    size_t n = 0;
+    while (n < count && write(data[n]) == 1) n++;
+    return n;
+  }
+
+  void rewind(size_t to) {
+    length = to;
+    buffer[length] = '\0';
+    overflow = false;
+  }
+
+private:
+  char* buffer;
+  size_t size;
+};
+
+#endif // PRINTSTREAM_H
@@ -0,0 +1,225 @@
+/**
+ * @file rollup.cpp
+ * @brief Multi-resolution min/avg/max rollups implementation
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#include "rollup.h"
+#include "jsonwriter.h"
+#include "sensors.h"
+
+// ==========================================
+// PRIVATE VARIABLES
+// ==========================================
+
+static RollupBucket buckets15m[ROLLUP_15M_BUCKETS];
+static RollupBucket buckets1h[ROLLUP_1H_BUCKETS];
+
+static RollupTier tiers[ROLLUP_TIER_COUNT] = {
+  {"15m",  900, buckets15m, ROLLUP_15M_BUCKETS, 0, 0, 0, {}},   // ROLLUP_15M
+  {"1h",  3600, buckets1h,  ROLLUP_1H_BUCKETS,  0, 0, 0, {}}    // ROLLUP_1H
+};
+
+// Last reading fed per channel (SensorChannel::lastUpdate)
+static unsigned long lastFed[SENSOR_CHANNEL_COUNT];
+
+// ==========================================
+// PRIVATE HELPER FUNCTIONS
+// ==========================================
+
+/**
+ * @brief Quantize a scaled value to one byte (0-254)
+ */
+static uint8_t quantize(uint8_t ch, int32_t value) {
+  const SensorChannel& channel = sensorChannels[ch];
+  int32_t q = (value - channel.rollupBase + channel.rollupStep / 2) / channel.rollupStep;
+  if (value < channel.rollupBase) q = 0;
+  return (q > ROLLUP_QUANT_NONE - 1) ? ROLLUP_QUANT_NONE - 1 : (uint8_t)q;
+}
+
+static inline int16_t dequantize(uint8_t ch, uint8_t q) {
+  if (q == ROLLUP_QUANT_NONE) return SENSOR_VALUE_INVALID;
+  return sensorChannels[ch].rollupBase + (int16_t)q * sensorChannels[ch].rollupStep;
+}
+
+/**
+ * @brief Store the open bucket of a tier as its newest closed bucket
+ */
+static void storeBucket(RollupTier* tier) {
+  RollupBucket* bucket = &tier->buckets[tier->head];
+  const RollupAccumulator* acc = &tier->open;
+
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    if (acc->count[ch] == 0) {
+      bucket->min[ch] = bucket->avg[ch] = bucket->max[ch] = ROLLUP_QUANT_NONE;
+      continue;
+    }
+    bucket->min[ch] = quantize(ch, acc->min[ch]);
+    bucket->avg[ch] = quantize(ch, rollupMean(acc, ch));
+    bucket->max[ch] = quantize(ch, acc->max[ch]);
+  }
+
+  tier->head = (tier->head + 1) % tier->size;
+  if (tier->count < tier->size) tier->count++;
+}
+
+void rollupMerge(RollupAccumulator* into, const RollupAccumulator* from) {
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    if (from->count[ch] == 0) continue;
+    into->sum[ch] += from->sum[ch];
+    into->count[ch] += from->count[ch];
+    if (from->min[ch] < into->min[ch]) into->min[ch] = from->min[ch];
+    if (from->max[ch] > into->max[ch]) into->max[ch] = from->max[ch];
+  }
+}
+
+/**
+ * @brief Close the buckets of a tier that ended before now
+ *
+ * Each closed bucket is passed on to the next (coarser) tier. Gaps
+ * longer than the whole ring restart the tier.
+ */
+static void advanceTier(uint8_t id, uint32_t now) {
+  RollupTier* tier = &tiers[id];
+  uint32_t aligned = now - now % tier->period;
+
+  if (tier->openStart == 0 || aligned <= tier->openStart) {
+    if (tier->openStart == 0) tier->openStart = aligned;
+    return;
+  }
+
+  if ((aligned - tier->openStart) / tier->period > tier->size) {
+    tier->head = 0;
+    tier->count = 0;
+    rollupReset(&tier->open);
+    tier->openStart = aligned;
+    return;
+  }
+
+  while (tier->openStart < aligned) {
+    storeBucket(tier);
+    if (id + 1 < ROLLUP_TIER_COUNT) {
+      rollupMerge(&tiers[id + 1].open, &tier->open);
+    }
+    rollupReset(&tier->open);
+    tier->openStart += tier->period;
+  }
+}
+
+// ==========================================
+// FUNCTION IMPLEMENTATIONS
+// ==========================================
+
+void rollupReset(RollupAccumulator* acc) {
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    acc->sum[ch] = 0;
+    acc->count[ch] = 0;
+    acc->min[ch] = INT16_MAX;
+    acc->max[ch] = INT16_MIN;
+  }
+}
+
+void rollupAddNewReadings(RollupAccumulator* acc, unsigned long* lastFed) {
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    const SensorChannel& channel = sensorChannels[ch];
+    if (channel.lastUpdate == lastFed[ch]) continue;
+    lastFed[ch] = channel.lastUpdate;
+    if (!channel.valid) continue;
+
+    acc->sum[ch] += channel.value;
+    acc->count[ch]++;
+    if (channel.value < acc->min[ch]) acc->min[ch] = channel.value;
+    if (channel.value > acc->max[ch]) acc->max[ch] = channel.value;
+  }
+}
+
+int16_t rollupMean(const RollupAccumulator* acc, uint8_t channel) {
+  uint16_t n = acc->count[channel];
+  if (n == 0) return SENSOR_VALUE_INVALID;
+  int32_t sum = acc->sum[channel];
+  return (int16_t)((sum >= 0) ? (sum + n / 2) / n : (sum - n / 2) / n);
+}
+
+void initRollups() {
+  for (uint8_t t = 0; t < ROLLUP_TIER_COUNT; t++) {
+    tiers[t].head = 0;
+    tiers[t].count = 0;
+    tiers[t].openStart = 0;
+    rollupReset(&tiers[t].open);
+  }
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    lastFed[ch] = sensorChannels[ch].lastUpdate;
+  }
+
+  DEBUG_PRINT("Rollups: ");
+  DEBUG_PRINT(ROLLUP_15M_BUCKETS);
+  DEBUG_PRINT(" x 15min, ");
+  DEBUG_PRINT(ROLLUP_1H_BUCKETS);
+  DEBUG_PRINT(" x 1h (");
+  DEBUG_PRINT(sizeof(buckets15m) + sizeof(buckets1h));
+  DEBUG_PRINTLN(" bytes)");
+}
+
+/**
+ * @brief Feed new readings and close ended buckets
+ *
+ * Readings go to the finest tier's open bucket; coarser tiers receive
+ * whole buckets when the finer tier closes them.
+ */
+void updateRollups(uint32_t now) {
+  for (uint8_t t = 0; t < ROLLUP_TIER_COUNT; t++) {
+    advanceTier(t, now);
+  }
+
+  rollupAddNewReadings(&tiers[0].open, lastFed);
+}
+
+const RollupTier* getRollupTier(uint8_t tier) {
+  return (tier < ROLLUP_TIER_COUNT) ? &tiers[tier] : NULL;
+}
+
+uint8_t findRollupTier(const char* name) {
+  for (uint8_t t = 0; t < ROLLUP_TIER_COUNT; t++) {
+    if (strcmp(tiers[t].name, name) == 0) return t;
+  }
+  return ROLLUP_TIER_COUNT;
+}
+
+void printRollupJSON(Print& out, uint8_t tier, uint8_t channel) {
+  const RollupTier* t = getRollupTier(tier);
+  if (t == NULL || channel >= SENSOR_CHANNEL_COUNT) {
+    out.print("{\"error\":\"unknown tier or channel\"}");
+    return;
+  }
+
+  JsonWriter json(out);
+  char value[12];
+  uint32_t end = t->openStart - t->period;
+
+  json.beginObject();
+  json.key("tier").string(t->name);
+  json.key("period").number((unsigned long)t->period);
+  json.key("channel").string(sensorChannels[channel].key);
+  json.key("end").number((unsigned long)(t->count ? end : 0));
+  json.key("count").number(t->count);
+
+  // One array per statistic, oldest bucket first
+  static const char* const names[3] = {"min", "avg", "max"};
+  for (uint8_t stat = 0; stat < 3; stat++) {
+    json.key(names[stat]).beginArray();
+    for (uint16_t i = 0; i < t->count; i++) {
+      const RollupBucket* b = &t->buckets[(t->head + t->size - t->count + i) % t->size];
+      uint8_t q = (stat == 0) ? b->min[channel] : (stat == 1) ? b->avg[channel] : b->max[channel];
+      formatChannelValue(channel, dequantize(channel, q), value, sizeof(value));
+      json.raw().print(value);
+    }
+    json.endArray();
+  }
+  json.endObject();
+}
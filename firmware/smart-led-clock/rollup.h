@@ -0,0 +1,177 @@
+/**
+ * @file rollup.h
+ * @brief Multi-resolution min/avg/max rollups of sensor channels
+ *
+ * RRD-style tiers fed from every sensor reading (not only the logged
+ * points), each a fixed ring of buckets:
+ *
+ * - raw:     the data log (datalog.h), one point every 2-5 minutes
+ * - 15 min:  ROLLUP_15M_BUCKETS buckets (2 days)
+ * - hourly:  ROLLUP_1H_BUCKETS buckets (7 days)
+ *
+ * Each tier accumulates count/sum/min/max per channel for its current
+ * bucket (O(1) per reading); the hourly tier is fed from the closed
+ * 15-minute accumulators, so its averages are exact. Closed buckets are
+ * quantized to one byte per value with the channel's rollupBase and
+ * rollupStep (see SensorChannel in config.h): 18 bytes per bucket for
+ * 6 channels.
+ *
+ * Buckets are aligned to the period (e.g. 12:00, 12:15...). A forward
+ * clock jump fills the gap with empty buckets, a backward jump (NTP
+ * correction) continues in the current bucket.
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#ifndef ROLLUP_H
+#define ROLLUP_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ==========================================
+// ROLLUP CONFIGURATION
+// ==========================================
+#ifndef ROLLUP_15M_BUCKETS
+#define ROLLUP_15M_BUCKETS      192     ///< 15-minute buckets (2 days)
+#endif
+#ifndef ROLLUP_1H_BUCKETS
+#define ROLLUP_1H_BUCKETS       168     ///< Hourly buckets (7 days)
+#endif
+#define ROLLUP_QUANT_NONE       255     ///< Quantized value of an empty bucket
+
+/**
+ * @enum RollupTierId
+ * @brief Rollup tiers, finest first
+ */
+enum RollupTierId {
+  ROLLUP_15M,              ///< 15-minute buckets
+  ROLLUP_1H,               ///< Hourly buckets
+  ROLLUP_TIER_COUNT
+};
+
+// ==========================================
+// DATA STRUCTURES
+// ==========================================
+
+/**
+ * @struct RollupAccumulator
+ * @brief Running statistics of the current bucket
+ */
+struct RollupAccumulator {
+  int32_t sum[SENSOR_CHANNEL_COUNT];     ///< Sum of scaled values
+  uint16_t count[SENSOR_CHANNEL_COUNT];  ///< Number of readings
+  int16_t min[SENSOR_CHANNEL_COUNT];     ///< Minimum (scaled)
+  int16_t max[SENSOR_CHANNEL_COUNT];     ///< Maximum (scaled)
+};
+
+/**
+ * @struct RollupBucket
+ * @brief Closed bucket, quantized (ROLLUP_QUANT_NONE = no reading)
+ */
+struct RollupBucket {
+  uint8_t min[SENSOR_CHANNEL_COUNT];
+  uint8_t avg[SENSOR_CHANNEL_COUNT];
+  uint8_t max[SENSOR_CHANNEL_COUNT];
+};
+
+/**
+ * @struct RollupTier
+ * @brief Ring of closed buckets plus the open bucket
+ */
+struct RollupTier {
+  const char* name;        ///< Short name ("15m", "1h")
+  uint32_t period;         ///< Bucket length (s)
+  RollupBucket* buckets;   ///< Bucket storage
+  uint16_t size;           ///< Ring capacity (buckets)
+  uint16_t head;           ///< Next bucket to write
+  uint16_t count;          ///< Closed buckets stored
+  uint32_t openStart;      ///< Start time of the open bucket (0 = none)
+  RollupAccumulator open;  ///< Open bucket statistics
+};
+
+// ==========================================
+// FUNCTION DECLARATIONS
+// ==========================================
+
+/**
+ * @brief Empty an accumulator
+ * @param acc Accumulator
+ */
+void rollupReset(RollupAccumulator* acc);
+
+/**
+ * @brief Add the channel readings taken since the last call
+ *
+ * Each channel is added once per new reading (SensorChannel::lastUpdate
+ * differs from lastFed), invalid readings are skipped.
+ *
+ * @param acc Accumulator
+ * @param lastFed Last reading added per channel, updated
+ */
+void rollupAddNewReadings(RollupAccumulator* acc, unsigned long* lastFed);
+
+/**
+ * @brief Add the statistics of an accumulator to another
+ * @param into Accumulator to extend
+ * @param from Accumulator to add (unchanged)
+ */
+void rollupMerge(RollupAccumulator* into, const RollupAccumulator* from);
+
+/**
+ * @brief Mean of a channel, rounded
+ * @param acc Accumulator
+ * @param channel Channel id
+ * @return Mean (scaled), SENSOR_VALUE_INVALID if no reading
+ */
+int16_t rollupMean(const RollupAccumulator* acc, uint8_t channel);
+
+/**
+ * @brief Clear all tiers
+ */
+void initRollups();
+
+/**
+ * @brief Feed the readings taken since the last call
+ *
+ * Call every second after pollSensors(): each channel is added once per
+ * new reading (SensorChannel::lastUpdate), then buckets that ended
+ * before now are closed.
+ *
+ * @param now Current Unix time
+ */
+void updateRollups(uint32_t now);
+
+/**
+ * @brief Get a tier
+ * @param tier Tier id
+ * @return Tier, NULL if out of range
+ */
+const RollupTier* getRollupTier(uint8_t tier);
+
+/**
+ * @brief Find a tier by name
+ * @param name Tier name ("15m", "1h")
+ * @return Tier id, ROLLUP_TIER_COUNT if unknown
+ */
+uint8_t findRollupTier(const char* name);
+
+/**
+ * @brief Write one channel of a tier as JSON
+ *
+ * {"tier":"15m","period":900,"channel":"tIn","end":..., "count":N,
+ *  "min":[...],"avg":[...],"max":[...]}, oldest bucket first; "end" is
+ * the start time of the newest closed bucket. Empty buckets are null.
+ *
+ * @param out Output (e.g. WiFiClient)
+ * @param tier Tier id
+ * @param channel Channel id (SensorChannelId)
+ */
+void printRollupJSON(Print& out, uint8_t tier, uint8_t channel);
+
+#endif // ROLLUP_H
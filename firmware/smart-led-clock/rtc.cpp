@@ -158,18 +158,46 @@ void connectWifi() {
  * @return true if sync successful, false if sync failed
  */
 bool syncTimeWithNTP() {
+  NtpSync sync;
+  beginNTPSync(&sync);
+  while (!stepNTPSync(&sync)) {
+    delay(1);
+  }
+  return sync.success;
+}
 
+void beginNTPSync(NtpSync* sync) {
   DEBUG_PRINTLN("Synchronizing with NTP server...");
   
   timeClient.begin();
   
-  int attempts = 0;
-  while (!timeClient.update() && attempts < 10) {
+  sync->attempts = 0;
+  sync->forcePending = false;
+  sync->done = false;
+  sync->success = false;
+  sync->waitUntil = millis();
+}
+
+bool stepNTPSync(NtpSync* sync) {
+  if (sync->done) return true;
+  if ((long)(millis() - sync->waitUntil) < 0) return false;
+  
+  // Alternate update() and forceUpdate(), one request per slice
+  if (sync->forcePending) {
     timeClient.forceUpdate();
-    delay(500);
-    attempts++;
+    sync->attempts++;
+    sync->forcePending = false;
+    sync->waitUntil = millis() + NTP_SYNC_RETRY_MS;
+    return false;
+  }
+  
+  if (!timeClient.update() && sync->attempts < NTP_SYNC_ATTEMPTS) {
+    sync->forcePending = true;
+    return false;
   }
   
+  sync->done = true;
+  
   if (timeClient.isTimeSet()) {
     unsigned long epochTime = timeClient.getEpochTime();
     rtc.adjust(DateTime(epochTime));
@@ -179,11 +207,12 @@ bool syncTimeWithNTP() {
     printDateTime(now);
     DEBUG_PRINTLN();
     
+    sync->success = true;
     return true;
   }
   
   DEBUG_PRINTLN("NTP sync failed");
-  return false;
+  return true;
 }
 
 /**
@@ -52,6 +52,28 @@ extern NTPClient timeClient;     ///< NTP client (pool.ntp.org)
 
 extern int wifiAttempts;            /// 
 
+// ==========================================
+// DATA STRUCTURES
+// ==========================================
+
+#define NTP_SYNC_ATTEMPTS       10      ///< Requests before giving up
+#define NTP_SYNC_RETRY_MS       500     ///< Pause between requests (ms)
+
+/**
+ * @struct NtpSync
+ * @brief State of an NTP synchronization run in slices
+ * 
+ * Each call to stepNTPSync() sends one request; the pause between
+ * requests is left to the caller.
+ */
+struct NtpSync {
+  uint8_t attempts;           ///< Requests made
+  bool forcePending;          ///< Next slice forces a request
+  bool done;
+  bool success;
+  unsigned long waitUntil;    ///< No slice before this time (millis)
+};
+
 // ==========================================
 // FUNCTION DECLARATIONS
 // ==========================================
@@ -133,7 +155,8 @@ void connectWifi();
  * Connects to NTP server (pool.ntp.org) and updates the RTC
  * with the current UTC time plus timezone offset from config.h.
  * 
- * Attempts up to 10 times (5 seconds) before giving up.
+ * Attempts up to 10 times (5 seconds) before giving up, blocking
+ * (startup). At runtime, use the NTP sync job (jobs.h).
  * On success, updates the DS3231 RTC and prints new time to Serial.
  * 
  * NTP configuration (config.h):
@@ -149,6 +172,22 @@ void connectWifi();
  */
 bool syncTimeWithNTP();
 
+/**
+ * @brief Start an NTP synchronization run in slices
+ * @param sync Run state to initialize
+ */
+void beginNTPSync(NtpSync* sync);
+
+/**
+ * @brief Do one slice of an NTP synchronization run
+ * 
+ * The RTC is updated when the time is received.
+ * 
+ * @param sync Run state
+ * @return true when the run is over (sync->success set)
+ */
+bool stepNTPSync(NtpSync* sync);
+
 /**
  * @brief Print DateTime object to Serial in formatted way
  * 
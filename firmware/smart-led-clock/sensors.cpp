@@ -11,6 +11,9 @@
  */
 
 #include "sensors.h"
+#include "rtc.h"
+#include "jsonwriter.h"
+#include "printstream.h"
 
 // ==========================================
 // GLOBAL SENSOR OBJECTS
@@ -19,130 +22,231 @@ DHT dhtIndoor(PIN_DHT_INDOOR, DHT_TYPE);
 DHT dhtOutdoor(PIN_DHT_OUTDOOR, DHT_TYPE);
 
 // ==========================================
-// FUNCTION IMPLEMENTATIONS
+// SENSOR FILTERS
+// ==========================================
+static const FilterConfig tempFilterConfig = {
+  FILTER_TEMP_MEDIAN, FILTER_TEMP_EMA_SHIFT, FILTER_TEMP_MAX_STEP, FILTER_MAX_REJECTS
+};
+static const FilterConfig humFilterConfig = {
+  FILTER_HUM_MEDIAN, FILTER_HUM_EMA_SHIFT, FILTER_HUM_MAX_STEP, FILTER_MAX_REJECTS
+};
+static const FilterConfig airFilterConfig = {
+  FILTER_AQ_MEDIAN, FILTER_AQ_EMA_SHIFT, FILTER_AQ_MAX_STEP, FILTER_MAX_REJECTS
+};
+
+SensorFilter indoorTempFilter;
+SensorFilter indoorHumFilter;
+SensorFilter outdoorTempFilter;
+SensorFilter outdoorHumFilter;
+SensorFilter airQualityFilter;
+
+// ==========================================
+// SENSOR CHANNELS
+// ==========================================
+SensorChannel sensorChannels[SENSOR_CHANNEL_COUNT] = {
+  {"tIn",  1, -400, 5,  2, SENSOR_VALUE_INVALID, false, 0},   // CH_TEMP_INDOOR  (-40..+87 °C, 0.5 °C; deadband 0.2 °C)
+  {"hIn",  1,    0, 4, 10, SENSOR_VALUE_INVALID, false, 0},   // CH_HUM_INDOOR   (0..101 %, 0.4 %; deadband 1 %)
+  {"tOut", 1, -400, 5,  3, SENSOR_VALUE_INVALID, false, 0},   // CH_TEMP_OUTDOOR (deadband 0.3 °C)
+  {"hOut", 1,    0, 4, 20, SENSOR_VALUE_INVALID, false, 0},   // CH_HUM_OUTDOOR  (deadband 2 %)
+  {"aqi",  0,    0, 2, 10, SENSOR_VALUE_INVALID, false, 0},   // CH_AQI          (0..508, 2; deadband 10)
+  {"tRtc", 1, -400, 5,  5, SENSOR_VALUE_INVALID, false, 0}    // CH_TEMP_RTC     (deadband 0.5 °C)
+};
+
+// Read-duration histogram upper bounds (µs); last bucket is open-ended
+static const uint16_t SENSOR_HIST_LIMITS_US[SENSOR_HIST_BUCKETS - 1] PROGMEM = {
+  500, 1000, 2000, 5000, 10000, 20000, 50000
+};
+
+// ==========================================
+// PRIVATE HELPER FUNCTIONS
 // ==========================================
 
 /**
- * @brief Initialize all environmental sensors
- * 
- * Initializes DHT22 sensors and MQ135 air quality sensor.
- * Sets up pin modes and prepares sensors for reading.
+ * @brief Publish a value in a result channel
  */
-void initSensors() {
-  // Initialize DHT22 sensors
-  dhtIndoor.begin();
-  dhtOutdoor.begin();
-  DEBUG_PRINTLN("DHT22 sensors initialized");
+static void publishChannel(uint8_t channel, int16_t value) {
+  sensorChannels[channel].value = value;
+  sensorChannels[channel].valid = true;
+  sensorChannels[channel].lastUpdate = millis();
+}
+
+/**
+ * @brief Mark all result channels of a slot invalid
+ */
+static void invalidateChannels(const SensorSlot* slot) {
+  for (uint8_t i = 0; i < slot->channelCount; i++) {
+    sensorChannels[slot->firstChannel + i].valid = false;
+  }
+}
+
+/**
+ * @brief Count an error without wrapping around
+ */
+static void countError(uint16_t& counter) {
+  if (counter < UINT16_MAX) counter++;
+}
+
+/**
+ * @brief Record a poll duration in the histogram
+ */
+static void recordDuration(SensorHealth& health, uint32_t us) {
+  uint8_t bucket = 0;
+  while (bucket < SENSOR_HIST_BUCKETS - 1 && us >= pgm_read_word(&SENSOR_HIST_LIMITS_US[bucket])) {
+    bucket++;
+  }
+  countError(health.durationHist[bucket]);
   
-  // Initialize air quality sensor
-  pinMode(PIN_AIR_QUALITY_SENSOR, INPUT);
-  DEBUG_PRINTLN("MQ135 air quality sensor initialized");
+  health.lastDurationUs = us;
+  if (us > health.maxDurationUs) {
+    health.maxDurationUs = us;
+  }
 }
 
 /**
- * @brief Update temperature and humidity data from DHT22 sensors
- * 
- * Reads both indoor and outdoor DHT22 sensors. For each sensor:
- * - Reads raw temperature and humidity
- * - Validates readings (checks for NaN)
- * - Calculates derived values: feels-like, dew point, humidex
- * - Updates global sensor data structures
- * - Sets validity flag and timestamp
- * 
- * If a sensor read fails, its valid flag is set to false and
- * an error message is printed to Serial.
- * 
- * Call frequency: Every 2 seconds (SENSOR_READ_INTERVAL)
+ * @brief Poll one slot and update its health
  */
-void updateSensorData() {
-  // Read indoor sensor
-  float tempIn = dhtIndoor.readTemperature();
-  float humIn = dhtIndoor.readHumidity();
-  
-  if (!isnan(tempIn) && !isnan(humIn)) {
-    indoorData.temperature = tempIn;
-    indoorData.humidity = humIn;
-    indoorData.feelsLike = dhtIndoor.computeHeatIndex(tempIn, humIn, false);
-    indoorData.dewPoint = calculateDewPoint(tempIn, humIn);
-    indoorData.humidex = calculateHumidex(tempIn, humIn);
-    indoorData.valid = true;
-    indoorData.lastUpdate = millis();
-  } else {
-    indoorData.valid = false;
-    DEBUG_PRINTLN("ERROR: Indoor sensor read failed");
-  }
-
-  // Read outdoor sensor
-  float tempOut = dhtOutdoor.readTemperature();
-  float humOut = dhtOutdoor.readHumidity();
-  
-  if (!isnan(tempOut) && !isnan(humOut)) {
-    outdoorData.temperature = tempOut;
-    outdoorData.humidity = humOut;
-    outdoorData.feelsLike = dhtOutdoor.computeHeatIndex(tempOut, humOut, false);
-    outdoorData.dewPoint = calculateDewPoint(tempOut, humOut);
-    outdoorData.humidex = calculateHumidex(tempOut, humOut);
-    outdoorData.valid = true;
-    outdoorData.lastUpdate = millis();
-  } else {
-    outdoorData.valid = false;
-    DEBUG_PRINTLN("ERROR: Outdoor sensor read failed");
+static void pollSlot(SensorSlot* slot) {
+  if (!slot->health.started) {
+    return;
+  }
+  
+  SensorHealth& health = slot->health;
+  
+  unsigned long start = micros();
+  SensorStatus status = slot->driver->poll(slot);
+  recordDuration(health, micros() - start);
+  
+  health.valid = (status == SENSOR_OK);
+  health.lastPoll = millis();
+  
+  if (status == SENSOR_OK) {
+    health.lastGood = health.lastPoll;
+    health.successes++;
+    health.consecutiveFailures = 0;
+    return;
+  }
+  
+  switch (status) {
+    case SENSOR_ERR_CHECKSUM: countError(health.checksumErrors); break;
+    case SENSOR_ERR_RANGE:    countError(health.rangeErrors);    break;
+    default:                  countError(health.nanErrors);      break;
+  }
+  countError(health.consecutiveFailures);
+  if (health.consecutiveFailures > health.maxConsecutiveFailures) {
+    health.maxConsecutiveFailures = health.consecutiveFailures;
   }
+  
+  invalidateChannels(slot);
+  DEBUG_PRINT("ERROR: ");
+  DEBUG_PRINT(slot->name);
+  DEBUG_PRINT(" sensor read failed (status ");
+  DEBUG_PRINT(status);
+  DEBUG_PRINTLN(")");
 }
 
+// ==========================================
+// DHT22 DRIVER
+// ==========================================
+
 /**
- * @brief Calculate dew point from temperature and humidity
- * 
- * Uses the Magnus-Tetens approximation formula to calculate
- * the dew point temperature. The dew point is the temperature
- * at which air becomes saturated and water vapor condenses.
- * 
- * Formula: Td = (b * α) / (a - α)
- * where α = ln(RH/100) + (a*T)/(b+T)
- * 
- * @param temp Temperature in Celsius
- * @param humidity Relative humidity in percentage (0-100)
- * @return Dew point in Celsius
+ * @struct ClimateSensor
+ * @brief DHT22 driver context
  */
-float calculateDewPoint(float temp, float humidity) {
-  float alpha = log(humidity / 100.0) + (17.27 * temp) / (237.3 + temp);
-  return (237.3 * alpha) / (17.27 - alpha);
+struct ClimateSensor {
+  DHT* dht;                  ///< Sensor object
+  SensorData* data;          ///< Display/derived data structure
+  SensorFilter* tempFilter;  ///< Temperature filter chain
+  SensorFilter* humFilter;   ///< Humidity filter chain
+};
+
+static bool startClimateSensor(SensorSlot* slot) {
+  ClimateSensor* sensor = (ClimateSensor*)slot->context;
+  sensor->dht->begin();
+  return true;
 }
 
+// A complete DHT22 frame (start + 40 bits) takes ~5 ms; a missing or
+// disconnected sensor times out on the first pulses (~2 ms). The DHT
+// library reports both as NaN, so a failure that took at least a full
+// frame is counted as a checksum error.
+#define DHT_FRAME_MIN_US        4000
+
 /**
- * @brief Calculate Canadian Humidex comfort index
+ * @brief Read one DHT22 and update its data structure
  * 
- * The humidex (humidity index) is a Canadian innovation that
- * combines temperature and humidity into one number to reflect
- * the perceived temperature. It's similar to the heat index.
+ * Raw values are kept for diagnostics; filtered values (× 10 fixed point
+ * through the filter chain) feed everything else, including the derived
+ * feels-like, dew point and humidex, computed once here and cached.
+ * Publishes temperature then humidity in the slot channels.
  * 
- * Humidex scale:
- * - < 20: No discomfort
- * - 20-29: Little discomfort
- * - 30-39: Some discomfort
- * - 40-45: Great discomfort, avoid exertion
- * - > 45: Dangerous, heat stroke possible
+ * If the read fails, the valid flag is cleared. Filter history is kept
+ * so the next good reading continues smoothly.
  * 
- * @param temp Temperature in Celsius
- * @param humidity Relative humidity in percentage (0-100)
- * @return Humidex value (unitless index)
+ * @return SENSOR_OK, or the failure class
  */
-int calculateHumidex(float temp, float humidity) {
-  float dewPoint = calculateDewPoint(temp, humidity);
-  float e = 6.11 * exp(5417.753 * (1.0/273.16 - 1.0/(273.15 + dewPoint)));
-  return (int)(temp + 0.5555 * (e - 10.0));
+static SensorStatus pollClimateSensor(SensorSlot* slot) {
+  ClimateSensor* sensor = (ClimateSensor*)slot->context;
+  SensorData& data = *sensor->data;
+  
+  // Only the first call talks to the sensor, the second uses the cached frame
+  unsigned long start = micros();
+  float temp = sensor->dht->readTemperature();
+  unsigned long busUs = micros() - start;
+  float hum = sensor->dht->readHumidity();
+  
+  if (isnan(temp) || isnan(hum)) {
+    data.valid = false;
+    return (busUs >= DHT_FRAME_MIN_US) ? SENSOR_ERR_CHECKSUM : SENSOR_ERR_NAN;
+  }
+  
+  // DHT22 range: -40..80°C, 0..100 %RH
+  if (temp < -40 || temp > 80 || hum < 0 || hum > 100) {
+    data.valid = false;
+    return SENSOR_ERR_RANGE;
+  }
+  
+  data.rawTemperature = temp;
+  data.rawHumidity = hum;
+  
+  int16_t t10 = applyFilter(sensor->tempFilter, (int16_t)lroundf(temp * 10));
+  int16_t h10 = applyFilter(sensor->humFilter, (int16_t)lroundf(hum * 10));
+  
+  data.temperature = t10 / 10.0;
+  data.humidity = h10 / 10.0;
+  computeComfortMetrics(data);
+  data.valid = true;
+  data.lastUpdate = millis();
+  
+  publishChannel(slot->firstChannel, t10);
+  publishChannel(slot->firstChannel + 1, h10);
+  return SENSOR_OK;
+}
+
+static const SensorDriver dhtDriver = {"DHT22", startClimateSensor, pollClimateSensor};
+
+// ==========================================
+// MQ135 DRIVER
+// ==========================================
+
+static bool startAirSensor(SensorSlot*) {
+  pinMode(PIN_AIR_QUALITY_SENSOR, INPUT);
+  initMQ135();
+  return true;
 }
 
 /**
- * @brief Update air quality data from MQ135 sensor
+ * @brief Update air quality data from MQ135 sensor (MQ135 driver poll)
  * 
  * Reads the MQ135 analog sensor and estimates Air Quality Index (AQI).
  * 
  * Process:
- * 1. Read raw ADC value (0-1023)
- * 2. Convert to estimated AQI (0-500 scale)
- * 3. Determine quality category (Good/Moderate/Unhealthy/etc.)
- * 4. Update LED bar if value changed significantly (>5 ADC units)
+ * 1. Read ADC at 14-bit resolution, oversampled (0-16383)
+ * 2. Filter it (spike gate, median, EMA)
+ * 3. Convert to sensor resistance Rs and compensate with indoor temp/humidity
+ * 4. Feed the R0 baseline learner
+ * 5. Rs/R0 -> CO2-equivalent ppm -> AQI (flash lookup tables)
+ * 6. Determine quality category (Good/Moderate/Unhealthy/etc.)
+ * 7. Update LED bar if AQI changed significantly
  * 
  * AQI Categories:
  * - 0-50: Good (green)
@@ -153,16 +257,31 @@ int calculateHumidex(float temp, float humidity) {
  * - 301+: Hazardous (maroon)
  * 
  * Note: MQ135 requires 24-48h warm-up for accurate readings.
- * The ADC to AQI conversion is a simple linear approximation
- * and should be calibrated for your specific environment.
+ * Compensation and baseline learning are skipped while the indoor sensor
+ * is invalid.
+ * 
+ * @return SENSOR_OK, or SENSOR_ERR_RANGE if the ADC is at a rail
  */
-void updateAirQuality() {
-  // Read analog value from MQ135
-  airQuality.rawADC = analogRead(PIN_AIR_QUALITY_SENSOR);
+static SensorStatus pollAirSensor(SensorSlot* slot) {
+  // Read and filter MQ135
+  airQuality.rawADC = readMQ135Oversampled();
+  airQuality.filteredADC = applyFilter(&airQualityFilter, airQuality.rawADC);
   
-  // Estimate AQI (simple linear mapping)
-  // TODO: Calibrate this conversion for accurate readings
-  airQuality.estimatedAQI = constrain(airQuality.rawADC / 5, 0, 500);
+  float rs = mq135Resistance(airQuality.filteredADC);
+  if (rs <= 0) {
+    airQuality.valid = false;
+    return SENSOR_ERR_RANGE;
+  }
+  
+  // Temperature/humidity compensation from indoor sensor. The baseline
+  // only learns from compensated readings: a raw Rs would skew the 24 h max
+  if (indoorData.valid) {
+    rs /= mq135CorrectionFactor(indoorData.temperature, indoorData.humidity);
+    mq135LearnBaseline(rs);
+  }
+  
+  airQuality.ppm = mq135RatioToPPM(rs / getMQ135State().r0);
+  airQuality.estimatedAQI = mq135PPMToIndex(airQuality.ppm);
   
   // Determine quality level
   if (airQuality.estimatedAQI <= 50) {
@@ -181,11 +300,258 @@ void updateAirQuality() {
   
   airQuality.valid = true;
   airQuality.lastUpdate = millis();
+  publishChannel(slot->firstChannel, airQuality.estimatedAQI);
   
   // Update LED display only if value changed significantly
   // Prevents excessive LED updates for minor fluctuations
-  if (abs(airQuality.rawADC - lastAirQualityValue) > 5) {
+  if (abs(airQuality.estimatedAQI - lastAirQualityValue) > 2) {
     updateAirQualityLEDs();
-    lastAirQualityValue = airQuality.rawADC;
+    lastAirQualityValue = airQuality.estimatedAQI;
+  }
+  
+  return SENSOR_OK;
+}
+
+static const SensorDriver mq135Driver = {"MQ135", startAirSensor, pollAirSensor};
+
+// ==========================================
+// DS3231 DIE TEMPERATURE DRIVER
+// ==========================================
+
+static bool startRtcTemperature(SensorSlot*) {
+  return true;  // RTC already initialized by initRTC()
+}
+
+/**
+ * @brief Read the DS3231 temperature register (0.25°C resolution)
+ * 
+ * The chip converts every 64 s for its own oscillator compensation,
+ * so polling faster than SENSOR_PERIOD_RTC_TEMP returns the same value.
+ */
+static SensorStatus pollRtcTemperature(SensorSlot* slot) {
+  float temp = rtc.getTemperature();
+  if (isnan(temp)) {
+    return SENSOR_ERR_NAN;
+  }
+  if (temp < -40 || temp > 85) {
+    return SENSOR_ERR_RANGE;
+  }
+  publishChannel(slot->firstChannel, (int16_t)lroundf(temp * 10));
+  return SENSOR_OK;
+}
+
+static const SensorDriver ds3231Driver = {"DS3231", startRtcTemperature, pollRtcTemperature};
+
+// ==========================================
+// SENSOR REGISTRY
+// ==========================================
+static ClimateSensor indoorClimate = {&dhtIndoor, &indoorData, &indoorTempFilter, &indoorHumFilter};
+static ClimateSensor outdoorClimate = {&dhtOutdoor, &outdoorData, &outdoorTempFilter, &outdoorHumFilter};
+
+// Phases spread the reads: indoor, air (compensated with the fresh
+// indoor reading), outdoor and RTC each land on a different second.
+static SensorSlot sensorRegistry[] = {
+  {"indoor",  &dhtDriver,    &indoorClimate,  SENSOR_PERIOD_DHT,      0, CH_TEMP_INDOOR,  2, {}},
+  {"air",     &mq135Driver,  nullptr,         SENSOR_PERIOD_AIR,      1, CH_AQI,          1, {}},
+  {"outdoor", &dhtDriver,    &outdoorClimate, SENSOR_PERIOD_DHT,      2, CH_TEMP_OUTDOOR, 2, {}},
+  {"rtc",     &ds3231Driver, nullptr,         SENSOR_PERIOD_RTC_TEMP, 3, CH_TEMP_RTC,     1, {}}
+};
+
+#define SENSOR_COUNT (sizeof(sensorRegistry) / sizeof(sensorRegistry[0]))
+
+// Seconds since boot, as seen by pollSensors()
+static uint32_t sensorTick = 0;
+
+// ==========================================
+// FUNCTION IMPLEMENTATIONS
+// ==========================================
+
+/**
+ * @brief Initialize all environmental sensors
+ * 
+ * Initializes filter chains, then starts every registered sensor.
+ * A sensor whose start() fails is never polled.
+ */
+void initSensors() {
+  // Initialize filter chains
+  initFilter(&indoorTempFilter, &tempFilterConfig);
+  initFilter(&indoorHumFilter, &humFilterConfig);
+  initFilter(&outdoorTempFilter, &tempFilterConfig);
+  initFilter(&outdoorHumFilter, &humFilterConfig);
+  initFilter(&airQualityFilter, &airFilterConfig);
+  
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    SensorSlot* slot = &sensorRegistry[i];
+    slot->health.started = slot->driver->start(slot);
+    
+    DEBUG_PRINT(slot->driver->type);
+    DEBUG_PRINT(" ");
+    DEBUG_PRINT(slot->name);
+    DEBUG_PRINTLN(slot->health.started ? " sensor initialized" : " sensor FAILED to start");
+  }
+}
+
+/**
+ * @brief Poll the sensors due on this tick
+ * 
+ * A sensor is due when (tick - phase) is a multiple of its period.
+ * 
+ * Call frequency: Once per second (RTC SQW tick)
+ */
+void pollSensors() {
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    SensorSlot* slot = &sensorRegistry[i];
+    if (sensorTick >= slot->phase && (sensorTick - slot->phase) % slot->period == 0) {
+      pollSlot(slot);
+    }
+  }
+  sensorTick++;
+}
+
+void pollAllSensors() {
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    pollSlot(&sensorRegistry[i]);
+  }
+}
+
+uint8_t getSensorCount() {
+  return SENSOR_COUNT;
+}
+
+const SensorSlot* getSensorSlot(uint8_t index) {
+  if (index >= SENSOR_COUNT) {
+    return nullptr;
+  }
+  return &sensorRegistry[index];
+}
+
+bool isSensorStale(const SensorSlot* slot) {
+  if (slot->health.lastGood == 0) {
+    return true;
+  }
+  return millis() - slot->health.lastGood > (unsigned long)slot->period * SENSOR_STALE_PERIODS * 1000UL;
+}
+
+bool printSensorHealthJSON(Print& out, uint8_t index) {
+  const SensorSlot* slot = getSensorSlot(index);
+  if (slot == nullptr) {
+    return false;
+  }
+  const SensorHealth& health = slot->health;
+  
+  // Age of last good reading in seconds, -1 if never read
+  long age = health.lastGood ? (long)((millis() - health.lastGood) / 1000) : -1;
+  
+  JsonWriter json(out);
+  json.beginObject();
+  json.key("name").string(slot->name);
+  json.key("type").string(slot->driver->type);
+  json.key("started").boolean(health.started);
+  json.key("valid").boolean(health.valid);
+  json.key("stale").boolean(isSensorStale(slot));
+  json.key("age").number(age);
+  json.key("ok").number((unsigned long)health.successes);
+  json.key("nan").number(health.nanErrors);
+  json.key("checksum").number(health.checksumErrors);
+  json.key("range").number(health.rangeErrors);
+  json.key("consecutive").number(health.consecutiveFailures);
+  json.key("maxConsecutive").number(health.maxConsecutiveFailures);
+  json.key("lastUs").number((unsigned long)health.lastDurationUs);
+  json.key("maxUs").number((unsigned long)health.maxDurationUs);
+  json.key("hist").beginArray();
+  for (uint8_t i = 0; i < SENSOR_HIST_BUCKETS; i++) {
+    json.number(health.durationHist[i]);
+  }
+  json.endArray();
+  json.endObject();
+  return true;
+}
+
+int formatSensorHealthJSON(uint8_t index, char* buffer, size_t size) {
+  BufferStream sink(buffer, size);
+  if (!printSensorHealthJSON(sink, index) || sink.overflow) {
+    return 0;
   }
-}
\ No newline at end of file
+  return sink.length;
+}
+
+int formatChannelValue(uint8_t channel, int16_t value, char* buffer, size_t size) {
+  if (value == SENSOR_VALUE_INVALID || channel >= SENSOR_CHANNEL_COUNT) {
+    return snprintf(buffer, size, "null");
+  }
+  if (sensorChannels[channel].decimals == 0) {
+    return snprintf(buffer, size, "%d", value);
+  }
+  int v = abs(value);
+  return snprintf(buffer, size, "%s%d.%d", value < 0 ? "-" : "", v / 10, v % 10);
+}
+
+void writeChannelsJSON(JsonWriter& json, const int16_t* values) {
+  char value[12];
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    formatChannelValue(ch, values[ch], value, sizeof(value));
+    json.key(sensorChannels[ch].key).raw().print(value);
+  }
+}
+
+void printChannelsJSON(Print& out, const int16_t* values) {
+  JsonWriter json(out);
+  json.beginObject();
+  writeChannelsJSON(json, values);
+  json.endObject();
+}
+
+void printChannelsJSON(Print& out) {
+  int16_t values[SENSOR_CHANNEL_COUNT];
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    const SensorChannel& channel = sensorChannels[ch];
+    values[ch] = channel.valid ? channel.value : SENSOR_VALUE_INVALID;
+  }
+  printChannelsJSON(out, values);
+}
+
+/**
+ * @brief Calculate dew point from temperature and humidity
+ * 
+ * Uses the Magnus-Tetens approximation formula to calculate
+ * the dew point temperature. The dew point is the temperature
+ * at which air becomes saturated and water vapor condenses.
+ * 
+ * Formula: Td = (b * α) / (a - α)
+ * where α = ln(RH/100) + (a*T)/(b+T)
+ * 
+ * Evaluated with the fixed-point kernel from comfort.h.
+ * Sensor updates use computeComfortMetrics() instead, which
+ * caches dew point, humidex and feels-like in one pass.
+ * 
+ * @param temp Temperature in Celsius
+ * @param humidity Relative humidity in percentage (0-100)
+ * @return Dew point in Celsius
+ */
+float calculateDewPoint(float temp, float humidity) {
+  return dewPoint10((int16_t)lroundf(temp * 10), (uint16_t)lroundf(humidity * 10)) / 10.0;
+}
+
+/**
+ * @brief Calculate Canadian Humidex comfort index
+ * 
+ * The humidex (humidity index) is a Canadian innovation that
+ * combines temperature and humidity into one number to reflect
+ * the perceived temperature. It's similar to the heat index.
+ * 
+ * Humidex scale:
+ * - < 20: No discomfort
+ * - 20-29: Little discomfort
+ * - 30-39: Some discomfort
+ * - 40-45: Great discomfort, avoid exertion
+ * - > 45: Dangerous, heat stroke possible
+ * 
+ * @param temp Temperature in Celsius
+ * @param humidity Relative humidity in percentage (0-100)
+ * @return Humidex value (unitless index)
+ */
+int calculateHumidex(float temp, float humidity) {
+  int16_t t10 = (int16_t)lroundf(temp * 10);
+  int16_t hx10 = humidex10(t10, dewPoint10(t10, (uint16_t)lroundf(humidity * 10)));
+  return (hx10 >= 0) ? (hx10 + 5) / 10 : (hx10 - 5) / 10;
+}
@@ -8,12 +8,22 @@
  * Sensors supported:
  * - DHT22: Temperature and humidity (indoor/outdoor)
  * - MQ135: Air quality sensor (VOCs, CO2, NH3)
+ * - DS3231: Die temperature (enclosure temperature)
+ * 
+ * Sensors are registered in a table of slots (sensors.cpp). Each slot
+ * pairs a driver (start/poll functions) with its own polling period and
+ * phase, so sensors are read on different seconds and adding one does
+ * not lengthen any single tick. Drivers publish into the channel table
+ * (sensorChannels, see config.h) and report their health in the slot.
  * 
  * Calculated metrics:
  * - Heat index (feels-like temperature)
  * - Dew point
  * - Humidex (Canadian humidity comfort index)
- * - Air Quality Index (AQI) estimation
+ * - Air Quality Index (AQI) estimation (calibrated, see mq135.h)
+ * 
+ * Every raw reading goes through a fixed-point filter chain (filter.h)
+ * before being published; raw values are kept for diagnostics.
  * 
  * @author F. Baillon
  * @version 1.1.0
@@ -31,7 +41,82 @@
 #include "config.h"
 #include "strings.h"
 #include "leds.h"
+#include "filter.h"
+#include "mq135.h"
+#include "comfort.h"
+
+class JsonWriter;
+
+
+// ==========================================
+// SENSOR REGISTRY
+// ==========================================
+
+#define SENSOR_HIST_BUCKETS     8     ///< Read-duration histogram buckets (see sensors.cpp)
+
+struct SensorSlot;
+
+/**
+ * @enum SensorStatus
+ * @brief Result of one driver poll
+ */
+enum SensorStatus : uint8_t {
+  SENSOR_OK = 0,           ///< Valid reading published
+  SENSOR_ERR_NAN,          ///< No data (no response / timeout, NaN)
+  SENSOR_ERR_CHECKSUM,     ///< Full frame received but rejected (checksum)
+  SENSOR_ERR_RANGE         ///< Reading outside the sensor's physical range
+};
+
+/**
+ * @struct SensorDriver
+ * @brief Uniform driver interface (one instance per sensor type)
+ */
+struct SensorDriver {
+  const char* type;                      ///< Driver type name (e.g. "DHT22")
+  bool (*start)(SensorSlot* slot);       ///< Initialize hardware, true if ready
+  SensorStatus (*poll)(SensorSlot* slot); ///< Read sensor and publish results
+};
 
+/**
+ * @struct SensorHealth
+ * @brief Runtime health and error telemetry of one sensor
+ * 
+ * Error counters saturate at 65535. Size: ~56 bytes per sensor
+ */
+struct SensorHealth {
+  bool started;              ///< start() succeeded
+  bool valid;                ///< Last poll returned valid data
+  unsigned long lastPoll;    ///< Timestamp of last poll (millis)
+  unsigned long lastGood;    ///< Timestamp of last valid poll (millis)
+  uint32_t successes;        ///< Valid reads since boot
+  uint16_t nanErrors;        ///< Reads returning no data (NaN / timeout)
+  uint16_t checksumErrors;   ///< Reads rejected by checksum
+  uint16_t rangeErrors;      ///< Reads outside physical range
+  uint16_t consecutiveFailures;    ///< Current run of failed reads
+  uint16_t maxConsecutiveFailures; ///< Longest run of failed reads
+  uint32_t lastDurationUs;   ///< Duration of last poll (µs)
+  uint32_t maxDurationUs;    ///< Longest poll (µs)
+  uint16_t durationHist[SENSOR_HIST_BUCKETS]; ///< Poll duration histogram
+};
+
+/**
+ * @struct SensorSlot
+ * @brief One registered sensor: driver, schedule, results and health
+ * 
+ * Results are published in channels [firstChannel, firstChannel +
+ * channelCount) of sensorChannels; drivers may also fill a richer
+ * structure passed through context (e.g. SensorData for DHT22).
+ */
+struct SensorSlot {
+  const char* name;            ///< Instance name (e.g. "indoor")
+  const SensorDriver* driver;  ///< Driver functions
+  void* context;               ///< Driver-specific state
+  uint16_t period;             ///< Poll period in seconds
+  uint16_t phase;              ///< Poll offset in seconds (0 - period-1)
+  uint8_t firstChannel;        ///< First result channel (SensorChannelId)
+  uint8_t channelCount;        ///< Number of result channels
+  SensorHealth health;         ///< Runtime health
+};
 
 // ==========================================
 // SENSOR OBJECTS
@@ -39,6 +124,15 @@
 extern DHT dhtIndoor;
 extern DHT dhtOutdoor;
 
+// ==========================================
+// SENSOR FILTERS
+// ==========================================
+extern SensorFilter indoorTempFilter;
+extern SensorFilter indoorHumFilter;
+extern SensorFilter outdoorTempFilter;
+extern SensorFilter outdoorHumFilter;
+extern SensorFilter airQualityFilter;
+
 // ==========================================
 // FUNCTION DECLARATIONS
 // ==========================================
@@ -49,14 +143,82 @@ extern DHT dhtOutdoor;
 void initSensors();
 
 /**
- * Update temperature and humidity data from DHT22 sensors
+ * Poll the sensors due on this tick (call once per second)
+ */
+void pollSensors();
+
+/**
+ * Poll every registered sensor now, ignoring schedules (startup reading)
+ */
+void pollAllSensors();
+
+/**
+ * Get number of registered sensors
+ * @return Number of slots in the registry
+ */
+uint8_t getSensorCount();
+
+/**
+ * Get a registered sensor
+ * @param index Slot index (0 - getSensorCount()-1)
+ * @return Pointer to slot (nullptr if out of range)
+ */
+const SensorSlot* getSensorSlot(uint8_t index);
+
+/**
+ * Check whether a sensor has gone SENSOR_STALE_PERIODS periods without a good read
+ * @param slot Sensor slot
+ * @return true if stale (or never read successfully)
+ */
+bool isSensorStale(const SensorSlot* slot);
+
+/**
+ * Print the health telemetry of one sensor as JSON object
+ * @param out Output (client, stream, buffer)
+ * @param index Slot index (0 - getSensorCount()-1)
+ * @return false if there is no such sensor (nothing printed)
+ */
+bool printSensorHealthJSON(Print& out, uint8_t index);
+
+/**
+ * Format the health telemetry of one sensor as JSON object
+ * @param index Slot index (0 - getSensorCount()-1)
+ * @param buffer Output buffer
+ * @param size Buffer size
+ * @return Number of characters written, 0 if the buffer is too small
+ */
+int formatSensorHealthJSON(uint8_t index, char* buffer, size_t size);
+
+/**
+ * Format a scaled channel value as JSON number
+ * @param channel Channel index (SensorChannelId), gives the scale
+ * @param value Scaled value (SENSOR_VALUE_INVALID prints "null")
+ * @param buffer Output buffer
+ * @param size Buffer size
+ * @return Number of characters written (snprintf semantics)
+ */
+int formatChannelValue(uint8_t channel, int16_t value, char* buffer, size_t size);
+
+/**
+ * Print current values of all channels as JSON object ({"tIn":21.5,...})
+ * @param out Output (client, stream, buffer)
+ */
+void printChannelsJSON(Print& out);
+
+/**
+ * Print given values of all channels as JSON object ({"tIn":21.5,...})
+ * @param out Output (client, stream, buffer)
+ * @param values Scaled values, one per channel (SENSOR_VALUE_INVALID prints null)
  */
-void updateSensorData();
+void printChannelsJSON(Print& out, const int16_t* values);
 
 /**
- * Update air quality data from MQ135 sensor
+ * Write values of all channels as members of the object being written
+ * ("tIn":21.5,...), e.g. next to a timestamp
+ * @param json Writer inside an object
+ * @param values Scaled values, one per channel (SENSOR_VALUE_INVALID prints null)
  */
-void updateAirQuality();
+void writeChannelsJSON(JsonWriter& json, const int16_t* values);
 
 /**
  * Calculate dew point from temperature and humidity
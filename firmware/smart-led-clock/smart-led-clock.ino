@@ -45,10 +45,12 @@
 #include "button.h"
 #include "rtc.h"
 #include "sensors.h"
+#include "rollup.h"
 #include "datalog.h"
 #include "storage.h"
 #include "webserver.h"
 #include "moon.h"
+#include "jobs.h"
 
 
 // ==========================================
@@ -60,7 +62,6 @@ WiFiClient mqttWifiClient;
 // GLOBAL VARIABLES (definitions)
 // ==========================================
 unsigned long lastSecondUpdate = 0;
-unsigned long countSensorUpdate = 0;
 unsigned short lastSecond = 61;
 unsigned short lastMinute = 61;
 unsigned short lastHour = 25;
@@ -78,9 +79,9 @@ bool isAnimationActive = false;
 int animationStep = 0;
 int animationHue = 0;
 
-SensorData indoorData = {0, 0, 0, 0, 0, false, 0};
-SensorData outdoorData = {0, 0, 0, 0, 0, false, 0};
-AirQualityData airQuality = {0, 0, "Unknown", false, 0};
+SensorData indoorData = {0, 0, 0, 0, 0, false, 0, 0, 0};
+SensorData outdoorData = {0, 0, 0, 0, 0, false, 0, 0, 0};
+AirQualityData airQuality = {0, 0, 0, 0, "Unknown", false, 0};
 
 int lastAirQualityValue = -1;
 
@@ -206,15 +207,6 @@ void setup() {
       delay(1000);
     }
 
-    // Initialize data logging
-    if (MQTT_ENABLED) {
-      initDataLog(mqttWifiClient);
-#if DEBUG_MODE
-      Serial.println("Data logging initialized");
-#endif
-      delay(1000);
-    }
-
     // Initialize EEPROM storage
     displayStartupMessage(STR_LOAD_CONFIG);
     initStorage();
@@ -228,6 +220,15 @@ void setup() {
   }
   delay(2000);
 
+  // Initialize data logging (also without WiFi: points are buffered
+  // and unsent points are restored from data flash)
+  if (MQTT_ENABLED) {
+    initDataLog(mqttWifiClient);
+#if DEBUG_MODE
+    Serial.println("Data logging initialized");
+#endif
+  }
+
   // Display current time
   DateTime now = getCurrentTime();
 #if DEBUG_MODE
@@ -240,8 +241,8 @@ void setup() {
 
   // Initial sensor reading
   displayStartupMessage(STR_READING_SENSORS);
-  updateSensorData();
-  updateAirQuality();
+  initRollups();
+  pollAllSensors();
   delay(2000);
 
   displayStartupMessage(STR_SYSTEM_READY);
@@ -295,16 +296,20 @@ void loop() {
     // =========================
     if (WEB_SERVER_ENABLED)   handleWebServer();
 
-    // Manage data logging
-    // ===================
-    if (MQTT_ENABLED)   handleDataLog();  
-
     wifiAttempts = 0;
   }
   else {
     // Try connecting to WiFi
     connectWifi();
   }
+
+  // Manage data logging (buffers while WiFi is down)
+  // ===================
+  if (MQTT_ENABLED)   handleDataLog();  
+
+  // Advance the background job (moon calibration, NTP sync) by one slice
+  // =====================================================================
+  handleJobs();
   
   // Manage LCD backlight timeout
   // ============================
@@ -348,13 +353,14 @@ void loop() {
     // =========================================
     if (lcdBacklightOn)   updateLCDDisplay(now);
 
-    // Update sensors every 5 seconds
-    // ==============================
-    if (++countSensorUpdate > SENSOR_UPDATE) {
-      countSensorUpdate = 0;
-      updateSensorData();
-      updateAirQuality();
-    }
+    // Poll the sensors due this second (per-sensor period/phase)
+    // ==========================================================
+    pollSensors();
+    updateRollups(now.unixtime());
+    
+    // Push the tick and new readings to the open web pages
+    // ====================================================
+    if (WEB_SERVER_ENABLED)   publishWebEvents(now);
     
     // Check for hour change to trigger animation
     // ==========================================
@@ -367,7 +373,7 @@ void loop() {
 #if DEBUG_MODE
       Serial.println("Monthly NTP sync triggered");
 #endif
-      syncTimeWithNTP();
+      startJob(JOB_NTP_SYNC);
     }
 
     // Update moon position at scheduled time 5:05
@@ -422,7 +428,7 @@ void loop() {
       Serial.print("Data: Buffer=");
       Serial.print(stats.bufferCount);
       Serial.print("/");
-      Serial.print(MAX_DATA_POINTS);
+      Serial.print(stats.bufferMax);
       Serial.print(" | MQTT=");
       Serial.println(stats.mqttConnected ? "CONNECTED" : "DISCONNECTED");
       Serial.println("---");
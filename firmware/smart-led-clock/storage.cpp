@@ -11,6 +11,41 @@
 #include "storage.h"
 
 
+// ==========================================
+// PRIVATE HELPER FUNCTIONS
+// ==========================================
+
+/**
+ * @brief Checksum of MQ135 baseline (sum of all bytes except checksum)
+ */
+static uint16_t calculateBaselineChecksum(const MQ135Baseline* baseline) {
+  uint16_t sum = 0;
+  const uint8_t* data = (const uint8_t*)baseline;
+  size_t size = sizeof(MQ135Baseline) - sizeof(uint16_t);  // Exclude checksum field
+  
+  for (size_t i = 0; i < size; i++) {
+    sum += data[i];
+  }
+  
+  return sum;
+}
+
+/**
+ * @brief Checksum of history cursor (sum of all bytes except checksum)
+ */
+static uint16_t calculateCursorChecksum(const HistoryCursor* cursor) {
+  uint16_t sum = 0;
+  const uint8_t* data = (const uint8_t*)cursor;
+  // Bytes before checksum: the struct is padded after it (12 bytes, checksum at 8)
+  size_t size = offsetof(HistoryCursor, checksum);
+  
+  for (size_t i = 0; i < size; i++) {
+    sum += data[i];
+  }
+  
+  return sum;
+}
+
 // ==========================================
 // FUNCTION IMPLEMENTATIONS
 // ==========================================
@@ -242,4 +277,88 @@ void getCurrentConfig(ClockConfig* config) {
   if (!loadConfig(config)) {
     createDefaultConfig(config);
   }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Load MQ135 baseline from EEPROM
+ * 
+ * @param baseline Pointer to baseline structure to fill
+ * @return true if a valid baseline was found
+ */
+bool loadMQ135Baseline(MQ135Baseline* baseline) {
+  EEPROM.get(EEPROM_MQ135_ADDR, *baseline);
+  
+  if (baseline->magic != MQ135_BASELINE_MAGIC) {
+    return false;
+  }
+  
+  if (baseline->checksum != calculateBaselineChecksum(baseline)) {
+    DEBUG_PRINTLN("Checksum mismatch in MQ135 baseline");
+    return false;
+  }
+  
+  // Reject obviously corrupted values
+  return baseline->r0 > 0 && baseline->r0 < 10000;
+}
+
+/**
+ * @brief Save MQ135 baseline to EEPROM
+ * 
+ * @param baseline Pointer to baseline structure to save
+ * @return true if saved successfully
+ */
+bool saveMQ135Baseline(const MQ135Baseline* baseline) {
+  MQ135Baseline toSave = *baseline;
+  toSave.magic = MQ135_BASELINE_MAGIC;
+  toSave.checksum = calculateBaselineChecksum(&toSave);
+  
+  EEPROM.put(EEPROM_MQ135_ADDR, toSave);
+  
+  DEBUG_PRINTLN("MQ135 baseline saved to EEPROM");
+  return true;
+}
+
+/**
+ * @brief Load data log history cursor from EEPROM
+ * 
+ * @param cursor Pointer to cursor structure to fill
+ * @return true if a valid cursor was found
+ */
+bool loadHistoryCursor(HistoryCursor* cursor) {
+  EEPROM.get(EEPROM_HISTORY_CURSOR_ADDR, *cursor);
+  
+  if (cursor->magic != HISTORY_CURSOR_MAGIC) {
+    return false;
+  }
+  
+  if (cursor->checksum != calculateCursorChecksum(cursor)) {
+    DEBUG_PRINTLN("Checksum mismatch in history cursor");
+    return false;
+  }
+  
+  return true;
+}
+
+/**
+ * @brief Save data log history cursor to EEPROM
+ * 
+ * @param cursor Pointer to cursor structure to save
+ * @return true if saved successfully
+ */
+bool saveHistoryCursor(const HistoryCursor* cursor) {
+  HistoryCursor toSave = *cursor;
+  toSave.magic = HISTORY_CURSOR_MAGIC;
+  toSave.checksum = calculateCursorChecksum(&toSave);
+  
+  EEPROM.put(EEPROM_HISTORY_CURSOR_ADDR, toSave);
+  
+  // Read back: a cursor that doesn't load replays every record at boot
+  HistoryCursor check;
+  if (!loadHistoryCursor(&check) || check.deliveredSeq != toSave.deliveredSeq) {
+    DEBUG_PRINTLN("History cursor verification failed");
+    return false;
+  }
+  
+  DEBUG_PRINTLN("History cursor saved to EEPROM");
+  return true;
+}
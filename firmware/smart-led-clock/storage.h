@@ -82,6 +82,46 @@ struct ClockConfig {
 // Magic number to identify valid config
 #define CONFIG_MAGIC 0xC10C
 
+/**
+ * @struct MQ135Baseline
+ * @brief Learned MQ135 clean-air resistance, stored apart from ClockConfig
+ * 
+ * Kept in its own EEPROM slot so that baseline updates (once a day)
+ * never rewrite the user configuration, and config layout changes
+ * never lose the baseline.
+ */
+struct MQ135Baseline {
+  uint16_t magic;              // 0xA135
+  float r0;                    // Clean-air resistance (kOhm)
+  uint16_t daysLearned;        // Baseline windows committed so far
+  uint16_t checksum;           // Sum of all bytes except checksum
+};
+
+// EEPROM address for MQ135 baseline (after ClockConfig, ~190 bytes)
+#define EEPROM_MQ135_ADDR 256
+
+// Magic number to identify valid MQ135 baseline
+#define MQ135_BASELINE_MAGIC 0xA135
+
+/**
+ * @struct HistoryCursor
+ * @brief Newest persisted data log record that was delivered
+ * 
+ * Records up to deliveredSeq are not restored at boot (see history.h).
+ * Only written when a whole block has been sent, not on every point.
+ */
+struct HistoryCursor {
+  uint16_t magic;              // 0x4843
+  uint32_t deliveredSeq;       // Sequence number of the last delivered record
+  uint16_t checksum;           // Sum of all bytes except checksum
+};
+
+// EEPROM address for history cursor (after MQ135 baseline)
+#define EEPROM_HISTORY_CURSOR_ADDR 512
+
+// Magic number to identify valid history cursor
+#define HISTORY_CURSOR_MAGIC 0x4843
+
 // ==========================================
 // FUNCTION DECLARATIONS
 // ==========================================
@@ -149,4 +189,41 @@ void applyConfig(const ClockConfig* config);
  */
 void getCurrentConfig(ClockConfig* config);
 
+/**
+ * @brief Load MQ135 baseline from EEPROM
+ * 
+ * @param baseline Pointer to baseline structure to fill
+ * @return true if a valid baseline was found
+ */
+bool loadMQ135Baseline(MQ135Baseline* baseline);
+
+/**
+ * @brief Save MQ135 baseline to EEPROM
+ * 
+ * Sets magic number and checksum before writing.
+ * 
+ * @param baseline Pointer to baseline structure to save
+ * @return true if saved successfully
+ */
+bool saveMQ135Baseline(const MQ135Baseline* baseline);
+
+/**
+ * @brief Load data log history cursor from EEPROM
+ * 
+ * @param cursor Pointer to cursor structure to fill
+ * @return true if a valid cursor was found
+ */
+bool loadHistoryCursor(HistoryCursor* cursor);
+
+/**
+ * @brief Save data log history cursor to EEPROM
+ * 
+ * Sets magic number and checksum before writing, then reads the cursor
+ * back as initHistory() will at boot.
+ * 
+ * @param cursor Pointer to cursor structure to save
+ * @return true if saved and read back
+ */
+bool saveHistoryCursor(const HistoryCursor* cursor);
+
 #endif // STORAGE_H
\ No newline at end of file
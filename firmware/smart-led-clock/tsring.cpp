@@ -0,0 +1,390 @@
+/**
+ * @file tsring.cpp
+ * @brief Compressed time-series ring buffer implementation
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#include "tsring.h"
+
+// ==========================================
+// PRIVATE HELPER FUNCTIONS
+// ==========================================
+
+static inline uint32_t zigzag(int32_t v) {
+  return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+static inline int32_t unzigzag(uint32_t u) {
+  return (int32_t)(u >> 1) ^ -(int32_t)(u & 1);
+}
+
+/**
+ * @brief Write a LEB128 varint
+ * @return Number of bytes written (1-5)
+ */
+static uint8_t putVarint(uint8_t* out, uint32_t v) {
+  uint8_t n = 0;
+  while (v >= 0x80) {
+    out[n++] = (uint8_t)(v | 0x80);
+    v >>= 7;
+  }
+  out[n++] = (uint8_t)v;
+  return n;
+}
+
+/**
+ * @brief Read a LEB128 varint and advance offset
+ */
+static uint32_t getVarint(const uint8_t* in, uint16_t& offset) {
+  uint32_t v = 0;
+  uint8_t shift = 0;
+  uint8_t b;
+  do {
+    b = in[offset++];
+    v |= (uint32_t)(b & 0x7F) << shift;
+    shift += 7;
+  } while ((b & 0x80) && shift < 35);
+  return v;
+}
+
+static TsMask validMask(const DataPoint* point) {
+  TsMask mask = 0;
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    if (point->values[ch] != SENSOR_VALUE_INVALID) {
+      mask |= (TsMask)1 << ch;
+    }
+  }
+  return mask;
+}
+
+static inline uint8_t* blockAt(TsRing* ring, uint8_t offset) {
+  return ring->blocks[(ring->first + offset) % TSRING_BLOCKS];
+}
+
+static inline const uint8_t* blockAt(const TsRing* ring, uint8_t offset) {
+  return ring->blocks[(ring->first + offset) % TSRING_BLOCKS];
+}
+
+static inline void readHeader(const uint8_t* block, TsBlockHeader* header) {
+  memcpy(header, block, sizeof(TsBlockHeader));
+}
+
+static inline void writeHeader(uint8_t* block, const TsBlockHeader* header) {
+  memcpy(block, header, sizeof(TsBlockHeader));
+}
+
+/**
+ * @brief Codec state right after a keyframe
+ */
+static void stateFromKeyframe(uint32_t timestamp, const int16_t* values, TsCodecState* state) {
+  state->timestamp = timestamp;
+  state->delta = 0;
+  state->mask = 0;
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    bool valid = values[ch] != SENSOR_VALUE_INVALID;
+    state->values[ch] = valid ? values[ch] : 0;
+    if (valid) state->mask |= (TsMask)1 << ch;
+  }
+}
+
+static inline void stateFromHeader(const TsBlockHeader* header, TsCodecState* state) {
+  stateFromKeyframe(header->timestamp, header->values, state);
+}
+
+// ==========================================
+// CODEC FUNCTIONS
+// ==========================================
+
+void tsCodecStart(TsCodecState* state, const DataPoint* keyframe) {
+  stateFromKeyframe(keyframe->timestamp, keyframe->values, state);
+}
+
+/**
+ * @brief Encode one record against the previous state
+ *
+ * State is updated only if the point is encodable.
+ */
+uint8_t tsCodecEncode(TsCodecState* state, const DataPoint* point, uint8_t* out) {
+  int32_t delta = (int32_t)(point->timestamp - state->timestamp);
+  int64_t dod = (int64_t)delta - state->delta;
+  if (dod > TSRING_MAX_DOD || dod < -TSRING_MAX_DOD) {
+    return 0;
+  }
+
+  TsMask mask = validMask(point);
+  bool maskChanged = (mask != state->mask);
+  uint8_t len = putVarint(out, (zigzag((int32_t)dod) << 1) | (maskChanged ? 1 : 0));
+  if (maskChanged) {
+    len += putVarint(out + len, mask);
+  }
+
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    if (mask & ((TsMask)1 << ch)) {
+      len += putVarint(out + len, zigzag((int32_t)point->values[ch] - state->values[ch]));
+      state->values[ch] = point->values[ch];
+    }
+  }
+
+  state->timestamp = point->timestamp;
+  state->delta = delta;
+  state->mask = mask;
+  return len;
+}
+
+/**
+ * @brief Decode one record (inverse of tsCodecEncode)
+ */
+static void decodeRecord(TsCodecState* state, const uint8_t* block, uint16_t& offset, DataPoint* point) {
+  uint32_t tag = getVarint(block, offset);
+  state->delta += unzigzag(tag >> 1);
+  state->timestamp += state->delta;
+  if (tag & 1) {
+    state->mask = (TsMask)getVarint(block, offset);
+  }
+
+  point->timestamp = state->timestamp;
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    if (state->mask & ((TsMask)1 << ch)) {
+      state->values[ch] = (int16_t)(state->values[ch] + unzigzag(getVarint(block, offset)));
+      point->values[ch] = state->values[ch];
+    } else {
+      point->values[ch] = SENSOR_VALUE_INVALID;
+    }
+  }
+}
+
+// ==========================================
+// PRIVATE RING HELPERS
+// ==========================================
+
+/**
+ * @brief Release the oldest block
+ */
+static void dropOldestBlock(TsRing* ring) {
+  TsBlockHeader header;
+  readHeader(blockAt(ring, 0), &header);
+
+  ring->count -= header.count - ring->skip;
+  ring->skip = 0;
+  ring->first = (ring->first + 1) % TSRING_BLOCKS;
+  ring->used--;
+}
+
+/**
+ * @brief Start a new block with a keyframe of the point
+ */
+static void startBlock(TsRing* ring, const DataPoint* point) {
+  if (ring->used == TSRING_BLOCKS) {
+    uint16_t before = ring->count;
+    dropOldestBlock(ring);
+    ring->evicted += before - ring->count;
+  }
+
+  TsBlockHeader header;
+  header.timestamp = point->timestamp;
+  memcpy(header.values, point->values, sizeof(header.values));
+  header.used = sizeof(TsBlockHeader);
+  header.count = 1;
+
+  ring->used++;
+  writeHeader(blockAt(ring, ring->used - 1), &header);
+  ring->count++;
+  ring->sealed = false;
+  stateFromHeader(&header, &ring->encoder);
+}
+
+// ==========================================
+// FUNCTION IMPLEMENTATIONS
+// ==========================================
+
+void tsRingClear(TsRing* ring) {
+  ring->first = 0;
+  ring->used = 0;
+  ring->skip = 0;
+  ring->count = 0;
+  ring->sealed = false;
+}
+
+/**
+ * @brief Append a point
+ *
+ * Encodes the point as a record in the newest block. A new block (with
+ * a keyframe) is started when the record does not fit or the timestamp
+ * jump is too large for the delta-of-delta field. When all blocks are in
+ * use, the oldest block is evicted first.
+ */
+bool tsRingAppend(TsRing* ring, const DataPoint* point) {
+  if (ring->used > 0 && !ring->sealed) {
+    uint8_t* block = blockAt(ring, ring->used - 1);
+    TsBlockHeader header;
+    readHeader(block, &header);
+
+    uint8_t record[TSRING_MAX_RECORD];
+    TsCodecState next = ring->encoder;
+    uint8_t len = tsCodecEncode(&next, point, record);
+
+    if (len > 0 && header.used + len <= TSRING_BLOCK_SIZE) {
+      memcpy(block + header.used, record, len);
+      header.used += len;
+      header.count++;
+      writeHeader(block, &header);
+      ring->encoder = next;
+      ring->count++;
+      return false;
+    }
+  }
+
+  startBlock(ring, point);
+  return true;
+}
+
+/**
+ * @brief Append a complete block
+ *
+ * Checks that the header is consistent (size and point count) but not
+ * the records: callers are expected to verify integrity (CRC) first.
+ */
+bool tsRingLoadBlock(TsRing* ring, const uint8_t* block) {
+  TsBlockHeader header;
+  readHeader(block, &header);
+  if (header.used < sizeof(TsBlockHeader) || header.used > TSRING_BLOCK_SIZE ||
+      header.count == 0 || header.count > header.used - sizeof(TsBlockHeader) + 1) {
+    return false;
+  }
+
+  if (ring->used == TSRING_BLOCKS) {
+    uint16_t before = ring->count;
+    dropOldestBlock(ring);
+    ring->evicted += before - ring->count;
+  }
+
+  ring->used++;
+  memcpy(blockAt(ring, ring->used - 1), block, TSRING_BLOCK_SIZE);
+  ring->count += header.count;
+  ring->sealed = true;
+  return true;
+}
+
+uint8_t tsRingBlocks(const TsRing* ring) {
+  return ring->used;
+}
+
+const uint8_t* tsRingBlock(const TsRing* ring, uint8_t offset) {
+  return blockAt(ring, offset);
+}
+
+uint8_t tsRingBlockId(const TsRing* ring, uint8_t offset) {
+  return (ring->first + offset) % TSRING_BLOCKS;
+}
+
+uint16_t tsRingCount(const TsRing* ring) {
+  return ring->count;
+}
+
+uint16_t tsRingBytesUsed(const TsRing* ring) {
+  uint16_t bytes = 0;
+  TsBlockHeader header;
+  for (uint8_t b = 0; b < ring->used; b++) {
+    readHeader(blockAt(ring, b), &header);
+    bytes += header.used;
+  }
+  return bytes;
+}
+
+/**
+ * @brief Estimated capacity at the current compression ratio
+ *
+ * Before any data is stored, returns the guaranteed minimum (every
+ * record at its worst-case size).
+ */
+uint16_t tsRingCapacity(const TsRing* ring) {
+  uint16_t bytes = tsRingBytesUsed(ring);
+  if (bytes == 0) {
+    return TSRING_BLOCKS * ((TSRING_BLOCK_SIZE - sizeof(TsBlockHeader)) / TSRING_MAX_RECORD + 1);
+  }
+  uint32_t stored = (uint32_t)ring->count + ring->skip;
+  uint32_t capacity = stored * TSRING_BYTES / bytes;
+  return (capacity > UINT16_MAX) ? UINT16_MAX : (uint16_t)capacity;
+}
+
+bool tsRingSeek(const TsRing* ring, TsCursor* cursor, uint16_t index) {
+  if (index >= ring->count) {
+    return false;
+  }
+
+  // Find the block holding the point
+  uint16_t remaining = index + ring->skip;
+  TsBlockHeader header;
+  uint8_t b = 0;
+  for (; b < ring->used; b++) {
+    readHeader(blockAt(ring, b), &header);
+    if (remaining < header.count) break;
+    remaining -= header.count;
+  }
+
+  cursor->block = b;
+  cursor->point = 0;
+  cursor->offset = sizeof(TsBlockHeader);
+
+  // Decode forward from the keyframe
+  DataPoint skipped;
+  while (remaining-- > 0) {
+    tsRingNext(ring, cursor, &skipped);
+  }
+  return true;
+}
+
+bool tsRingNext(const TsRing* ring, TsCursor* cursor, DataPoint* point) {
+  if (cursor->block >= ring->used) {
+    return false;
+  }
+
+  const uint8_t* block = blockAt(ring, cursor->block);
+  TsBlockHeader header;
+  readHeader(block, &header);
+
+  if (cursor->point == 0) {
+    stateFromHeader(&header, &cursor->state);
+    point->timestamp = header.timestamp;
+    memcpy(point->values, header.values, sizeof(point->values));
+  } else {
+    decodeRecord(&cursor->state, block, cursor->offset, point);
+  }
+
+  if (++cursor->point >= header.count) {
+    cursor->block++;
+    cursor->point = 0;
+    cursor->offset = sizeof(TsBlockHeader);
+  }
+  return true;
+}
+
+bool tsRingRead(const TsRing* ring, uint16_t index, DataPoint* point) {
+  TsCursor cursor;
+  return tsRingSeek(ring, &cursor, index) && tsRingNext(ring, &cursor, point);
+}
+
+void tsRingConsume(TsRing* ring, uint16_t count) {
+  if (count >= ring->count) {
+    tsRingClear(ring);
+    return;
+  }
+
+  ring->skip += count;
+  ring->count -= count;
+
+  TsBlockHeader header;
+  readHeader(blockAt(ring, 0), &header);
+  while (ring->skip >= header.count) {
+    ring->skip -= header.count;
+    ring->first = (ring->first + 1) % TSRING_BLOCKS;
+    ring->used--;
+    readHeader(blockAt(ring, 0), &header);
+  }
+}
@@ -0,0 +1,251 @@
+/**
+ * @file tsring.h
+ * @brief Compressed time-series ring buffer for the data log
+ *
+ * Stores DataPoints in a fixed byte budget using a block-based delta
+ * encoding:
+ *
+ * - The ring is split into TSRING_BLOCKS blocks of TSRING_BLOCK_SIZE bytes.
+ * - Each block starts with a keyframe (full timestamp and values), so a
+ *   block can be decoded on its own and eviction just drops the oldest
+ *   block (no re-encoding).
+ * - Following points are records:
+ *     varint( zigzag(delta-of-delta timestamp) << 1 | maskChanged )
+ *     [varint(validity mask)]                 only if maskChanged
+ *     varint( zigzag(value - previous) )      for each valid channel
+ *
+ * At a steady 5 min interval with filtered sensors a record is usually
+ * 1 byte of timestamp + 1 byte per channel (~7 bytes for 6 channels,
+ * against 16 bytes for a raw DataPoint). Run tools/tsring_capacity.py
+ * for a capacity estimate on synthetic data; tools/host/host_tsring.cpp
+ * checks the round trip of the compiled code and measures its throughput.
+ *
+ * Random access decodes from the block keyframe (at most one block of
+ * records); sequential reads use a cursor and are O(1) per point.
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#ifndef TSRING_H
+#define TSRING_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ==========================================
+// RING CONFIGURATION
+// ==========================================
+#ifndef TSRING_BYTES
+#define TSRING_BYTES            8192  ///< Total ring storage (RAM)
+#endif
+#define TSRING_BLOCK_SIZE       256   ///< Block size (one keyframe per block)
+#define TSRING_BLOCKS           (TSRING_BYTES / TSRING_BLOCK_SIZE)
+#define TSRING_MAX_RECORD       (5 + 3 + 3 * SENSOR_CHANNEL_COUNT) ///< Worst-case encoded record
+#define TSRING_MAX_DOD          0x1FFFFFFFL ///< Larger timestamp jumps start a new block
+
+// ==========================================
+// DATA STRUCTURES
+// ==========================================
+
+typedef uint16_t TsMask;   ///< Channel validity bitmask (bit n = channel n)
+
+/**
+ * @struct DataPoint
+ * @brief Decoded sensor data point
+ *
+ * One scaled value per sensor channel (see SensorChannelId in config.h),
+ * e.g. 21.5°C = 215. Missing values are SENSOR_VALUE_INVALID.
+ *
+ * Size: 4 + 2 × SENSOR_CHANNEL_COUNT bytes (16 bytes for 6 channels).
+ * Only used decoded; the ring stores delta-encoded records.
+ */
+struct DataPoint {
+  uint32_t timestamp;                     ///< Unix timestamp
+  int16_t values[SENSOR_CHANNEL_COUNT];   ///< Scaled channel values
+};
+
+/**
+ * @struct TsBlockHeader
+ * @brief Keyframe stored at the start of each block
+ */
+struct TsBlockHeader {
+  uint32_t timestamp;                     ///< Keyframe timestamp
+  int16_t values[SENSOR_CHANNEL_COUNT];   ///< Keyframe values (raw, may be invalid)
+  uint16_t used;                          ///< Bytes used in block, header included
+  uint16_t count;                         ///< Points in block, keyframe included
+};
+
+/**
+ * @struct TsCodecState
+ * @brief Delta coder state (shared by encoder and decoder)
+ */
+struct TsCodecState {
+  uint32_t timestamp;                     ///< Previous timestamp
+  int32_t delta;                          ///< Previous timestamp delta
+  int16_t values[SENSOR_CHANNEL_COUNT];   ///< Last valid value per channel
+  TsMask mask;                            ///< Previous validity mask
+};
+
+/**
+ * @struct TsRing
+ * @brief Compressed ring of DataPoints
+ */
+struct TsRing {
+  uint8_t blocks[TSRING_BLOCKS][TSRING_BLOCK_SIZE]; ///< Block storage
+  uint8_t first;           ///< Oldest block
+  uint8_t used;            ///< Blocks in use (0 = empty)
+  uint16_t skip;           ///< Points already consumed in the oldest block
+  uint16_t count;          ///< Readable points
+  uint32_t evicted;        ///< Points lost to eviction since boot
+  bool sealed;             ///< Newest block is closed, next append starts a new block
+  TsCodecState encoder;    ///< Encoder state of the newest block
+};
+
+/**
+ * @struct TsCursor
+ * @brief Sequential read position in a ring
+ */
+struct TsCursor {
+  uint8_t block;           ///< Block offset from the oldest block
+  uint16_t point;          ///< Point index in block
+  uint16_t offset;         ///< Byte offset of next record in block
+  TsCodecState state;      ///< Decoder state
+};
+
+// ==========================================
+// FUNCTION DECLARATIONS
+// ==========================================
+
+/**
+ * @brief Start a codec state from a keyframe
+ *
+ * The keyframe itself is stored raw (timestamp and values); following
+ * points are encoded with tsCodecEncode().
+ *
+ * @param state State to initialize
+ * @param keyframe First point
+ */
+void tsCodecStart(TsCodecState* state, const DataPoint* keyframe);
+
+/**
+ * @brief Encode one point as a delta record
+ * @param state Coder state, updated only if the point is encodable
+ * @param point Point (timestamp must not go backwards)
+ * @param out Output, at least TSRING_MAX_RECORD bytes
+ * @return Encoded length, 0 if the timestamp jump needs a new keyframe
+ */
+uint8_t tsCodecEncode(TsCodecState* state, const DataPoint* point, uint8_t* out);
+
+/**
+ * @brief Empty the ring
+ * @param ring Ring to clear
+ */
+void tsRingClear(TsRing* ring);
+
+/**
+ * @brief Append a point, evicting the oldest block when full
+ * @param ring Ring
+ * @param point Point to append (timestamps must not go backwards)
+ * @return true if a new block was started (the previous newest block,
+ *         now at tsRingBlocks() - 2, is closed)
+ */
+bool tsRingAppend(TsRing* ring, const DataPoint* point);
+
+/**
+ * @brief Append a complete block (e.g. restored from persistent storage)
+ *
+ * The block is sealed: the next point starts a new block.
+ *
+ * @param ring Ring
+ * @param block TSRING_BLOCK_SIZE bytes starting with a TsBlockHeader
+ * @return false if the block header is inconsistent
+ */
+bool tsRingLoadBlock(TsRing* ring, const uint8_t* block);
+
+/**
+ * @brief Number of blocks in use
+ * @param ring Ring
+ * @return Blocks in use (0 - TSRING_BLOCKS)
+ */
+uint8_t tsRingBlocks(const TsRing* ring);
+
+/**
+ * @brief Raw bytes of a block
+ * @param ring Ring
+ * @param offset Block offset from the oldest block
+ * @return Pointer to TSRING_BLOCK_SIZE bytes
+ */
+const uint8_t* tsRingBlock(const TsRing* ring, uint8_t offset);
+
+/**
+ * @brief Storage index of a block (stable while the block is in the ring)
+ * @param ring Ring
+ * @param offset Block offset from the oldest block
+ * @return Index in ring->blocks (0 - TSRING_BLOCKS - 1)
+ */
+uint8_t tsRingBlockId(const TsRing* ring, uint8_t offset);
+
+/**
+ * @brief Number of readable points
+ * @param ring Ring
+ * @return Point count
+ */
+uint16_t tsRingCount(const TsRing* ring);
+
+/**
+ * @brief Bytes used by encoded points (headers included)
+ * @param ring Ring
+ * @return Used bytes (0 - TSRING_BYTES)
+ */
+uint16_t tsRingBytesUsed(const TsRing* ring);
+
+/**
+ * @brief Estimated capacity in points at the current compression ratio
+ * @param ring Ring
+ * @return Estimated number of points that fit in TSRING_BYTES
+ */
+uint16_t tsRingCapacity(const TsRing* ring);
+
+/**
+ * @brief Position a cursor on a point
+ * @param ring Ring
+ * @param cursor Cursor to initialize
+ * @param index Point index (0 = oldest readable point)
+ * @return false if index is out of range
+ */
+bool tsRingSeek(const TsRing* ring, TsCursor* cursor, uint16_t index);
+
+/**
+ * @brief Read the point under the cursor and advance
+ * @param ring Ring (must not be modified between seek and next)
+ * @param cursor Cursor from tsRingSeek()
+ * @param point Decoded point
+ * @return false when past the newest point
+ */
+bool tsRingNext(const TsRing* ring, TsCursor* cursor, DataPoint* point);
+
+/**
+ * @brief Read one point (random access)
+ * @param ring Ring
+ * @param index Point index (0 = oldest readable point)
+ * @param point Decoded point
+ * @return false if index is out of range
+ */
+bool tsRingRead(const TsRing* ring, uint16_t index, DataPoint* point);
+
+/**
+ * @brief Drop the oldest points (e.g. once they were sent)
+ *
+ * Blocks are released once all their points are consumed.
+ *
+ * @param ring Ring
+ * @param count Number of points to drop
+ */
+void tsRingConsume(TsRing* ring, uint16_t count);
+
+#endif // TSRING_H
@@ -0,0 +1,585 @@
+/**
+ * @file webassets.h
+ * @brief Web pages, gzip-compressed (generated - do not edit)
+ *
+ * Generated by tools/gen_web_assets.py from the files in web/: edit the
+ * sources and run the script again.
+ *
+ * - WEBASSET_HOME: web/index.html, 10103 -> 2757 bytes
+ * - WEBASSET_CONFIG: web/config.html, 10134 -> 2125 bytes
+ * - WEBASSET_MOON: web/moon.html, 13494 -> 3309 bytes
+ * - WEBASSET_STYLE: web/style.css, 509 -> 280 bytes
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#ifndef WEBASSETS_H
+#define WEBASSETS_H
+
+#include <Arduino.h>
+
+/**
+ * @struct WebAsset
+ * @brief Document sent with an ETag (static file in flash, or cached in RAM)
+ */
+struct WebAsset {
+  const uint8_t* data;            ///< Bytes as sent (flash or RAM)
+  uint32_t length;                ///< Number of bytes
+  const char* etag;               ///< Quoted entity tag
+  const char* contentType;        ///< MIME type of the uncompressed file
+  const char* encoding;           ///< Content-Encoding ("gzip"), NULL if none
+};
+
+static const uint8_t WEBASSET_HOME_DATA[2757] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x1a, 0x4b, 0x6f, 0x1b, 0xc7,
+  0xf9, 0xae, 0x5f, 0x31, 0xd9, 0x20, 0xd9, 0xa5, 0x4d, 0x2e, 0x1f, 0x7a, 0xd4, 0xa6, 0x48, 0x05,
+  0xaa, 0x2c, 0xa1, 0x2a, 0xe4, 0xd8, 0xb1, 0x14, 0x14, 0x85, 0x40, 0x14, 0xc3, 0xdd, 0x21, 0x77,
+  0xac, 0xe5, 0x2c, 0x3d, 0x3b, 0xcb, 0x47, 0x6d, 0x1f, 0x0a, 0xf4, 0x58, 0xa0, 0x3d, 0xa4, 0x28,
+  0xd2, 0x4b, 0x7b, 0x6c, 0x2e, 0x45, 0x8e, 0x3d, 0x47, 0xff, 0xa4, 0x7f, 0xa0, 0xfd, 0x09, 0xfd,
+  0xe6, 0x41, 0x72, 0xb9, 0x1c, 0x92, 0x92, 0x6c, 0x24, 0xa8, 0xfc, 0xd0, 0xee, 0xcc, 0x37, 0xdf,
+  0xfb, 0x39, 0x64, 0xeb, 0x93, 0x67, 0x2f, 0x4e, 0xae, 0x7e, 0xfd, 0xf2, 0x14, 0x45, 0x62, 0x10,
+  0x1f, 0xed, 0xb4, 0x66, 0xbf, 0x08, 0x0e, 0x8f, 0x76, 0x10, 0xfc, 0xb4, 0x06, 0x44, 0x60, 0x14,
+  0x44, 0x98, 0xa7, 0x44, 0xb4, 0x9d, 0xaf, 0xaf, 0xce, 0x2a, 0x4f, 0x9c, 0xfc, 0x16, 0xc3, 0x03,
+  0xd2, 0x76, 0x46, 0x94, 0x8c, 0x87, 0x09, 0x17, 0x0e, 0x0a, 0x12, 0x26, 0x08, 0x03, 0xd0, 0x31,
+  0x0d, 0x45, 0xd4, 0x0e, 0xc9, 0x88, 0x06, 0xa4, 0xa2, 0x5e, 0xca, 0x88, 0x32, 0x2a, 0x28, 0x8e,
+  0x2b, 0x69, 0x80, 0x63, 0xd2, 0xae, 0xfb, 0xb5, 0x19, 0x2a, 0x41, 0x45, 0x4c, 0x8e, 0x2e, 0x07,
+  0x98, 0x0b, 0x74, 0x71, 0xfa, 0x0c, 0x9d, 0xc4, 0x49, 0x70, 0xd3, 0xaa, 0xea, 0x65, 0x0d, 0x12,
+  0x53, 0x76, 0x83, 0x38, 0x89, 0xdb, 0x4e, 0x2a, 0xa6, 0x31, 0x49, 0x23, 0x42, 0x80, 0x5c, 0xc4,
+  0x49, 0xaf, 0xed, 0x54, 0xd5, 0x92, 0x1f, 0xa4, 0xe9, 0x0c, 0xa1, 0x5a, 0xd0, 0xcf, 0xf2, 0xc7,
+  0x4f, 0x09, 0x4b, 0x13, 0x5e, 0xe9, 0x73, 0x1a, 0xa2, 0xb7, 0xf3, 0x65, 0xf9, 0x13, 0xd2, 0x74,
+  0x18, 0xe3, 0x69, 0x13, 0xc9, 0xbd, 0xc3, 0xa5, 0x2d, 0xb9, 0x52, 0x11, 0x64, 0x00, 0xfb, 0x82,
+  0x54, 0x82, 0x24, 0xce, 0x06, 0x2c, 0x6d, 0x02, 0x13, 0x43, 0x82, 0x85, 0x87, 0x33, 0x91, 0x54,
+  0x7a, 0x54, 0x94, 0xd1, 0x80, 0xb2, 0x01, 0x9e, 0x78, 0x8d, 0x5a, 0x6d, 0x38, 0x29, 0xa3, 0x7a,
+  0x8f, 0x97, 0x4a, 0x05, 0x44, 0x78, 0xd8, 0x44, 0x0d, 0xd8, 0x5d, 0x5e, 0x06, 0x71, 0xfb, 0x94,
+  0x55, 0x44, 0x02, 0xbb, 0xbb, 0x4b, 0xbb, 0xef, 0x57, 0x38, 0x0f, 0x30, 0x2f, 0x72, 0xde, 0xc5,
+  0xc1, 0x4d, 0x9f, 0x27, 0x19, 0x0b, 0x9b, 0xe8, 0xd3, 0xde, 0x53, 0xf9, 0x67, 0x19, 0xff, 0x10,
+  0x87, 0x21, 0x65, 0x7d, 0x1b, 0xe9, 0x6e, 0xc2, 0x43, 0xc2, 0x2b, 0x1c, 0x87, 0x34, 0x03, 0x91,
+  0x9e, 0xac, 0xd9, 0x8f, 0x49, 0x4f, 0x34, 0xd1, 0xde, 0x70, 0x82, 0xd2, 0x24, 0x06, 0xd5, 0x7d,
+  0xba, 0x77, 0x72, 0x7c, 0xb6, 0x5f, 0xdb, 0xc4, 0x68, 0x8c, 0xbb, 0x24, 0x2e, 0x70, 0xda, 0x03,
+  0xa7, 0xa8, 0xa4, 0xf4, 0xb7, 0xa4, 0x89, 0xea, 0x7b, 0x45, 0x52, 0xa0, 0xd7, 0x84, 0x83, 0x04,
+  0x07, 0x07, 0x07, 0x56, 0xf5, 0x74, 0x13, 0x21, 0x92, 0x41, 0x13, 0xed, 0x6f, 0x56, 0xd0, 0x08,
+  0xc7, 0x19, 0x59, 0x4f, 0xb7, 0xb1, 0x22, 0xa2, 0xda, 0x1c, 0x13, 0xda, 0x8f, 0x40, 0xc4, 0x6e,
+  0x12, 0x87, 0x76, 0xb6, 0x76, 0x77, 0x77, 0x37, 0x91, 0xcd, 0xc0, 0xa5, 0x37, 0x48, 0xfb, 0x64,
+  0x9d, 0xb4, 0x4f, 0x9f, 0x3e, 0xb5, 0xa2, 0xcd, 0x86, 0xa1, 0x74, 0x36, 0x41, 0x07, 0x45, 0x61,
+  0x04, 0x99, 0x88, 0x0a, 0x8e, 0x69, 0x9f, 0x35, 0x51, 0x00, 0x21, 0x46, 0xf8, 0x1d, 0x30, 0x17,
+  0xdd, 0xac, 0xb1, 0xce, 0xcd, 0x20, 0x8e, 0x38, 0x04, 0x55, 0xa5, 0x2b, 0xd8, 0xba, 0x00, 0xe9,
+  0xca, 0xa0, 0x5c, 0x46, 0xad, 0xe2, 0x5a, 0x62, 0x5d, 0xe3, 0xdb, 0x9a, 0x20, 0x92, 0xa1, 0xb2,
+  0xc6, 0x35, 0xeb, 0x8d, 0x15, 0xd7, 0xcb, 0xbb, 0x75, 0xd1, 0xdf, 0x72, 0x82, 0x8e, 0x23, 0x2a,
+  0x88, 0xcd, 0x6b, 0x9b, 0x88, 0x25, 0x8c, 0x6c, 0xf4, 0xf7, 0xfd, 0x15, 0xb3, 0x64, 0x3c, 0x95,
+  0x48, 0x87, 0x09, 0x5d, 0xd5, 0x6c, 0xde, 0xa0, 0x07, 0xdb, 0xf5, 0xd7, 0x8c, 0x92, 0x11, 0xe1,
+  0x9b, 0x82, 0x75, 0x6f, 0x1f, 0xd7, 0xf6, 0xec, 0xf6, 0x97, 0xa9, 0x56, 0xfc, 0xd8, 0xd1, 0x7e,
+  0xa7, 0x44, 0x94, 0xe3, 0x2c, 0xc0, 0x6c, 0x84, 0xd3, 0x02, 0x83, 0xc6, 0x17, 0xea, 0xb5, 0xda,
+  0x67, 0xcb, 0xd8, 0x23, 0x13, 0x63, 0x8d, 0xc6, 0x66, 0xd4, 0x31, 0xe9, 0x13, 0x16, 0x7e, 0xcc,
+  0xd4, 0xa1, 0x04, 0xb2, 0xe4, 0x8d, 0x56, 0xd5, 0xd4, 0x87, 0x56, 0x55, 0x97, 0xba, 0x56, 0x37,
+  0x09, 0xa7, 0xa6, 0x74, 0x84, 0x74, 0x84, 0x82, 0x18, 0xa7, 0x69, 0xdb, 0x91, 0xc5, 0x0c, 0x53,
+  0x46, 0xb8, 0xb3, 0x28, 0x25, 0xad, 0xa8, 0x7e, 0xf4, 0xdf, 0xbf, 0xfd, 0xf9, 0x4f, 0x68, 0xa5,
+  0x5a, 0xc1, 0xc6, 0x1c, 0x6a, 0x01, 0x9e, 0x43, 0xc7, 0xf0, 0x28, 0x87, 0x48, 0xed, 0xe2, 0x59,
+  0x05, 0x03, 0x52, 0x3d, 0xda, 0x77, 0x8e, 0xfe, 0xfd, 0xd7, 0x6f, 0xff, 0xf3, 0xaf, 0x3f, 0xa2,
+  0x13, 0xf5, 0x9a, 0x71, 0x2c, 0x68, 0xc2, 0x5a, 0x55, 0x7c, 0x84, 0xde, 0xa1, 0x35, 0x27, 0x07,
+  0x49, 0xc2, 0x1c, 0x60, 0xe9, 0x0f, 0xdf, 0xa2, 0x97, 0x11, 0x4e, 0x09, 0xba, 0xc8, 0x18, 0xa6,
+  0x9c, 0xc8, 0x53, 0x0b, 0x36, 0xaa, 0xc0, 0xc7, 0x16, 0xf6, 0x72, 0x35, 0xb2, 0xc8, 0xe6, 0x2a,
+  0x94, 0xf4, 0x83, 0x02, 0xd4, 0x1a, 0x48, 0x55, 0x10, 0x9c, 0xa3, 0x2b, 0xa8, 0xa3, 0xb7, 0xdf,
+  0x81, 0x40, 0x19, 0x27, 0xe8, 0x9c, 0x09, 0x78, 0xa6, 0x24, 0x93, 0x6c, 0x2e, 0x71, 0xb6, 0x01,
+  0x91, 0xca, 0xf0, 0x0e, 0xa2, 0x61, 0xdb, 0x91, 0x45, 0xf9, 0x1c, 0xa4, 0xae, 0x54, 0xee, 0x7e,
+  0x5c, 0x66, 0x6a, 0xe7, 0xe8, 0x87, 0xef, 0x4f, 0x2c, 0x47, 0x2c, 0x4b, 0x1f, 0x5d, 0x01, 0xbf,
+  0xc8, 0x06, 0x34, 0xa4, 0x20, 0xf7, 0x07, 0x4b, 0x1f, 0x65, 0x83, 0x87, 0x09, 0xff, 0xd9, 0x4f,
+  0x24, 0xfa, 0x92, 0xed, 0x4f, 0x27, 0x1f, 0x6e, 0xfb, 0x17, 0x99, 0xf8, 0x7f, 0x35, 0xfe, 0x87,
+  0x8a, 0x0f, 0xc6, 0x7f, 0xa0, 0xf4, 0x3f, 0x95, 0xf5, 0xbf, 0xca, 0xa0, 0x6b, 0x91, 0xa2, 0x87,
+  0x04, 0xc5, 0xee, 0x31, 0xe5, 0xc8, 0x3b, 0xfe, 0xea, 0xbc, 0xf4, 0x20, 0xe9, 0xf1, 0x1b, 0xfa,
+  0x00, 0xd1, 0x67, 0x47, 0x35, 0x27, 0xd3, 0x35, 0x18, 0x7e, 0x14, 0x3f, 0x78, 0xb8, 0xdb, 0x43,
+  0x47, 0xe8, 0x20, 0x55, 0xb7, 0xda, 0x4e, 0xbe, 0xb1, 0x95, 0x45, 0x55, 0x4a, 0xd4, 0x54, 0x7f,
+  0xb7, 0xcb, 0x75, 0x97, 0x52, 0xb0, 0xa8, 0xf5, 0xdb, 0x2b, 0xc1, 0x4c, 0x32, 0x9a, 0x8a, 0x84,
+  0xd3, 0x37, 0xd0, 0x84, 0xef, 0x3d, 0x41, 0x11, 0xf2, 0x06, 0xc9, 0x94, 0x30, 0x46, 0x52, 0x54,
+  0xdf, 0x97, 0x13, 0x92, 0xcd, 0xde, 0x2d, 0xd3, 0x48, 0x28, 0xbf, 0x56, 0xe7, 0xa7, 0x27, 0x92,
+  0xb2, 0xa3, 0x9b, 0x89, 0xb6, 0xf3, 0xb3, 0xbd, 0x9a, 0x63, 0xfa, 0x87, 0xb6, 0x03, 0xfd, 0x83,
+  0x73, 0xd4, 0xaa, 0xea, 0x33, 0xeb, 0xd9, 0xca, 0x37, 0x13, 0x36, 0xdb, 0xa4, 0x43, 0xcc, 0x66,
+  0x7a, 0x9c, 0x35, 0x10, 0xa6, 0xcd, 0x84, 0xf2, 0xfb, 0xcd, 0xef, 0x72, 0xe9, 0x19, 0xfa, 0x04,
+  0x00, 0x3e, 0x42, 0x9f, 0xb3, 0x6e, 0x3a, 0x3c, 0xbc, 0x1b, 0xaa, 0x46, 0xfd, 0xe9, 0xc1, 0xd9,
+  0xae, 0x41, 0xb5, 0x08, 0xf6, 0x3b, 0xa1, 0xca, 0xe9, 0xe1, 0x9c, 0xf5, 0x12, 0xed, 0xa7, 0xea,
+  0xdc, 0x83, 0x0c, 0xda, 0xcd, 0x60, 0x72, 0x62, 0x33, 0xbd, 0xe4, 0x3a, 0x54, 0x07, 0x25, 0x2c,
+  0x88, 0x69, 0x70, 0xd3, 0x76, 0xf4, 0xbc, 0xf1, 0x0c, 0x0b, 0xec, 0x95, 0x0e, 0x91, 0x7e, 0xd3,
+  0xa6, 0x9c, 0x7a, 0x25, 0xd9, 0x56, 0x7c, 0xf3, 0x7b, 0xf4, 0x0a, 0xf7, 0x38, 0xbe, 0xfd, 0x67,
+  0x10, 0x51, 0x10, 0x43, 0x23, 0xdd, 0xe2, 0x3f, 0xb9, 0x29, 0xa6, 0x60, 0x82, 0x67, 0x84, 0x33,
+  0x7a, 0xfb, 0x0f, 0xa8, 0x03, 0x03, 0x0a, 0xbd, 0xca, 0xed, 0xdf, 0xd1, 0xeb, 0x24, 0x03, 0xbd,
+  0x2d, 0x14, 0x00, 0x18, 0xc4, 0xd7, 0xea, 0xbc, 0x4d, 0xfe, 0x9c, 0xb0, 0xb9, 0x47, 0x33, 0xf4,
+  0x07, 0x9c, 0x0e, 0xc5, 0x02, 0xb6, 0x97, 0xb1, 0x40, 0xf6, 0x4f, 0x28, 0x2f, 0x64, 0xb1, 0xbf,
+  0x24, 0x22, 0x88, 0x3c, 0xb7, 0x8a, 0x87, 0x14, 0x9a, 0x42, 0xa8, 0x50, 0xa9, 0x5b, 0x5a, 0xb1,
+  0x8e, 0x2f, 0x22, 0xc2, 0x3c, 0xd0, 0xde, 0x30, 0x61, 0xc0, 0x74, 0xfb, 0x08, 0xcd, 0x9e, 0xfd,
+  0xd7, 0x69, 0xc2, 0xbc, 0xd2, 0xba, 0x23, 0x40, 0x16, 0x4b, 0xf0, 0xb7, 0x2b, 0xfb, 0x6a, 0xb2,
+  0x4a, 0x82, 0x6c, 0x00, 0x93, 0x9c, 0xdf, 0x27, 0xe2, 0x34, 0x26, 0xf2, 0xf1, 0xe7, 0xd3, 0xf3,
+  0xd0, 0x73, 0x75, 0x7b, 0xe3, 0x96, 0x7c, 0x39, 0xf3, 0x9d, 0xe8, 0x1b, 0x15, 0xd4, 0x46, 0x12,
+  0x9b, 0x4f, 0x59, 0x98, 0x24, 0xdc, 0x97, 0x20, 0xbe, 0x48, 0xce, 0xe8, 0x84, 0x84, 0x5e, 0xbd,
+  0x74, 0x78, 0x3f, 0x02, 0xaa, 0x83, 0x58, 0xc1, 0xff, 0x1c, 0x8b, 0xc8, 0x57, 0x23, 0x86, 0x97,
+  0x27, 0x15, 0xe9, 0xda, 0x35, 0xbd, 0x2f, 0x11, 0x53, 0xa8, 0xed, 0x62, 0x24, 0x99, 0xf8, 0x38,
+  0x72, 0xd8, 0x28, 0x14, 0x05, 0x99, 0x11, 0x7b, 0xa8, 0x24, 0x50, 0x3a, 0xec, 0x52, 0x40, 0x9f,
+  0x6d, 0x6a, 0x8a, 0x0f, 0x30, 0xf7, 0xc7, 0x6a, 0x0e, 0x6f, 0x45, 0xfe, 0x46, 0xff, 0xbe, 0xaf,
+  0x01, 0x20, 0xfc, 0xec, 0xa8, 0xe5, 0xce, 0x3d, 0x91, 0x2d, 0xc2, 0x72, 0x05, 0x25, 0x23, 0x63,
+  0x04, 0xc1, 0x45, 0x3c, 0xd8, 0x48, 0x2e, 0x12, 0x79, 0xb9, 0x77, 0x05, 0x04, 0x2e, 0x05, 0x87,
+  0x79, 0xd4, 0x73, 0x7b, 0xbc, 0x72, 0xf6, 0xca, 0xb5, 0xe8, 0xfc, 0xbd, 0x25, 0x6c, 0x02, 0x2c,
+  0xe3, 0x91, 0x70, 0x9e, 0xf0, 0xf5, 0x81, 0x03, 0xc3, 0x52, 0x9a, 0xc4, 0xc4, 0x57, 0x60, 0x9e,
+  0x7b, 0x2a, 0x7f, 0x35, 0xdd, 0x32, 0x52, 0xef, 0x6b, 0x8c, 0x0b, 0x4c, 0x71, 0xa1, 0x60, 0x21,
+  0x1b, 0xcb, 0x56, 0x04, 0x90, 0x30, 0x32, 0x81, 0xf4, 0x60, 0x67, 0xcd, 0x36, 0xa8, 0xce, 0x1f,
+  0xaa, 0x55, 0x74, 0x49, 0x20, 0xaf, 0xa7, 0xa8, 0xc7, 0x93, 0x01, 0x52, 0xd9, 0x83, 0x27, 0x71,
+  0x9c, 0x0d, 0x91, 0xa7, 0xcb, 0x1d, 0xc2, 0x23, 0xc2, 0x71, 0x9f, 0xa4, 0x65, 0xd4, 0x00, 0x9d,
+  0x4f, 0xd3, 0x52, 0x13, 0x72, 0x4d, 0xa8, 0xe1, 0x09, 0xec, 0x4d, 0xf3, 0xc8, 0x38, 0x4c, 0xa1,
+  0xa0, 0xab, 0x32, 0xca, 0x58, 0x4c, 0x6f, 0x88, 0x46, 0x68, 0x2a, 0x81, 0xbc, 0xe8, 0x08, 0x22,
+  0xc8, 0xd8, 0xf1, 0x14, 0x45, 0x49, 0x1c, 0xa6, 0x00, 0x14, 0x92, 0x98, 0x02, 0x0e, 0xc0, 0xa7,
+  0x2e, 0x2c, 0xd2, 0xd5, 0x94, 0xa7, 0xb9, 0xd1, 0x4c, 0x7a, 0xfa, 0x25, 0x2d, 0xe6, 0x3e, 0xa9,
+  0x46, 0x81, 0x52, 0x2d, 0x48, 0x1b, 0xbd, 0x45, 0x22, 0x6d, 0xa2, 0xeb, 0x0e, 0x7a, 0x7f, 0x68,
+  0x01, 0xeb, 0x51, 0x9e, 0x4a, 0x63, 0x1b, 0x5c, 0xd7, 0xb5, 0x4e, 0xf1, 0x92, 0x04, 0xfa, 0xba,
+  0x98, 0x08, 0x44, 0x01, 0xa8, 0x76, 0x08, 0xbf, 0x5a, 0xfa, 0x8c, 0x1f, 0x40, 0x20, 0x0a, 0x58,
+  0x78, 0xfc, 0xb8, 0x64, 0xb1, 0xa7, 0x26, 0xef, 0x8b, 0xd4, 0x1f, 0x66, 0x69, 0xe4, 0xe9, 0x23,
+  0xf2, 0x1e, 0xa0, 0x82, 0xbc, 0xdc, 0x79, 0x78, 0xad, 0xc3, 0x3f, 0x5a, 0x42, 0x8f, 0x0c, 0xda,
+  0x21, 0x1c, 0x4c, 0xc2, 0x82, 0xed, 0xde, 0x2f, 0xbd, 0x19, 0x5e, 0x7d, 0xe0, 0xed, 0x14, 0x83,
+  0x5b, 0x29, 0x97, 0xd2, 0x04, 0xaf, 0xb9, 0xbc, 0x75, 0x00, 0x0f, 0x88, 0x3b, 0x52, 0x28, 0x1f,
+  0x8f, 0xfa, 0x05, 0x54, 0x9c, 0xc0, 0xb8, 0xc2, 0x0c, 0xf8, 0x46, 0x6f, 0x98, 0x2b, 0x3d, 0xe4,
+  0x78, 0x3c, 0x2b, 0x9e, 0xfa, 0x9c, 0x5d, 0xe5, 0xa6, 0xed, 0x69, 0x6f, 0x48, 0x6c, 0xb9, 0x6e,
+  0xa8, 0xe8, 0x9f, 0x06, 0x87, 0x98, 0x00, 0x02, 0x8d, 0x49, 0x1e, 0x57, 0xe1, 0x38, 0x01, 0x0f,
+  0x6f, 0x84, 0xf6, 0x03, 0xe3, 0x05, 0xb8, 0xb9, 0x8e, 0x8f, 0x16, 0x2b, 0xba, 0xc7, 0x2a, 0xcb,
+  0x4b, 0x24, 0x58, 0xdc, 0x2d, 0xde, 0xb8, 0x89, 0x89, 0x1f, 0xc4, 0x04, 0xf3, 0x57, 0x24, 0x10,
+  0x5e, 0xad, 0x8c, 0xe0, 0xef, 0x18, 0xce, 0x97, 0x56, 0xc1, 0x64, 0x67, 0x0a, 0x18, 0x5c, 0x79,
+  0xaf, 0x87, 0x8e, 0x39, 0xc5, 0xb1, 0x6b, 0x01, 0xa2, 0x71, 0x7c, 0x29, 0xdb, 0x26, 0x09, 0x29,
+  0x2f, 0x2c, 0x0b, 0x30, 0x16, 0xee, 0x63, 0xca, 0x94, 0x93, 0x5e, 0x5f, 0xbb, 0x02, 0x4a, 0x57,
+  0x19, 0xce, 0xe9, 0xa6, 0xcd, 0xed, 0x94, 0x11, 0xac, 0xc9, 0x32, 0x20, 0x17, 0x75, 0xfb, 0xe5,
+  0x76, 0x3a, 0x36, 0x15, 0xa8, 0x76, 0x5a, 0x62, 0x51, 0xd8, 0xfc, 0x5e, 0x8c, 0xc5, 0x73, 0x3c,
+  0xf4, 0xbc, 0xeb, 0x1b, 0x32, 0xed, 0x94, 0x72, 0xce, 0xa1, 0xde, 0x25, 0x9b, 0x82, 0x70, 0x6f,
+  0x24, 0x37, 0x46, 0xe8, 0x93, 0x36, 0x64, 0xba, 0x2c, 0x8e, 0x0b, 0x42, 0xd3, 0x1e, 0xf2, 0x16,
+  0x3e, 0x1c, 0x13, 0xd6, 0x17, 0x11, 0xb8, 0x7e, 0x03, 0xbd, 0x7b, 0x67, 0xe8, 0xcd, 0x16, 0xdb,
+  0x80, 0xa0, 0x66, 0x0b, 0x81, 0x99, 0x4a, 0xae, 0x94, 0xfd, 0x8e, 0xb3, 0x20, 0x63, 0x04, 0x5c,
+  0x83, 0xb1, 0xdb, 0xef, 0x08, 0x04, 0x38, 0xa4, 0x2b, 0xd0, 0xd4, 0x20, 0x91, 0xde, 0xe1, 0x2a,
+  0x13, 0x49, 0xd3, 0x55, 0x51, 0xc3, 0x92, 0xb7, 0xb4, 0xd3, 0x6e, 0x8a, 0x09, 0x8b, 0x5a, 0x44,
+  0x0d, 0x54, 0x32, 0x97, 0x01, 0x22, 0xbb, 0x8c, 0x44, 0x7d, 0x69, 0x69, 0x45, 0x40, 0x88, 0x46,
+  0xbb, 0x86, 0x9f, 0x43, 0xea, 0x33, 0x05, 0xb8, 0x17, 0x43, 0xcd, 0xf5, 0xd4, 0x23, 0x24, 0x44,
+  0xcf, 0xf7, 0x7d, 0xad, 0x8f, 0x52, 0xa9, 0x0c, 0x70, 0x78, 0x32, 0x83, 0x0b, 0x08, 0x8d, 0x0d,
+  0x18, 0x9e, 0xe4, 0xc1, 0xd0, 0x63, 0x54, 0xb7, 0x11, 0x91, 0x27, 0x85, 0x34, 0x8a, 0xf4, 0xd6,
+  0xc7, 0xc8, 0x93, 0xc9, 0x41, 0x80, 0x66, 0xab, 0xf0, 0x58, 0x37, 0xcf, 0x8f, 0x90, 0x37, 0x86,
+  0xc7, 0x06, 0x3c, 0x00, 0x94, 0x35, 0x20, 0xa6, 0x80, 0x46, 0xd9, 0x56, 0x8a, 0x23, 0x51, 0x41,
+  0xc6, 0x19, 0xc1, 0x7f, 0x52, 0x06, 0x85, 0x4c, 0x31, 0x39, 0x7b, 0x07, 0x84, 0xd1, 0x5a, 0x84,
+  0x3b, 0x6b, 0xcd, 0xa9, 0x70, 0x3c, 0x46, 0xee, 0x0f, 0xdf, 0xbb, 0x2a, 0x6c, 0x2c, 0xcc, 0x2c,
+  0x83, 0x83, 0xfe, 0x72, 0xe0, 0x86, 0xb5, 0x4d, 0x47, 0xe6, 0xd5, 0x17, 0xcc, 0xf8, 0x48, 0x5e,
+  0xbf, 0xd6, 0x16, 0x65, 0xb8, 0x50, 0x82, 0xe7, 0xce, 0x53, 0x41, 0x4f, 0x2c, 0x28, 0x65, 0xfe,
+  0x38, 0x96, 0x1f, 0x30, 0xc8, 0xb0, 0xe4, 0x32, 0x21, 0xb8, 0x77, 0xa2, 0x5b, 0xdf, 0x4e, 0x77,
+  0xac, 0xe5, 0xb8, 0x23, 0x6d, 0xf9, 0xb1, 0xd3, 0xa6, 0x94, 0x60, 0xc2, 0xd7, 0x64, 0x75, 0x15,
+  0xbe, 0x65, 0x7d, 0x19, 0xac, 0xa3, 0xd8, 0x1e, 0x62, 0xa9, 0xe0, 0xc9, 0x0d, 0x99, 0xe5, 0x1d,
+  0x05, 0x7e, 0x68, 0x05, 0x94, 0xe8, 0x7f, 0x25, 0x53, 0x24, 0x80, 0x35, 0xec, 0x20, 0x5d, 0xd2,
+  0xa7, 0xec, 0x25, 0xf8, 0xac, 0x67, 0x09, 0x42, 0x59, 0x05, 0x65, 0x29, 0x00, 0x15, 0x00, 0x86,
+  0x1e, 0x8e, 0x53, 0x4b, 0xb3, 0x95, 0xcb, 0x34, 0x0b, 0x49, 0x46, 0x65, 0x59, 0xe1, 0xd6, 0xf6,
+  0x3d, 0x32, 0xd7, 0x8c, 0x54, 0x1e, 0x51, 0x89, 0x08, 0x2a, 0x76, 0x91, 0xcc, 0x2c, 0x01, 0x14,
+  0x82, 0x3e, 0x8f, 0xc0, 0x1c, 0x29, 0xcd, 0x45, 0xbd, 0x4a, 0xbc, 0xc9, 0x22, 0x85, 0x5d, 0xd3,
+  0x0e, 0xd8, 0x6b, 0xea, 0x8d, 0x4a, 0x6b, 0x1a, 0x29, 0x02, 0x74, 0xd4, 0xd9, 0x41, 0x32, 0xba,
+  0xef, 0xd9, 0x05, 0xbb, 0x82, 0x67, 0x64, 0x73, 0xdb, 0xb5, 0x6a, 0xba, 0xa2, 0xae, 0xb7, 0x34,
+  0x69, 0x85, 0xf1, 0x6f, 0x3e, 0xd5, 0x16, 0x94, 0xfb, 0x12, 0x3a, 0x32, 0x18, 0x45, 0x7d, 0x1c,
+  0xc7, 0xde, 0xbc, 0xb8, 0xa8, 0x7a, 0xd2, 0x81, 0x84, 0x34, 0xf4, 0xa0, 0xf7, 0x6a, 0xaf, 0x5e,
+  0x23, 0xe4, 0xe7, 0x46, 0xdd, 0x66, 0x7c, 0x21, 0x28, 0xe1, 0xed, 0xfa, 0xfe, 0xe0, 0xf3, 0x20,
+  0x6a, 0xbb, 0x10, 0xc4, 0x41, 0x54, 0xda, 0x3e, 0x38, 0xae, 0x1d, 0x1d, 0x4d, 0xef, 0xb2, 0xb9,
+  0x09, 0xce, 0x75, 0x6f, 0xd6, 0x86, 0x6f, 0xbd, 0x15, 0x0a, 0x6d, 0xca, 0xe1, 0x06, 0x12, 0xba,
+  0xc5, 0xcc, 0xd5, 0x83, 0x73, 0xb6, 0xae, 0x34, 0x9a, 0xf2, 0x70, 0xdf, 0x29, 0x6e, 0x71, 0xe5,
+  0xb1, 0x32, 0x5b, 0x18, 0xe2, 0x90, 0x12, 0xd1, 0xed, 0x5f, 0xcc, 0x55, 0x92, 0xfb, 0xa0, 0x51,
+  0xa2, 0x30, 0x34, 0x18, 0x05, 0xe8, 0x99, 0x61, 0x31, 0x3c, 0x6c, 0xed, 0xfb, 0x2f, 0xa0, 0xf1,
+  0x56, 0x43, 0x14, 0x92, 0xfd, 0x2a, 0x74, 0xe0, 0xdd, 0x29, 0x02, 0x83, 0xa1, 0x40, 0x7e, 0x08,
+  0x84, 0x3c, 0xe5, 0x10, 0xd0, 0xdf, 0x03, 0xd3, 0xd0, 0xf1, 0xab, 0xa6, 0x5d, 0xf6, 0x99, 0x7d,
+  0x12, 0xe6, 0x91, 0x98, 0xd6, 0x33, 0x45, 0x98, 0x13, 0x50, 0x2b, 0x93, 0x9d, 0x57, 0x9c, 0xa5,
+  0x0a, 0x91, 0xfa, 0xe8, 0x57, 0x4d, 0x08, 0xb0, 0x03, 0x4c, 0x2f, 0x0e, 0x6a, 0x73, 0x5c, 0x9e,
+  0x7e, 0x79, 0xf9, 0xe2, 0xd5, 0x6f, 0xce, 0xce, 0x4f, 0x2f, 0x9e, 0x5d, 0xca, 0xb6, 0x7d, 0xf9,
+  0x53, 0xe2, 0x73, 0xd6, 0x94, 0xfd, 0x90, 0xbe, 0x41, 0x28, 0xeb, 0x02, 0x37, 0xca, 0x4d, 0xd8,
+  0x9d, 0xf2, 0xf2, 0x87, 0x73, 0x1a, 0x5e, 0x5f, 0x08, 0x18, 0xf0, 0xdc, 0xf8, 0x3c, 0x2a, 0xc2,
+  0xcb, 0xc0, 0x98, 0x11, 0xd0, 0x3d, 0xd7, 0x56, 0x0a, 0xe6, 0x84, 0x99, 0xd5, 0xef, 0x40, 0x03,
+  0x06, 0x63, 0x79, 0x40, 0x4e, 0xdd, 0x33, 0xf4, 0x9d, 0x85, 0x55, 0x0e, 0x37, 0x44, 0x7a, 0x1a,
+  0x25, 0xe3, 0x4b, 0x75, 0x2d, 0x99, 0xaa, 0xc9, 0xbf, 0x18, 0xeb, 0x2f, 0xba, 0xaf, 0xa1, 0x83,
+  0xf5, 0x21, 0xe9, 0x9a, 0xfd, 0x79, 0xea, 0x85, 0x25, 0x7b, 0xa8, 0xc9, 0x94, 0xb9, 0xa4, 0x72,
+  0xd3, 0x2c, 0x6e, 0x0a, 0xca, 0x6b, 0x0a, 0x95, 0x0e, 0x30, 0x0f, 0xb0, 0x90, 0xd3, 0xc5, 0xea,
+  0xf1, 0xfb, 0x05, 0x08, 0x0d, 0x6d, 0x43, 0xbc, 0x42, 0x34, 0x2f, 0x06, 0xe8, 0x0b, 0xe4, 0x56,
+  0x2a, 0x2e, 0x6a, 0x1a, 0xba, 0xde, 0x1c, 0xc4, 0x36, 0xdd, 0xee, 0x6c, 0x4a, 0xba, 0xaa, 0x48,
+  0xc8, 0x5b, 0x02, 0x73, 0xeb, 0xa0, 0xc2, 0x5b, 0xce, 0x9c, 0x3d, 0x28, 0x16, 0xa1, 0x4d, 0xf2,
+  0x07, 0x5f, 0x71, 0x58, 0xef, 0x35, 0x96, 0xb9, 0xfb, 0x31, 0x2e, 0x24, 0x2c, 0x91, 0x2e, 0x95,
+  0x30, 0x96, 0x17, 0x60, 0x63, 0xff, 0x54, 0x46, 0xf3, 0x25, 0xb4, 0xe1, 0x01, 0xb1, 0x8f, 0x73,
+  0x3a, 0xdc, 0x0d, 0xdd, 0x1c, 0xb4, 0x29, 0x0f, 0x7a, 0xbb, 0x38, 0x94, 0xe9, 0x55, 0x1f, 0x87,
+  0xa1, 0x3a, 0x71, 0x01, 0xe9, 0x88, 0x30, 0x48, 0xa9, 0xae, 0xbe, 0x56, 0x4f, 0x65, 0x46, 0x52,
+  0x13, 0x49, 0xce, 0xa5, 0x7f, 0x79, 0xf9, 0xe2, 0x4b, 0x7f, 0x28, 0xbf, 0x8b, 0xe5, 0x11, 0x5f,
+  0xf9, 0x6f, 0xe9, 0xae, 0x58, 0x05, 0x0d, 0x6e, 0x66, 0x28, 0xef, 0x61, 0x40, 0xeb, 0x15, 0xd2,
+  0x2a, 0x1b, 0x96, 0x0b, 0xa5, 0xa5, 0xe2, 0xac, 0x9b, 0x86, 0x65, 0xba, 0x90, 0x06, 0x8f, 0xe5,
+  0x57, 0xa8, 0xcc, 0xbd, 0xb4, 0x49, 0x79, 0xfb, 0x26, 0xe9, 0xa5, 0x3b, 0xcb, 0xcd, 0x12, 0xe4,
+  0x35, 0x28, 0x38, 0x30, 0x19, 0x78, 0x8b, 0xcb, 0xdc, 0x32, 0xda, 0x97, 0x5d, 0xe7, 0x32, 0xdd,
+  0xa5, 0x0b, 0xed, 0x2d, 0xb9, 0x7c, 0x5e, 0x03, 0x14, 0x69, 0xa8, 0x2c, 0x99, 0x20, 0x3b, 0xeb,
+  0x69, 0x1a, 0xf0, 0x32, 0x3a, 0xa8, 0x2d, 0xd3, 0x2d, 0x34, 0x18, 0x87, 0xb3, 0x2f, 0x19, 0x98,
+  0xfb, 0xe8, 0x56, 0x55, 0x7f, 0xbd, 0xa0, 0x55, 0xd5, 0xdf, 0xaf, 0xfb, 0x1f, 0x9a, 0x3d, 0xe6,
+  0xad, 0x77, 0x27, 0x00, 0x00,
+};
+static const WebAsset WEBASSET_HOME = {WEBASSET_HOME_DATA, 2757, "\"5169c605\"", "text/html", "gzip"};
+
+static const uint8_t WEBASSET_CONFIG_DATA[2125] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x5a, 0x4b, 0x6f, 0x1c, 0xb9,
+  0x11, 0xbe, 0xef, 0xaf, 0xa0, 0x67, 0x11, 0x4c, 0x4f, 0xac, 0x9e, 0x97, 0x34, 0xb2, 0x35, 0x9e,
+  0x51, 0xb0, 0x92, 0x65, 0x7b, 0x03, 0xaf, 0x6d, 0x58, 0xda, 0x43, 0x10, 0xe4, 0xc0, 0xe9, 0xe6,
+  0x4c, 0x33, 0xee, 0x57, 0x48, 0xb6, 0x1e, 0x6b, 0xe8, 0x98, 0x9c, 0x02, 0x64, 0x91, 0x20, 0x87,
+  0x04, 0x09, 0x82, 0xdc, 0xd6, 0xff, 0x20, 0xc8, 0x21, 0x17, 0xfd, 0x13, 0xff, 0x81, 0xe4, 0x27,
+  0xa4, 0x48, 0x76, 0xcf, 0xf4, 0x83, 0x3d, 0x2f, 0x8c, 0x04, 0xec, 0xe8, 0xa0, 0xee, 0x26, 0xf9,
+  0x55, 0xd5, 0xc7, 0x62, 0x55, 0x91, 0xdd, 0xa3, 0x47, 0xcf, 0xdf, 0x9e, 0x5e, 0xfc, 0xe2, 0xdd,
+  0x19, 0xf2, 0x44, 0xe0, 0x1f, 0x7f, 0x31, 0xca, 0xfe, 0x11, 0xec, 0x1e, 0x7f, 0x81, 0xe0, 0x37,
+  0x0a, 0x88, 0xc0, 0xc8, 0xf1, 0x30, 0xe3, 0x44, 0x8c, 0x1b, 0xdf, 0x5e, 0xbc, 0xb0, 0x9f, 0x36,
+  0xf2, 0x4d, 0x21, 0x0e, 0xc8, 0xb8, 0x71, 0x49, 0xc9, 0x55, 0x1c, 0x31, 0xd1, 0x40, 0x4e, 0x14,
+  0x0a, 0x12, 0x42, 0xd7, 0x2b, 0xea, 0x0a, 0x6f, 0xec, 0x92, 0x4b, 0xea, 0x10, 0x5b, 0xdd, 0xec,
+  0x21, 0x1a, 0x52, 0x41, 0xb1, 0x6f, 0x73, 0x07, 0xfb, 0x64, 0xdc, 0x6b, 0x77, 0x33, 0x28, 0x41,
+  0x85, 0x4f, 0x8e, 0x4f, 0xa3, 0x70, 0x4a, 0x67, 0x09, 0xc3, 0x82, 0x46, 0x21, 0xb2, 0xd1, 0x79,
+  0x80, 0x99, 0x40, 0xaf, 0xcf, 0x9e, 0xa3, 0x53, 0x3f, 0x72, 0x3e, 0x8c, 0x3a, 0xba, 0x9b, 0x1e,
+  0xe2, 0xd3, 0xf0, 0x03, 0x62, 0xc4, 0x1f, 0x37, 0xb8, 0xb8, 0xf1, 0x09, 0xf7, 0x08, 0x01, 0xf1,
+  0x1e, 0x23, 0xd3, 0x71, 0xa3, 0xa3, 0x1e, 0xb5, 0x1d, 0xce, 0x33, 0x01, 0xea, 0x81, 0xbe, 0x96,
+  0xbf, 0xf6, 0x34, 0x62, 0x81, 0xcd, 0x89, 0xa3, 0x24, 0x7d, 0x9c, 0x3f, 0x97, 0x3f, 0x10, 0x3a,
+  0xa3, 0xe1, 0x10, 0xed, 0x77, 0xe3, 0x6b, 0xd4, 0x7d, 0x56, 0x68, 0x8b, 0xb1, 0xeb, 0xd2, 0x70,
+  0x36, 0x44, 0x7d, 0x68, 0x2c, 0x36, 0x4d, 0xb0, 0xf3, 0x61, 0xc6, 0xa2, 0x24, 0x74, 0x87, 0xe8,
+  0xcb, 0xe9, 0x91, 0xfc, 0x2b, 0x75, 0x88, 0x98, 0x4b, 0x98, 0xcd, 0xb0, 0x4b, 0x13, 0x3e, 0x44,
+  0x4f, 0xf3, 0x00, 0xb7, 0x35, 0x9a, 0x79, 0xfd, 0x92, 0x72, 0x4e, 0xe4, 0x47, 0x0c, 0x04, 0x1c,
+  0x9c, 0x7e, 0xf5, 0x62, 0x50, 0x52, 0x4e, 0x2b, 0x6e, 0x8b, 0x28, 0x1e, 0xe6, 0xf5, 0x2e, 0x63,
+  0x4b, 0x25, 0xe3, 0x1a, 0x9b, 0x7b, 0x83, 0xa2, 0xcd, 0x8b, 0xb1, 0x3e, 0x9e, 0x10, 0xbf, 0x34,
+  0xca, 0xa5, 0x3c, 0xf6, 0xf1, 0xcd, 0x10, 0x4d, 0xe4, 0xf4, 0x18, 0x95, 0x99, 0x44, 0x42, 0x44,
+  0xc1, 0x10, 0x0d, 0xca, 0x74, 0x65, 0x86, 0x1c, 0x1e, 0x1e, 0x16, 0x1b, 0xa6, 0xe0, 0x40, 0xf6,
+  0x15, 0xa1, 0x33, 0x4f, 0x00, 0x70, 0xe4, 0xbb, 0x26, 0x6d, 0x68, 0x18, 0x27, 0xe2, 0x97, 0xe2,
+  0x26, 0x06, 0xdf, 0x13, 0xe4, 0x5a, 0x34, 0x7e, 0xb5, 0x67, 0x6c, 0x0b, 0x93, 0x60, 0x42, 0x58,
+  0x5d, 0x6b, 0x8c, 0x39, 0xbf, 0x82, 0x59, 0xa9, 0x6b, 0x57, 0x3a, 0xe6, 0x1b, 0x39, 0xf1, 0x61,
+  0x62, 0x4a, 0x2c, 0x28, 0xdf, 0x06, 0xea, 0xba, 0xdd, 0x9f, 0xd4, 0x38, 0x4b, 0xaf, 0xea, 0x2c,
+  0xca, 0x17, 0xa0, 0x05, 0xe8, 0xe6, 0x91, 0x4f, 0x5d, 0xf4, 0xa5, 0xeb, 0xba, 0x4b, 0xfd, 0xe5,
+  0xa0, 0x8a, 0x71, 0x6d, 0x73, 0xfa, 0x9d, 0x92, 0x90, 0xf6, 0x85, 0x47, 0x26, 0xb6, 0x78, 0x80,
+  0x7d, 0xbf, 0xc6, 0x91, 0x8e, 0x8e, 0x8e, 0x0c, 0xfc, 0x03, 0x2e, 0x01, 0xed, 0xfa, 0x35, 0x3e,
+  0xaa, 0x06, 0x1b, 0x1d, 0x69, 0xee, 0x12, 0x33, 0x46, 0x4b, 0xf6, 0xc8, 0x27, 0xb6, 0x20, 0x01,
+  0xb4, 0x0b, 0x62, 0x03, 0x44, 0x12, 0x84, 0x60, 0x17, 0x23, 0x31, 0xc1, 0xc2, 0xda, 0xdf, 0x43,
+  0xbd, 0x29, 0x6b, 0x95, 0x86, 0xe0, 0xb8, 0xcc, 0x5e, 0x4e, 0x0b, 0x8e, 0x2f, 0x89, 0x3d, 0x11,
+  0xe1, 0x06, 0x5e, 0xb9, 0xc6, 0x5c, 0x0d, 0x96, 0x2e, 0x6c, 0xd3, 0xba, 0x4b, 0xa9, 0xbc, 0xf2,
+  0xa8, 0x20, 0xe6, 0x69, 0x0e, 0xa3, 0x90, 0x2c, 0x9d, 0xdc, 0xea, 0xf2, 0x48, 0x18, 0x97, 0xa0,
+  0x71, 0x44, 0x21, 0x9e, 0xb2, 0xfa, 0x29, 0x3a, 0x2c, 0x8f, 0xcc, 0x47, 0x81, 0xfe, 0x2a, 0xea,
+  0x86, 0x5e, 0x74, 0x49, 0x58, 0x89, 0xc0, 0xa2, 0xc1, 0x03, 0xdc, 0x3d, 0x38, 0x32, 0x82, 0x04,
+  0x84, 0x73, 0x3c, 0x23, 0xa5, 0xd1, 0xcb, 0x98, 0x5c, 0x61, 0x74, 0x16, 0x85, 0xfa, 0x86, 0xc8,
+  0x3b, 0x9f, 0xd5, 0x22, 0x97, 0x55, 0x75, 0xda, 0x3c, 0x71, 0x1c, 0xb8, 0x5c, 0x66, 0x94, 0x7b,
+  0x40, 0x5c, 0x17, 0x9b, 0x03, 0x52, 0x6f, 0x30, 0x78, 0xd2, 0x3f, 0x58, 0xb9, 0x5c, 0x9d, 0x7d,
+  0x72, 0xe8, 0x4c, 0x96, 0x2a, 0x42, 0x18, 0x8b, 0x96, 0x72, 0x3b, 0x7d, 0xea, 0x3e, 0xa9, 0x53,
+  0xe3, 0x49, 0xbf, 0xe7, 0xac, 0xa1, 0xc6, 0x74, 0xe0, 0x18, 0xd4, 0x18, 0x75, 0xd2, 0x7c, 0x37,
+  0xea, 0xe8, 0x54, 0x3e, 0x9a, 0x44, 0xee, 0x4d, 0x9a, 0x0a, 0x5d, 0x7a, 0x89, 0x1c, 0x1f, 0x42,
+  0x9f, 0x0c, 0x70, 0xa1, 0xc0, 0x34, 0x84, 0x08, 0xb9, 0x48, 0x8d, 0x23, 0xaf, 0x77, 0xfc, 0xf9,
+  0xaf, 0x7f, 0xf9, 0xef, 0xbf, 0xfe, 0x80, 0x0a, 0xf9, 0x18, 0xa0, 0x7a, 0x8b, 0x5e, 0x8b, 0xee,
+  0x39, 0xb8, 0x10, 0x5f, 0xe6, 0x80, 0x54, 0x2b, 0xce, 0x32, 0x72, 0xe3, 0xf8, 0xf3, 0xef, 0xbe,
+  0x47, 0xef, 0x89, 0x88, 0x12, 0x86, 0x70, 0x82, 0x04, 0x9e, 0xf8, 0x04, 0xfe, 0xbb, 0x44, 0x99,
+  0x35, 0xea, 0xe0, 0x9c, 0x0a, 0x1d, 0x00, 0xad, 0x93, 0x45, 0xdd, 0x71, 0x23, 0x65, 0xb8, 0x91,
+  0x09, 0xce, 0xee, 0x8f, 0x6b, 0x47, 0xca, 0xcc, 0xa7, 0x86, 0x3a, 0xca, 0xa6, 0x17, 0x70, 0x5b,
+  0x56, 0xf5, 0x91, 0x6d, 0xa3, 0x37, 0x17, 0xef, 0xd0, 0x39, 0x11, 0x02, 0x1c, 0x98, 0x23, 0xdb,
+  0x2e, 0xf5, 0xc8, 0x99, 0x9a, 0xcf, 0xd2, 0x25, 0x20, 0x4d, 0x62, 0xff, 0xf8, 0x7f, 0xff, 0xf8,
+  0xf3, 0xf7, 0xe8, 0x1d, 0x66, 0x38, 0xb8, 0xfb, 0x41, 0x30, 0xc2, 0xd1, 0xab, 0x88, 0x61, 0x0a,
+  0x17, 0xc0, 0x64, 0xbf, 0x3a, 0xa4, 0x8a, 0x51, 0x16, 0xa7, 0xe2, 0xad, 0x41, 0x98, 0x2e, 0x87,
+  0x64, 0x7e, 0x3e, 0x7e, 0x91, 0x70, 0x49, 0xaa, 0xa7, 0x25, 0x21, 0xeb, 0xdb, 0x8b, 0x53, 0x14,
+  0x4d, 0xa7, 0x50, 0xbb, 0xb5, 0x86, 0xa3, 0x8e, 0xee, 0x63, 0x1e, 0xaf, 0xf2, 0x1e, 0x2a, 0x64,
+  0x4d, 0xc5, 0x97, 0xa0, 0x01, 0xf9, 0x0e, 0x96, 0xdc, 0x5b, 0x85, 0xd2, 0x40, 0x01, 0x0d, 0xc7,
+  0x0d, 0xbb, 0xd7, 0x87, 0x2b, 0x7c, 0x3d, 0x6e, 0xf4, 0x0e, 0x1a, 0x10, 0xc1, 0x7f, 0x93, 0x80,
+  0x34, 0xb7, 0x06, 0x59, 0x65, 0x9f, 0xe3, 0xb3, 0x6b, 0x19, 0xf9, 0x21, 0x62, 0xf5, 0x21, 0xa6,
+  0x81, 0x0b, 0x80, 0x66, 0x8f, 0xfb, 0xc8, 0x02, 0x7e, 0x28, 0x6f, 0x81, 0xbf, 0xaa, 0x4e, 0x55,
+  0x0e, 0x8a, 0xf3, 0xb9, 0x53, 0xae, 0x5e, 0x91, 0x04, 0x28, 0x02, 0xff, 0xe3, 0x37, 0xa1, 0xe3,
+  0xb1, 0x28, 0xa4, 0x5c, 0x17, 0x9e, 0xe0, 0x04, 0x5b, 0x92, 0x15, 0x8a, 0xf8, 0x1c, 0xc0, 0x5e,
+  0x81, 0x81, 0x29, 0x53, 0xdd, 0x94, 0xa7, 0xfe, 0xfe, 0x32, 0x9e, 0xee, 0xd3, 0xcc, 0x6f, 0x68,
+  0x98, 0x88, 0xfb, 0xb1, 0x53, 0x43, 0x97, 0x2c, 0x1d, 0x1c, 0x6d, 0x68, 0xa9, 0xe1, 0x51, 0x75,
+  0x61, 0xaa, 0x4d, 0x80, 0x0c, 0x8d, 0x3b, 0x58, 0x96, 0x7f, 0xfc, 0x27, 0x40, 0x25, 0x3e, 0x4c,
+  0x3f, 0x07, 0x5a, 0xb8, 0xc4, 0xbe, 0xc7, 0x25, 0x99, 0x8a, 0x52, 0x92, 0x3c, 0xe9, 0x72, 0x7c,
+  0x05, 0xe9, 0x85, 0xf8, 0x3c, 0xaf, 0xb3, 0x6a, 0x84, 0x2c, 0x9d, 0x26, 0x35, 0x5c, 0x3a, 0xe3,
+  0xfb, 0xb2, 0x37, 0x0e, 0x06, 0x0d, 0x04, 0xe9, 0xd4, 0x21, 0x1e, 0x14, 0xd8, 0x84, 0x8d, 0x1b,
+  0xef, 0x57, 0x2d, 0xe3, 0xf5, 0x04, 0xbd, 0x5c, 0x29, 0xe8, 0xe5, 0x6e, 0x04, 0x9d, 0xac, 0x14,
+  0x74, 0xb2, 0x32, 0x30, 0x99, 0x17, 0xdd, 0x7d, 0xae, 0xc5, 0xbc, 0x2f, 0x04, 0x6a, 0xf1, 0x3c,
+  0xb0, 0x33, 0xe8, 0x15, 0xfb, 0x20, 0xee, 0xa0, 0x45, 0x3d, 0x88, 0x43, 0x68, 0x51, 0x3f, 0x7e,
+  0x97, 0x80, 0xc0, 0x15, 0x85, 0xee, 0x43, 0xfb, 0xc4, 0xb9, 0x92, 0xfa, 0x20, 0x3e, 0xa1, 0x45,
+  0x3d, 0x88, 0x4f, 0x68, 0x51, 0x3f, 0x4e, 0x9f, 0x78, 0x9d, 0x80, 0xd2, 0x11, 0xa7, 0xe2, 0xee,
+  0x13, 0xb2, 0xba, 0x36, 0x28, 0xbd, 0x6d, 0xf5, 0xe6, 0x13, 0xf7, 0x84, 0xc9, 0xa3, 0x94, 0x10,
+  0x2a, 0x64, 0x13, 0x17, 0xf7, 0x90, 0xa9, 0x4f, 0x9f, 0xef, 0xb0, 0x84, 0xfe, 0xd3, 0xbf, 0x0b,
+  0x25, 0x34, 0x80, 0xdf, 0x63, 0xaa, 0xbe, 0x80, 0x5a, 0x37, 0x02, 0x1e, 0xd9, 0xdd, 0x27, 0xc1,
+  0xa2, 0xbb, 0x4f, 0x30, 0x9c, 0x32, 0xb9, 0xc3, 0xb5, 0xb2, 0x95, 0xb9, 0xf5, 0x3c, 0x38, 0x6e,
+  0x0a, 0x9e, 0x4e, 0xc2, 0x20, 0x9d, 0x84, 0xfd, 0x6e, 0x77, 0xd7, 0x93, 0x30, 0x49, 0x84, 0x80,
+  0xea, 0x4e, 0x2b, 0xc1, 0x93, 0x49, 0x40, 0xc5, 0x7c, 0xa3, 0x94, 0xed, 0xfb, 0x1b, 0xb2, 0x0c,
+  0xfa, 0x0f, 0x3a, 0x0b, 0x19, 0x99, 0x51, 0x0e, 0xd4, 0x32, 0xe4, 0x63, 0xe4, 0x14, 0xf7, 0x7b,
+  0x1a, 0x28, 0xbf, 0x2d, 0x93, 0x44, 0xa6, 0xbb, 0xc8, 0x85, 0x16, 0xe9, 0x01, 0xab, 0xc3, 0x68,
+  0x2c, 0x16, 0x9d, 0x3b, 0x1d, 0xf4, 0x3a, 0xc2, 0xae, 0x3c, 0xc8, 0x60, 0x24, 0x14, 0x45, 0xec,
+  0x79, 0xaf, 0x69, 0x12, 0xea, 0x83, 0x4e, 0x1f, 0xfa, 0xea, 0xed, 0xa6, 0xd5, 0x2a, 0x6d, 0x99,
+  0xa7, 0x44, 0x38, 0x9e, 0xd5, 0xec, 0xe0, 0x98, 0x76, 0x34, 0x4a, 0xb3, 0x55, 0x21, 0xaa, 0x2d,
+  0x3c, 0x12, 0x5a, 0xe0, 0x22, 0x71, 0x14, 0x72, 0x82, 0xc6, 0xc7, 0x28, 0xbb, 0x6e, 0xff, 0x9a,
+  0x47, 0xa1, 0xd5, 0xaa, 0x1b, 0xe2, 0x62, 0x81, 0x65, 0xf7, 0x8f, 0xc6, 0x09, 0x75, 0x23, 0x27,
+  0x09, 0x40, 0xfd, 0xf6, 0x8c, 0x88, 0x33, 0x9f, 0xc8, 0xcb, 0x93, 0x9b, 0xaf, 0x5d, 0xab, 0x59,
+  0xdc, 0x16, 0x35, 0x5b, 0xed, 0x4b, 0xec, 0x27, 0x20, 0x17, 0x49, 0xbc, 0x76, 0xb1, 0xf5, 0xd9,
+  0x66, 0xd0, 0xb9, 0x4d, 0x44, 0x19, 0x37, 0xd7, 0xb4, 0x1d, 0xa8, 0xce, 0x94, 0x35, 0xb0, 0xba,
+  0xd1, 0x0c, 0xbc, 0x99, 0xb4, 0x45, 0xe1, 0x59, 0x16, 0x05, 0x01, 0xa9, 0xed, 0x41, 0x43, 0x7b,
+  0x53, 0x03, 0x16, 0x25, 0x66, 0x2d, 0xe4, 0x6c, 0x5b, 0xc8, 0x93, 0x5a, 0xc8, 0xc9, 0x36, 0x90,
+  0x69, 0x91, 0x65, 0x02, 0xd5, 0x45, 0xdf, 0x76, 0xc6, 0xa7, 0x05, 0xd5, 0x12, 0xd8, 0xd9, 0xf6,
+  0xb0, 0x27, 0x4b, 0x60, 0xb7, 0x22, 0x21, 0xad, 0x2a, 0x4c, 0xb0, 0x3a, 0x98, 0x6e, 0x47, 0x42,
+  0x5a, 0x41, 0x2c, 0x81, 0x9d, 0x6d, 0x0f, 0x7b, 0xb2, 0x04, 0x76, 0x53, 0x12, 0x0a, 0x99, 0xd7,
+  0x84, 0x3b, 0x99, 0xb7, 0xee, 0x62, 0xc5, 0x2d, 0x12, 0x4c, 0x45, 0xd6, 0xbc, 0x05, 0x75, 0xe4,
+  0xc1, 0x77, 0xb7, 0x2a, 0xee, 0xd6, 0x10, 0x1c, 0x1d, 0x2c, 0xa3, 0xae, 0x3e, 0xc2, 0xac, 0x0d,
+  0x8f, 0xdc, 0x8b, 0xae, 0xbe, 0xd1, 0x67, 0x6f, 0x56, 0xf3, 0x0c, 0x02, 0xbd, 0x2a, 0x64, 0xd5,
+  0xeb, 0xc2, 0x99, 0x52, 0x4e, 0xde, 0x95, 0x13, 0x4b, 0x73, 0x0f, 0x35, 0x15, 0x6e, 0xb3, 0x65,
+  0x52, 0xc5, 0x74, 0xa4, 0x9a, 0xcf, 0x2a, 0xe7, 0x90, 0xc2, 0x6a, 0xb2, 0xc9, 0x92, 0x39, 0xce,
+  0x0e, 0xfd, 0x80, 0x1d, 0xec, 0xba, 0x67, 0x97, 0xd0, 0xf4, 0x1a, 0x12, 0x1f, 0x09, 0x09, 0xb3,
+  0x9a, 0x3a, 0x49, 0x82, 0x5e, 0x59, 0x3a, 0xb2, 0x48, 0x39, 0x09, 0x91, 0x76, 0xcc, 0x88, 0x1c,
+  0xf5, 0x9c, 0x4c, 0x71, 0xe2, 0x0b, 0xab, 0xa4, 0x7b, 0xe9, 0x0c, 0x37, 0xe4, 0x59, 0xc6, 0x83,
+  0x69, 0xa8, 0x72, 0x57, 0xcc, 0x0f, 0x43, 0x14, 0xcb, 0xd7, 0xab, 0x5f, 0x87, 0xc2, 0xda, 0x30,
+  0xdf, 0xb4, 0xf6, 0x2a, 0xd0, 0xb9, 0x14, 0xb1, 0x0e, 0xae, 0x21, 0xd9, 0xd4, 0x83, 0xea, 0x50,
+  0xb1, 0x01, 0x6c, 0x31, 0xdd, 0x18, 0x80, 0x61, 0x21, 0x0c, 0x6b, 0x7c, 0xcb, 0x53, 0x16, 0x7c,
+  0xac, 0x2d, 0xff, 0xd7, 0x32, 0xaf, 0x9a, 0x88, 0x0c, 0x4a, 0xcc, 0xdf, 0x36, 0x6d, 0x84, 0xf8,
+  0x72, 0x0d, 0xc4, 0xc9, 0x46, 0x88, 0xf3, 0xf0, 0xd3, 0x32, 0x02, 0xde, 0x9a, 0xe5, 0x04, 0xe9,
+  0xa4, 0xec, 0x82, 0xa9, 0x52, 0xe6, 0xda, 0x09, 0x57, 0xa5, 0xb4, 0xb5, 0x13, 0xb6, 0x4a, 0x39,
+  0x6b, 0x23, 0xbe, 0x74, 0x3c, 0xdf, 0x0d, 0x5f, 0xa5, 0x24, 0xb7, 0x13, 0xbe, 0x4a, 0x19, 0x6e,
+  0x27, 0x7c, 0x95, 0xd2, 0xdb, 0x46, 0x7c, 0x2d, 0xf2, 0xd4, 0x3a, 0xe2, 0x8c, 0x69, 0xaf, 0x2a,
+  0xcf, 0x20, 0x6b, 0x91, 0xa7, 0xd6, 0x92, 0x53, 0xc9, 0x77, 0x2d, 0xf4, 0x53, 0x95, 0xde, 0x8a,
+  0xc8, 0xb7, 0x4b, 0xc2, 0xb4, 0x61, 0x63, 0xb1, 0x67, 0x70, 0x8b, 0x80, 0x08, 0x2f, 0x02, 0x87,
+  0x69, 0xbe, 0x7b, 0x7b, 0x7e, 0xd1, 0xac, 0x2a, 0x2e, 0xdf, 0xb0, 0x11, 0xc6, 0xeb, 0x3c, 0xaa,
+  0x79, 0xaa, 0xbf, 0x88, 0xb1, 0x2f, 0x60, 0x43, 0xd6, 0x04, 0x18, 0x1c, 0xc7, 0x3e, 0x75, 0x54,
+  0xe6, 0xea, 0xc8, 0xbd, 0x49, 0x73, 0x1d, 0x76, 0xe4, 0xfb, 0xbb, 0x21, 0xfa, 0xf9, 0xf9, 0xdb,
+  0x37, 0x6d, 0xd8, 0xae, 0xc1, 0xde, 0x9a, 0x4e, 0x6f, 0x2c, 0xad, 0x74, 0x91, 0xdd, 0x52, 0x2e,
+  0xdf, 0x70, 0x5f, 0xb4, 0x6a, 0x4f, 0x44, 0xa7, 0x48, 0xb5, 0x66, 0x2f, 0x59, 0x5b, 0xeb, 0x14,
+  0x06, 0x9f, 0xff, 0xf6, 0xdb, 0xe2, 0xab, 0x44, 0x44, 0xb2, 0x7d, 0xe7, 0xdd, 0x27, 0x82, 0x20,
+  0x9f, 0x3b, 0x48, 0xe2, 0xdd, 0xfd, 0xc0, 0x1f, 0xc9, 0xe2, 0x20, 0xc5, 0x36, 0x96, 0x07, 0x88,
+  0xf8, 0x9c, 0xac, 0x25, 0xf4, 0xef, 0xbf, 0x47, 0xba, 0x22, 0x01, 0xca, 0xd1, 0x63, 0x5d, 0x0b,
+  0x65, 0x6f, 0xac, 0x1f, 0xa7, 0x56, 0x4c, 0x29, 0xf1, 0x5d, 0xf4, 0x33, 0xe8, 0x60, 0xcd, 0xfb,
+  0xe8, 0x67, 0x8f, 0x51, 0xb3, 0xd5, 0x44, 0x30, 0xb4, 0xd9, 0x5a, 0x5a, 0xae, 0x2c, 0xe5, 0x7e,
+  0x65, 0x0d, 0x55, 0xa3, 0xb1, 0xaa, 0xa1, 0xa2, 0x20, 0x48, 0xc2, 0xd4, 0x4f, 0x6a, 0x4b, 0xa6,
+  0x42, 0xb9, 0x94, 0xbb, 0xae, 0x6e, 0xb0, 0xf3, 0xa2, 0xe4, 0x17, 0x33, 0x7b, 0xea, 0x80, 0xa0,
+  0x55, 0xf9, 0x2a, 0x44, 0x56, 0x2e, 0x01, 0x97, 0x65, 0x4b, 0xed, 0xda, 0x4b, 0x59, 0x2c, 0xeb,
+  0x02, 0xa3, 0xda, 0x12, 0x39, 0xf5, 0x77, 0x40, 0x90, 0x77, 0xd5, 0x3e, 0xea, 0x28, 0xe2, 0x0d,
+  0x0e, 0x64, 0x85, 0x9a, 0x61, 0xa9, 0x29, 0x92, 0x0a, 0x55, 0xbb, 0xeb, 0x4f, 0xb9, 0xd2, 0xd7,
+  0xff, 0x72, 0x88, 0xfa, 0xac, 0xa3, 0xb9, 0x64, 0x5d, 0x43, 0x81, 0x94, 0xc6, 0x06, 0xcb, 0x6a,
+  0x99, 0x89, 0x37, 0x02, 0xcb, 0x2f, 0x0b, 0x4a, 0xb8, 0xb7, 0x7b, 0x68, 0x00, 0x31, 0x65, 0x65,
+  0x51, 0xaa, 0x8f, 0x3a, 0x74, 0xc1, 0x07, 0x64, 0xc7, 0xd2, 0x24, 0x79, 0xa4, 0xb1, 0xf8, 0x7c,
+  0x2a, 0x77, 0xbe, 0xf1, 0x2c, 0x7b, 0x47, 0x9f, 0x1e, 0x99, 0x8c, 0x3a, 0xfa, 0xed, 0xfc, 0xa8,
+  0xa3, 0x3f, 0xbf, 0xfb, 0x3f, 0xeb, 0x29, 0x4e, 0x94, 0x96, 0x27, 0x00, 0x00,
+};
+static const WebAsset WEBASSET_CONFIG = {WEBASSET_CONFIG_DATA, 2125, "\"b083ad61\"", "text/html", "gzip"};
+
+static const uint8_t WEBASSET_MOON_DATA[3309] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x5b, 0x5b, 0x8f, 0x1b, 0xb7,
+  0x15, 0x7e, 0xf7, 0xaf, 0xa0, 0x15, 0x18, 0x92, 0x90, 0x1d, 0x5d, 0xf7, 0x66, 0x79, 0x25, 0x23,
+  0xf1, 0x6e, 0x10, 0x07, 0xbb, 0x76, 0xe0, 0x75, 0x0c, 0x14, 0x49, 0x50, 0x50, 0x33, 0x94, 0xc4,
+  0x78, 0x34, 0x33, 0x99, 0xe1, 0xec, 0x7a, 0x93, 0xf8, 0x25, 0x48, 0x0b, 0x14, 0x08, 0x90, 0xb6,
+  0x49, 0x9b, 0x26, 0x48, 0x90, 0x3c, 0x36, 0xcf, 0xed, 0x43, 0xfb, 0xbc, 0xff, 0xc4, 0x7f, 0xa0,
+  0xf9, 0x09, 0x3d, 0x87, 0x9c, 0x91, 0xe6, 0x42, 0x8e, 0x66, 0x37, 0x0e, 0x90, 0xb5, 0x01, 0x5d,
+  0x48, 0x1e, 0x1e, 0x9e, 0x73, 0x78, 0xf8, 0x7d, 0x87, 0xa3, 0x83, 0x9b, 0x87, 0x0f, 0xef, 0x3d,
+  0xfe, 0xdd, 0xdb, 0x47, 0x64, 0x21, 0x96, 0xee, 0xe4, 0xc6, 0x41, 0xfa, 0xc2, 0xa8, 0x33, 0xb9,
+  0x41, 0xe0, 0xef, 0x60, 0xc9, 0x04, 0x25, 0xf6, 0x82, 0x86, 0x11, 0x13, 0xe3, 0xc6, 0x3b, 0x8f,
+  0xdf, 0xb0, 0xf6, 0x1b, 0xd9, 0x26, 0x8f, 0x2e, 0xd9, 0xb8, 0x71, 0xc6, 0xd9, 0x79, 0xe0, 0x87,
+  0xa2, 0x41, 0x6c, 0xdf, 0x13, 0xcc, 0x83, 0xae, 0xe7, 0xdc, 0x11, 0x8b, 0xb1, 0xc3, 0xce, 0xb8,
+  0xcd, 0x2c, 0xf9, 0x61, 0x8b, 0x70, 0x8f, 0x0b, 0x4e, 0x5d, 0x2b, 0xb2, 0xa9, 0xcb, 0xc6, 0xfd,
+  0x4e, 0x2f, 0x15, 0x25, 0xb8, 0x70, 0xd9, 0xe4, 0xed, 0x05, 0x8d, 0x18, 0x39, 0x8e, 0x3d, 0xca,
+  0x43, 0x46, 0x2c, 0x72, 0xba, 0xa4, 0xa1, 0x20, 0xc7, 0x47, 0x87, 0xe4, 0x9e, 0xeb, 0xdb, 0x4f,
+  0x0f, 0xba, 0xaa, 0x9b, 0x1a, 0xe2, 0x72, 0xef, 0x29, 0x09, 0x99, 0x3b, 0x6e, 0x44, 0xe2, 0xc2,
+  0x65, 0xd1, 0x82, 0x31, 0x98, 0x7e, 0x11, 0xb2, 0xd9, 0xb8, 0xd1, 0x95, 0x5f, 0x75, 0xec, 0x28,
+  0x4a, 0x27, 0x90, 0x5f, 0xa8, 0xf7, 0xf8, 0xd7, 0x59, 0xfa, 0xbe, 0x67, 0x39, 0x3c, 0x0a, 0x5c,
+  0x7a, 0x41, 0x3e, 0x5e, 0x7d, 0x8f, 0x7f, 0x82, 0x3d, 0x13, 0x16, 0x75, 0xf9, 0xdc, 0x1b, 0x11,
+  0x1b, 0x96, 0xc2, 0xc2, 0x3b, 0xb9, 0xf6, 0x80, 0x3a, 0x0e, 0xf7, 0xe6, 0x23, 0xb2, 0xdd, 0x0b,
+  0x9e, 0xe5, 0x9b, 0xa6, 0xd4, 0x7e, 0x3a, 0x0f, 0xfd, 0xd8, 0x73, 0x46, 0x04, 0xf4, 0x63, 0x34,
+  0xb4, 0xe6, 0x21, 0x75, 0x38, 0x48, 0x69, 0xf5, 0x87, 0x3b, 0x0e, 0x9b, 0x6f, 0x91, 0x57, 0x76,
+  0x77, 0xf7, 0x18, 0xa3, 0xa4, 0x77, 0x0b, 0xde, 0xef, 0xed, 0x6e, 0x4f, 0xe9, 0x80, 0xf4, 0x7b,
+  0xbd, 0x5b, 0xed, 0x82, 0x28, 0x3f, 0x74, 0x58, 0x68, 0xe1, 0xe8, 0x38, 0x1a, 0x91, 0xfe, 0x4e,
+  0x71, 0x2e, 0xdb, 0x77, 0xfd, 0x70, 0x44, 0xce, 0x17, 0x5c, 0xb0, 0x7c, 0x0b, 0x58, 0x6d, 0xce,
+  0x41, 0xf9, 0x21, 0xe8, 0x47, 0x7a, 0xeb, 0xb6, 0xe7, 0x85, 0xe5, 0x07, 0xd2, 0xdc, 0xf9, 0xc5,
+  0xcf, 0xc0, 0x7d, 0x56, 0xc4, 0x3f, 0x62, 0xb0, 0xbc, 0xfd, 0xe2, 0x94, 0x4a, 0xb0, 0x35, 0xf5,
+  0x85, 0xf0, 0x97, 0x23, 0x32, 0xc8, 0xad, 0x3f, 0x23, 0x5d, 0x0a, 0xb6, 0x30, 0x32, 0xcc, 0xd2,
+  0x87, 0x83, 0xa2, 0x74, 0xd9, 0x78, 0xce, 0xf8, 0x7c, 0x21, 0x46, 0xb0, 0x7c, 0xd7, 0xa9, 0x9c,
+  0xbc, 0x6f, 0x9a, 0x9c, 0xbb, 0x6e, 0xbc, 0xe4, 0x1e, 0x15, 0xdc, 0xf7, 0xcc, 0xd3, 0x0f, 0xb6,
+  0x8b, 0xd3, 0xfb, 0x01, 0xb5, 0xb9, 0xb8, 0x18, 0x91, 0x5e, 0xe7, 0xb6, 0xd9, 0x66, 0xdc, 0x9b,
+  0xf9, 0x05, 0xa9, 0x49, 0x14, 0x8d, 0xc8, 0x3c, 0xe4, 0x05, 0x9d, 0xf1, 0x1b, 0x4b, 0xb0, 0x25,
+  0xb4, 0x0b, 0x66, 0x81, 0xc7, 0xe2, 0xa5, 0x07, 0xce, 0x0c, 0x59, 0xc0, 0xa8, 0x68, 0xd1, 0x58,
+  0xf8, 0xd6, 0x8c, 0x8b, 0x2d, 0x02, 0xfa, 0x2e, 0xe9, 0xb3, 0xd6, 0xa0, 0x07, 0x8b, 0xda, 0x22,
+  0xfd, 0x59, 0xd8, 0x2e, 0x44, 0xc3, 0x9c, 0x06, 0x45, 0x7b, 0xd7, 0xf4, 0x34, 0x2a, 0x6c, 0xd9,
+  0x34, 0x74, 0x0a, 0x5a, 0x67, 0x43, 0xf5, 0x95, 0xd9, 0x6d, 0xfc, 0x67, 0x08, 0xf3, 0xf2, 0xb4,
+  0x85, 0xd8, 0xdc, 0x37, 0xb4, 0xbb, 0x6c, 0x06, 0x9e, 0x04, 0x43, 0x93, 0xc8, 0x77, 0xb9, 0x93,
+  0x46, 0xbe, 0x59, 0x4d, 0x97, 0x4e, 0x99, 0x6b, 0xf6, 0x59, 0x7f, 0xdb, 0xb0, 0x07, 0x40, 0xf0,
+  0x6e, 0x65, 0xb0, 0xec, 0x98, 0x62, 0x05, 0x67, 0x3d, 0xa3, 0x6e, 0xcc, 0xae, 0x12, 0x29, 0x1b,
+  0x02, 0x35, 0x55, 0x6a, 0x38, 0x1c, 0x9a, 0x27, 0x8d, 0x21, 0x13, 0x56, 0xac, 0x74, 0xd7, 0xb4,
+  0xd2, 0xdb, 0xb7, 0xf5, 0xc1, 0x09, 0x09, 0x95, 0x4f, 0x43, 0x19, 0xf4, 0x56, 0xc4, 0x6c, 0x4d,
+  0xf0, 0xe7, 0x1d, 0x3e, 0x9b, 0x0d, 0x6d, 0xe7, 0x25, 0x3b, 0x1c, 0xf4, 0x5e, 0xfb, 0x7a, 0x36,
+  0xb3, 0xfb, 0xbd, 0x3d, 0x7d, 0xb8, 0x0e, 0xcc, 0xe1, 0xaa, 0x5b, 0xc7, 0x62, 0x58, 0x58, 0x4a,
+  0xe2, 0x5d, 0xe1, 0xc3, 0xa6, 0xe8, 0xe9, 0xed, 0xb4, 0xbf, 0xb3, 0xbb, 0xdd, 0xdb, 0x36, 0x4f,
+  0x61, 0x4d, 0x85, 0x67, 0xda, 0xc7, 0x53, 0x3c, 0x6c, 0xf2, 0x62, 0xe5, 0xf9, 0x35, 0x92, 0x79,
+  0xda, 0x60, 0xb4, 0x72, 0x82, 0x2e, 0x18, 0xbc, 0x6c, 0x0e, 0x6d, 0xa0, 0x64, 0xcd, 0xe9, 0xf9,
+  0x1e, 0xab, 0x74, 0x44, 0xf9, 0x50, 0x88, 0xc3, 0x08, 0x65, 0x06, 0x3e, 0x2f, 0x1f, 0x5c, 0x95,
+  0x01, 0x56, 0x2f, 0xfb, 0x4a, 0x93, 0xf7, 0x4d, 0xdb, 0x69, 0x65, 0xd9, 0xd1, 0xc2, 0x3f, 0x63,
+  0x61, 0x55, 0x00, 0xb2, 0x1e, 0xdd, 0xef, 0xf5, 0x36, 0x48, 0x01, 0x8f, 0xd0, 0xa9, 0xcb, 0x2a,
+  0x53, 0x97, 0x6d, 0xdb, 0x7a, 0x13, 0x78, 0x3e, 0x9e, 0xe2, 0xae, 0x7f, 0xce, 0x1c, 0xed, 0x34,
+  0x91, 0xa0, 0x22, 0x8e, 0xac, 0xb9, 0xef, 0x17, 0xe5, 0xa7, 0x7e, 0x19, 0xec, 0xd3, 0xbd, 0xed,
+  0x9d, 0xda, 0x66, 0x2a, 0xcb, 0x3e, 0xa7, 0xa1, 0x07, 0xc1, 0x61, 0x10, 0xaf, 0x0b, 0x89, 0x2b,
+  0x89, 0x67, 0x61, 0xe8, 0x87, 0x06, 0xe1, 0x8e, 0x3d, 0xdc, 0xb9, 0x9e, 0xee, 0x71, 0xe0, 0xe0,
+  0x61, 0x25, 0x78, 0xe9, 0xf4, 0xde, 0x04, 0x8c, 0xb4, 0x39, 0xaa, 0x18, 0x3c, 0x46, 0xd0, 0xe0,
+  0xfa, 0xd4, 0x29, 0x1b, 0xeb, 0x17, 0x80, 0xb1, 0x6c, 0xb8, 0xef, 0xd7, 0x3a, 0x39, 0xb2, 0x87,
+  0x3d, 0x8b, 0x22, 0x3a, 0x2f, 0x5a, 0xa0, 0x6a, 0xb7, 0x6f, 0xd8, 0x99, 0xa6, 0xdc, 0x97, 0xcb,
+  0x3c, 0xf9, 0x0d, 0x5f, 0x56, 0xa7, 0x13, 0xc5, 0xb6, 0x0d, 0x6f, 0xab, 0x36, 0x84, 0xb3, 0xcd,
+  0x1c, 0x87, 0xea, 0x57, 0xdb, 0xdf, 0xd9, 0xd9, 0x1b, 0x6c, 0x6f, 0xcc, 0xdd, 0xf6, 0x90, 0xed,
+  0xda, 0xd3, 0x4a, 0x45, 0x74, 0xb1, 0x97, 0x4f, 0x78, 0xfb, 0xce, 0x9e, 0x49, 0x8d, 0xbd, 0x41,
+  0xdf, 0xae, 0xa1, 0xc6, 0x6c, 0xc7, 0xd6, 0xa8, 0x71, 0xd0, 0x4d, 0xb0, 0xfc, 0x41, 0x57, 0xd1,
+  0x94, 0x83, 0xa9, 0xef, 0x5c, 0x24, 0x30, 0xdf, 0xe1, 0x67, 0xc4, 0x76, 0x69, 0x14, 0x8d, 0x1b,
+  0x48, 0x44, 0x28, 0x60, 0xf0, 0xb0, 0xb1, 0x86, 0xfd, 0x07, 0x8b, 0xfe, 0xe4, 0xe7, 0x1f, 0x3e,
+  0xff, 0x86, 0xe4, 0x98, 0x06, 0x08, 0xea, 0xaf, 0xfb, 0xac, 0x3b, 0x67, 0x84, 0x79, 0xf4, 0x2c,
+  0x23, 0x46, 0xb6, 0xd2, 0x94, 0x6b, 0x34, 0x26, 0x2f, 0xfe, 0xf8, 0x67, 0xf2, 0x88, 0x09, 0x3f,
+  0x0e, 0x09, 0x8d, 0x89, 0xc0, 0x9c, 0x05, 0xaf, 0x0e, 0x93, 0x8b, 0x3a, 0xe8, 0xd2, 0x8c, 0x02,
+  0x5d, 0x10, 0x6a, 0x9a, 0x8b, 0x3b, 0xe3, 0x46, 0x62, 0xdf, 0x46, 0x3a, 0x71, 0xfa, 0x79, 0xb2,
+  0x71, 0x64, 0xb2, 0x7f, 0x56, 0x23, 0xd3, 0xcf, 0x79, 0xb5, 0xef, 0x01, 0x93, 0x9b, 0xb3, 0x25,
+  0xec, 0x24, 0xd0, 0x2f, 0x22, 0x8e, 0xef, 0x79, 0x97, 0x3f, 0xc1, 0x1b, 0x57, 0x99, 0x22, 0xea,
+  0x74, 0x3a, 0x57, 0x50, 0x16, 0x10, 0xf1, 0x3d, 0xc5, 0xf7, 0x1a, 0x44, 0x7a, 0x65, 0xdc, 0xc8,
+  0xc7, 0x72, 0xd1, 0x68, 0x37, 0x2d, 0x8b, 0x9c, 0xc0, 0x28, 0xf2, 0x84, 0x47, 0x31, 0x75, 0xc9,
+  0x61, 0xc2, 0xc0, 0x2c, 0xab, 0xd0, 0x31, 0x63, 0xfb, 0x2c, 0x55, 0x2b, 0xc8, 0xd3, 0x76, 0x95,
+  0xec, 0xa3, 0xb1, 0x52, 0xf0, 0x68, 0xe9, 0x7f, 0xc0, 0x1b, 0xe8, 0xf6, 0xbf, 0x14, 0x16, 0xa4,
+  0x93, 0xb0, 0xa6, 0x2e, 0x4a, 0x82, 0xfc, 0xfc, 0x00, 0x3f, 0x4e, 0x2c, 0xab, 0xc6, 0xf8, 0x2c,
+  0xfb, 0xd0, 0x28, 0xab, 0xb8, 0x68, 0x40, 0x3d, 0x29, 0x3c, 0xdf, 0x19, 0xe5, 0x63, 0xd3, 0xe4,
+  0x16, 0x49, 0x1a, 0xc0, 0x33, 0xe5, 0xc9, 0xca, 0x3a, 0x68, 0xbe, 0x32, 0x58, 0xfd, 0x3e, 0x40,
+  0xcf, 0x70, 0xa9, 0xa8, 0xd1, 0x3d, 0xe0, 0x04, 0xd1, 0x66, 0xc3, 0x23, 0x5a, 0xdd, 0x60, 0xf5,
+  0x15, 0xc5, 0x30, 0x2d, 0xb8, 0xd8, 0x57, 0xe2, 0xfc, 0xc6, 0xe4, 0xf2, 0xd3, 0x79, 0x66, 0x0f,
+  0x6a, 0x4d, 0xab, 0x1d, 0x2e, 0x01, 0xbb, 0x72, 0x0f, 0x86, 0x6d, 0xf8, 0xda, 0xbc, 0xca, 0x3b,
+  0x5a, 0x11, 0x08, 0xbf, 0x1b, 0x93, 0x0f, 0x60, 0xc7, 0x46, 0x26, 0xa7, 0xea, 0xbf, 0xfe, 0x55,
+  0x0c, 0xa1, 0xb2, 0xd1, 0xd1, 0x33, 0x6a, 0x8b, 0xeb, 0x1a, 0x82, 0xe1, 0x60, 0x29, 0xe7, 0x7a,
+  0xa6, 0xe8, 0x92, 0xfd, 0x4e, 0xef, 0xb7, 0x60, 0x0a, 0x3f, 0xe2, 0x32, 0x3c, 0x4f, 0x7c, 0xc1,
+  0xe2, 0xf0, 0x9a, 0xd6, 0x58, 0xfa, 0xc2, 0x0f, 0x53, 0x51, 0xd7, 0x35, 0xc8, 0xa0, 0xb7, 0xbd,
+  0x0f, 0x27, 0xfe, 0x6f, 0x21, 0x40, 0x2e, 0xff, 0x04, 0x88, 0xef, 0x9a, 0xb6, 0x90, 0x70, 0xfa,
+  0x54, 0x22, 0xc6, 0xaa, 0x1c, 0x76, 0xcd, 0xb4, 0x72, 0x6f, 0xcd, 0xd7, 0xc8, 0x69, 0xc2, 0xd7,
+  0xaa, 0x72, 0x8a, 0x86, 0xdf, 0xe9, 0xb2, 0xcb, 0x62, 0x38, 0x79, 0xf1, 0xed, 0x37, 0xff, 0xfb,
+  0xcf, 0x17, 0xd9, 0x09, 0xe0, 0x9c, 0x1e, 0x6a, 0xfa, 0x06, 0xa6, 0x34, 0x2b, 0x42, 0xdf, 0x9b,
+  0x4f, 0x0e, 0x19, 0x80, 0xf0, 0xcb, 0x7f, 0x86, 0x8c, 0x64, 0xe6, 0x1e, 0x21, 0x8a, 0x90, 0xcd,
+  0x64, 0x43, 0x8e, 0x06, 0xb5, 0x85, 0xd4, 0x21, 0x93, 0xa0, 0x35, 0xd6, 0x0b, 0x74, 0x8a, 0xad,
+  0xed, 0x7f, 0xc8, 0x00, 0x8b, 0xb8, 0xd1, 0xea, 0x94, 0x4c, 0xd1, 0x60, 0x5f, 0xa1, 0xc1, 0x52,
+  0x95, 0x23, 0x87, 0x4f, 0x4d, 0xc1, 0x52, 0xb4, 0xbf, 0xa3, 0x26, 0x01, 0xb2, 0xea, 0xba, 0x64,
+  0xca, 0x08, 0xf7, 0x22, 0x16, 0x0a, 0xa0, 0x4f, 0x0b, 0x86, 0xe5, 0x54, 0xab, 0xae, 0xde, 0xd3,
+  0x58, 0x08, 0x10, 0x97, 0xf5, 0x18, 0xd2, 0xb1, 0x4c, 0x38, 0xbd, 0x8e, 0x9f, 0x7c, 0xcf, 0x76,
+  0xb9, 0xfd, 0x74, 0xdc, 0x08, 0x59, 0x6a, 0x59, 0x86, 0xa7, 0x4c, 0xab, 0x6d, 0x50, 0xf8, 0xe7,
+  0x1f, 0xbe, 0xfa, 0x0c, 0x70, 0x92, 0xea, 0x0c, 0xf4, 0xf0, 0x84, 0x22, 0x49, 0xf5, 0xa8, 0x27,
+  0x34, 0x8a, 0x29, 0x25, 0xb4, 0x56, 0xcd, 0xd9, 0x30, 0xa1, 0xa4, 0x88, 0xfe, 0xcd, 0x56, 0x4c,
+  0xaa, 0x01, 0x06, 0xbd, 0x5e, 0x7c, 0xfb, 0x23, 0x46, 0xda, 0x31, 0x25, 0xeb, 0x95, 0xa0, 0x3d,
+  0x83, 0x90, 0x79, 0x0e, 0x61, 0xde, 0x19, 0x87, 0x48, 0x01, 0x82, 0x41, 0x20, 0x60, 0x7d, 0x0f,
+  0x60, 0xd3, 0x66, 0x3b, 0x6e, 0xdc, 0x3b, 0x99, 0x2d, 0x91, 0x21, 0x5c, 0x1a, 0x05, 0xd7, 0xe1,
+  0xbb, 0xe4, 0x70, 0x48, 0x5c, 0xfe, 0x48, 0xf0, 0xd4, 0x1a, 0x15, 0x22, 0xf4, 0x1d, 0x29, 0xc3,
+  0x14, 0xa2, 0x05, 0x6d, 0x32, 0x1f, 0x33, 0x6f, 0x93, 0x3a, 0xb9, 0x1d, 0xf2, 0x40, 0xac, 0xfb,
+  0x76, 0xbb, 0x0a, 0x39, 0xa8, 0x5a, 0x31, 0x43, 0x2c, 0xb5, 0x5e, 0x3e, 0x58, 0x23, 0x12, 0xe4,
+  0xe4, 0xe1, 0xc3, 0x07, 0xbf, 0x3f, 0x3a, 0x79, 0xf8, 0xd6, 0xfd, 0x53, 0x32, 0x26, 0xef, 0x36,
+  0x11, 0x69, 0x35, 0xb7, 0x08, 0xbe, 0xfe, 0x35, 0x79, 0xfd, 0x32, 0x79, 0xfd, 0x2a, 0x79, 0xfd,
+  0x5b, 0xf2, 0xfa, 0xf7, 0xe4, 0xf5, 0xeb, 0xe4, 0xf5, 0x1f, 0xcd, 0xf7, 0xef, 0x94, 0xf1, 0x26,
+  0xe8, 0xa0, 0xd6, 0x47, 0x10, 0x91, 0x10, 0x78, 0x47, 0x57, 0x6d, 0xb3, 0xd8, 0x53, 0x49, 0x47,
+  0x59, 0x11, 0x75, 0x3d, 0x84, 0xf6, 0x56, 0xbb, 0x58, 0x5c, 0x63, 0xc2, 0x5e, 0xb4, 0x9a, 0x5d,
+  0x1a, 0xf0, 0x2e, 0x4a, 0xb9, 0x4b, 0xe5, 0xb0, 0xb1, 0xa2, 0xd2, 0xcd, 0x76, 0xc9, 0xee, 0x1d,
+  0xb1, 0x60, 0x5e, 0x0b, 0x10, 0x71, 0x00, 0x8b, 0x64, 0x64, 0x3c, 0x21, 0xe9, 0xfb, 0xce, 0x07,
+  0x11, 0x06, 0xb9, 0x69, 0x48, 0xb4, 0xf0, 0xcf, 0x53, 0x35, 0x34, 0x7d, 0x6c, 0x8a, 0x8a, 0x28,
+  0xfa, 0x04, 0x42, 0x3f, 0xd6, 0x46, 0x24, 0x1a, 0xd6, 0x77, 0x13, 0x96, 0xd5, 0x6a, 0x1e, 0xc9,
+  0xde, 0x72, 0x09, 0xc8, 0x90, 0x57, 0x56, 0x18, 0x81, 0xd9, 0x64, 0x97, 0x42, 0xb5, 0x78, 0xc5,
+  0x2b, 0x7d, 0x3b, 0x46, 0xa8, 0xdf, 0x99, 0x33, 0x71, 0xe4, 0x4a, 0xd4, 0xff, 0xfa, 0xc5, 0x7d,
+  0xa7, 0xd5, 0x4c, 0xb8, 0x41, 0xb3, 0xdd, 0xe1, 0x1e, 0x30, 0xa4, 0x37, 0x1f, 0x9f, 0x1c, 0x83,
+  0xeb, 0xb4, 0x32, 0xf0, 0xaf, 0xa9, 0x82, 0x2d, 0xd9, 0x77, 0x85, 0x12, 0x03, 0xd0, 0x9f, 0xef,
+  0x3f, 0x27, 0xa0, 0x22, 0x1c, 0xd7, 0xc8, 0x79, 0xec, 0x15, 0xc3, 0xe8, 0x40, 0xe8, 0x38, 0xb1,
+  0xcb, 0x52, 0x72, 0x81, 0x94, 0x40, 0x72, 0x5d, 0xdf, 0xe3, 0x40, 0x91, 0xee, 0x26, 0xa1, 0xda,
+  0xd4, 0x2b, 0x2f, 0xed, 0xa8, 0xd8, 0x8f, 0xb4, 0x00, 0xc3, 0xa8, 0xbf, 0xbf, 0x0c, 0xfc, 0x28,
+  0xc2, 0xd1, 0xeb, 0xa9, 0x42, 0xe2, 0xea, 0x98, 0x0c, 0x86, 0x94, 0x34, 0x4e, 0x53, 0x63, 0x9d,
+  0xe7, 0x6d, 0x1d, 0xbb, 0xcd, 0x46, 0xdc, 0x29, 0x4c, 0xaf, 0x2c, 0xad, 0x42, 0x84, 0xb4, 0x0c,
+  0xb1, 0x43, 0xc0, 0x35, 0x12, 0x2a, 0x37, 0x08, 0x3b, 0x83, 0x55, 0xb7, 0xcb, 0xb1, 0x99, 0x0d,
+  0x89, 0x16, 0x3a, 0xae, 0x18, 0x9d, 0x35, 0x1c, 0xa5, 0x6e, 0xb4, 0xd2, 0x1b, 0xab, 0x31, 0x69,
+  0x22, 0xbf, 0x2a, 0x98, 0xce, 0x28, 0x26, 0x43, 0xd4, 0x74, 0xa2, 0x64, 0xc1, 0xb3, 0x20, 0x2b,
+  0xf7, 0xa1, 0xb8, 0x03, 0xd5, 0xd0, 0xfa, 0x73, 0x4b, 0x0e, 0x06, 0x33, 0x63, 0x35, 0x27, 0xd1,
+  0x03, 0xe6, 0xcd, 0x24, 0x8e, 0x77, 0xd1, 0x2a, 0xea, 0xde, 0xe8, 0x7d, 0xf2, 0xc9, 0x27, 0x44,
+  0x25, 0x91, 0x9a, 0xab, 0x5b, 0x71, 0xb4, 0xd2, 0x0c, 0x6b, 0xa9, 0xd8, 0x5c, 0x53, 0x5c, 0x96,
+  0x95, 0xe9, 0x25, 0x66, 0x7b, 0x74, 0x84, 0xff, 0x06, 0x7f, 0xc6, 0x9c, 0x56, 0xbf, 0x5d, 0xcb,
+  0x80, 0xf2, 0x02, 0x09, 0x21, 0x60, 0x54, 0x33, 0x02, 0x12, 0x86, 0xa3, 0xd7, 0x24, 0x6d, 0x5d,
+  0x69, 0x31, 0x68, 0xd7, 0x5c, 0xe5, 0x9a, 0x30, 0xe8, 0x25, 0xaf, 0xdb, 0x57, 0xb2, 0x87, 0xed,
+  0xda, 0xe1, 0x96, 0x81, 0xdf, 0x7a, 0xf1, 0x76, 0x0c, 0x3b, 0xda, 0x13, 0xa7, 0x82, 0x05, 0x91,
+  0x74, 0xb8, 0x65, 0xd5, 0x0b, 0xc0, 0xec, 0x01, 0xad, 0x36, 0xe0, 0x8d, 0x62, 0xe6, 0x14, 0x24,
+  0x83, 0x79, 0x71, 0x42, 0x93, 0x9e, 0x99, 0x6e, 0xc5, 0x24, 0xc1, 0x67, 0xa4, 0xa5, 0x14, 0x4d,
+  0xa1, 0x8d, 0xd3, 0xd6, 0x24, 0xeb, 0x8c, 0x84, 0xc2, 0x2a, 0x9b, 0x2f, 0xbe, 0xfb, 0x32, 0x41,
+  0x67, 0x97, 0x3f, 0x69, 0x52, 0x5c, 0x76, 0xa4, 0x04, 0x02, 0x18, 0xa1, 0x38, 0x2e, 0x73, 0x27,
+  0x95, 0x29, 0x51, 0x17, 0x24, 0x3c, 0x27, 0xcc, 0x2d, 0xdd, 0xdd, 0x6e, 0x54, 0xe8, 0x6b, 0xf2,
+  0x00, 0x71, 0xdd, 0x4b, 0x51, 0x4a, 0xa5, 0xd6, 0x82, 0x56, 0x75, 0x1c, 0x88, 0x70, 0x25, 0xeb,
+  0x45, 0xbd, 0xd9, 0x1d, 0x7a, 0x11, 0x9d, 0x72, 0xcf, 0x66, 0x59, 0x80, 0x7b, 0x73, 0x3c, 0x26,
+  0x31, 0x00, 0xb0, 0x19, 0xf7, 0x0c, 0xee, 0x90, 0xde, 0xc7, 0xb1, 0x69, 0x9c, 0xe9, 0xe4, 0x94,
+  0xd7, 0x6d, 0xde, 0x7d, 0x29, 0xfa, 0x2f, 0x45, 0xb1, 0xfe, 0xc0, 0xc5, 0x99, 0x0f, 0x48, 0x9f,
+  0xdc, 0x25, 0x8d, 0xd7, 0x62, 0x04, 0x6a, 0x4e, 0x73, 0x11, 0xf3, 0x06, 0x19, 0x55, 0xf6, 0x1f,
+  0x60, 0xff, 0x37, 0x39, 0x0b, 0xa1, 0xa3, 0xb1, 0x5f, 0x26, 0xd1, 0x90, 0x57, 0x49, 0x43, 0xc2,
+  0xc0, 0xa8, 0x71, 0x67, 0x33, 0x01, 0x4d, 0x0f, 0x33, 0xbb, 0x4c, 0x15, 0x4a, 0x7d, 0x5d, 0x96,
+  0xf8, 0x26, 0x21, 0x2c, 0xe8, 0x7b, 0x4d, 0x9c, 0x28, 0x37, 0x81, 0xee, 0x93, 0x31, 0x19, 0xec,
+  0xb7, 0x4d, 0x28, 0xa6, 0x20, 0x28, 0xc1, 0xd9, 0x0a, 0x4c, 0x24, 0xe0, 0x37, 0x7f, 0x53, 0xd2,
+  0x98, 0x3c, 0xca, 0x21, 0x70, 0xc0, 0xe3, 0xfe, 0x72, 0x49, 0x3d, 0x07, 0x4e, 0x76, 0xd2, 0x9a,
+  0x0c, 0xf6, 0xd5, 0xaa, 0xdb, 0x66, 0xe4, 0x90, 0x6c, 0x8c, 0x9c, 0x82, 0x3b, 0xb5, 0x15, 0xfc,
+  0xec, 0xbf, 0xa8, 0x60, 0x5e, 0x87, 0x29, 0x3e, 0xbd, 0x71, 0xf9, 0x6f, 0x41, 0x00, 0x5e, 0x60,
+  0xed, 0x1d, 0xc1, 0x85, 0x79, 0xe2, 0x9a, 0x13, 0x41, 0x6e, 0xd0, 0x99, 0x01, 0x77, 0x7a, 0x63,
+  0x92, 0x0d, 0xf9, 0x10, 0x27, 0xf5, 0xb0, 0x2c, 0x64, 0x5c, 0x71, 0xfd, 0x68, 0xce, 0xaa, 0x51,
+  0xc0, 0x7e, 0xd9, 0xa6, 0x9a, 0xa9, 0xe6, 0x1a, 0x9b, 0xa6, 0xf9, 0x16, 0x5d, 0x52, 0x1e, 0x35,
+  0xef, 0xbc, 0x14, 0x9d, 0xb5, 0xa6, 0xae, 0x8a, 0x32, 0x99, 0xb3, 0xf2, 0xf6, 0x4d, 0x9e, 0x48,
+  0x62, 0x10, 0x6a, 0x1f, 0xc6, 0x40, 0xb0, 0xf4, 0x76, 0xae, 0x95, 0xd8, 0x90, 0xc0, 0xc1, 0x44,
+  0xcb, 0xe0, 0x46, 0x6d, 0x2b, 0xa9, 0x91, 0x25, 0x33, 0x79, 0xec, 0x9c, 0x00, 0x56, 0x64, 0x2d,
+  0x68, 0xf0, 0x8f, 0x7d, 0x7c, 0x58, 0xea, 0x31, 0x08, 0x3f, 0x15, 0x21, 0xec, 0x91, 0x56, 0x73,
+  0x16, 0x5a, 0x6f, 0x3c, 0x6a, 0x6e, 0x44, 0xb0, 0xeb, 0x30, 0x4e, 0x60, 0x5b, 0x2b, 0x8c, 0xbd,
+  0x88, 0x50, 0xf8, 0x0f, 0xdb, 0x68, 0x0a, 0xfc, 0x9d, 0x00, 0x61, 0x01, 0x13, 0x01, 0xf8, 0xdb,
+  0x02, 0xee, 0xac, 0xee, 0x4a, 0x65, 0xb1, 0x40, 0x83, 0x61, 0x4b, 0x24, 0xbf, 0x10, 0x11, 0xb8,
+  0xe3, 0x6e, 0x42, 0xfe, 0x9d, 0xf1, 0x70, 0xd9, 0x6a, 0x96, 0xb8, 0xf4, 0x19, 0x55, 0x74, 0x1a,
+  0x58, 0x80, 0x86, 0x50, 0x77, 0xde, 0xf3, 0x8e, 0x51, 0x49, 0xc9, 0x16, 0xa0, 0x6b, 0x64, 0x53,
+  0xf4, 0x33, 0x09, 0xf0, 0x4a, 0x45, 0x84, 0x7e, 0x8c, 0xb7, 0xc9, 0x2e, 0x88, 0x48, 0xab, 0x83,
+  0x00, 0xfe, 0x61, 0x67, 0xcc, 0x2e, 0x7f, 0x02, 0x99, 0x36, 0x83, 0xe1, 0xef, 0x49, 0x7c, 0xcb,
+  0xbd, 0x98, 0x85, 0x77, 0x9b, 0x6d, 0xdd, 0x86, 0x0f, 0x99, 0x88, 0x43, 0xaf, 0xb6, 0x5f, 0xd5,
+  0x51, 0x82, 0x4f, 0x09, 0x6c, 0x02, 0x10, 0xaf, 0x0b, 0xaf, 0x88, 0x1e, 0x60, 0x58, 0x67, 0x75,
+  0x79, 0x3d, 0x86, 0x15, 0xc4, 0xac, 0xdc, 0xa1, 0x78, 0x3c, 0x7f, 0xf1, 0xaf, 0x5c, 0x35, 0x87,
+  0x41, 0xf4, 0x62, 0xb2, 0xeb, 0x74, 0x3a, 0xa4, 0x77, 0xab, 0x0a, 0x1c, 0xe5, 0x98, 0x92, 0x2c,
+  0xb2, 0x98, 0xe4, 0x3c, 0x61, 0x31, 0x60, 0x57, 0xf6, 0x11, 0x09, 0xa0, 0x4d, 0xde, 0xa6, 0x66,
+  0xbd, 0x80, 0x8c, 0x29, 0xb9, 0x60, 0x6c, 0x56, 0x81, 0x59, 0x13, 0x97, 0xce, 0x84, 0xc8, 0xcb,
+  0x24, 0xd4, 0x78, 0x8e, 0x9b, 0xa9, 0xb2, 0x8c, 0x3b, 0x85, 0xca, 0x01, 0x12, 0x88, 0x45, 0x08,
+  0x27, 0x1d, 0xee, 0x1f, 0xc9, 0x99, 0x15, 0x96, 0xa8, 0xa2, 0xc8, 0x2a, 0xec, 0x33, 0xf6, 0x6a,
+  0xa5, 0xb2, 0x74, 0xa4, 0xd1, 0x44, 0xe7, 0x33, 0x91, 0x7e, 0x54, 0x98, 0x4c, 0xbf, 0x37, 0xdf,
+  0x86, 0x69, 0xd5, 0xee, 0xcb, 0x78, 0x0a, 0x37, 0x65, 0x0c, 0x41, 0xec, 0x12, 0x2e, 0xc0, 0x6d,
+  0x19, 0x86, 0xb0, 0xda, 0x85, 0x65, 0x75, 0xb9, 0x53, 0x55, 0xea, 0x00, 0x91, 0x51, 0xb7, 0x09,
+  0x78, 0x01, 0xba, 0xbd, 0x3c, 0x8f, 0xa0, 0xa2, 0xd5, 0x0e, 0x81, 0x1e, 0x5a, 0x7f, 0xe0, 0xf7,
+  0x55, 0xee, 0x30, 0x56, 0x43, 0xae, 0xbd, 0x15, 0xb3, 0x6a, 0xe1, 0xec, 0x78, 0x14, 0xc0, 0x5a,
+  0x01, 0x49, 0x36, 0x3f, 0x8c, 0x59, 0xcc, 0x9c, 0x26, 0xd2, 0x8f, 0x42, 0x0b, 0x24, 0x4a, 0x4f,
+  0xd2, 0x6e, 0xc3, 0x1a, 0xaf, 0xb1, 0x85, 0xd1, 0x09, 0x38, 0x4b, 0x10, 0xfa, 0xf3, 0x10, 0xaf,
+  0xf0, 0x5f, 0x25, 0xcd, 0x5b, 0x86, 0xd2, 0x87, 0xdc, 0xd4, 0x4c, 0x60, 0xce, 0xf7, 0x63, 0xd1,
+  0x82, 0x5c, 0x0b, 0xd6, 0xd6, 0xba, 0x7e, 0x0b, 0x1f, 0x49, 0xea, 0xb5, 0xcd, 0x62, 0x74, 0x59,
+  0xcf, 0x8c, 0x1c, 0x8c, 0x2e, 0x28, 0x24, 0xb4, 0x19, 0x05, 0x48, 0x70, 0xe7, 0x46, 0x4d, 0xb3,
+  0x98, 0xeb, 0xbe, 0xcd, 0x2b, 0x44, 0x41, 0xea, 0x40, 0x30, 0x5e, 0xec, 0x8a, 0xf4, 0x49, 0x88,
+  0x2a, 0x0f, 0x65, 0xf3, 0xa2, 0xb1, 0x93, 0xc2, 0x0c, 0xdf, 0xfd, 0x81, 0x14, 0x50, 0x57, 0x1c,
+  0x45, 0x9c, 0xdd, 0x7c, 0xcf, 0x03, 0xbf, 0x55, 0x8f, 0x7d, 0x02, 0xa7, 0x33, 0x56, 0xbe, 0x62,
+  0x12, 0x70, 0x7b, 0xb4, 0xf2, 0x73, 0xa2, 0x66, 0xc0, 0xe8, 0xd3, 0x27, 0x92, 0x37, 0x81, 0xbf,
+  0x49, 0x17, 0xdc, 0x35, 0x18, 0xd6, 0x10, 0x7a, 0x18, 0x83, 0x0a, 0x4c, 0x49, 0xcb, 0xae, 0xda,
+  0x89, 0x13, 0x0d, 0xbb, 0xca, 0xf1, 0x79, 0x52, 0xd0, 0x84, 0x14, 0x5e, 0x2d, 0x37, 0x4d, 0xef,
+  0xc6, 0x5e, 0x15, 0xa1, 0x54, 0xac, 0xb0, 0x1a, 0x82, 0xaa, 0x0a, 0x07, 0x5f, 0xd1, 0x2b, 0xdf,
+  0x7f, 0x9e, 0xf3, 0x0a, 0x40, 0xe1, 0x85, 0x1f, 0x83, 0x5d, 0x3a, 0x57, 0x75, 0x0b, 0x62, 0x88,
+  0x00, 0xa2, 0x16, 0x0b, 0x87, 0x1b, 0x5c, 0x74, 0x40, 0x86, 0xbd, 0x5e, 0x1d, 0xf9, 0x80, 0x3d,
+  0xf8, 0x8c, 0xc3, 0x59, 0xea, 0x62, 0x16, 0x0f, 0xf0, 0xb6, 0x92, 0x1c, 0x1f, 0x3e, 0x22, 0xc0,
+  0xa0, 0xb0, 0x3a, 0xc9, 0x23, 0x48, 0x2f, 0xb2, 0x48, 0xb9, 0x5e, 0x41, 0x67, 0x93, 0x7b, 0x14,
+  0xa9, 0xbe, 0xaa, 0x73, 0x9e, 0xff, 0x6a, 0x27, 0xd5, 0xea, 0xdc, 0x29, 0x0e, 0x53, 0x05, 0xec,
+  0x76, 0xe9, 0xe1, 0x33, 0x4d, 0xd9, 0x1a, 0x42, 0x16, 0x8b, 0xd6, 0x39, 0x38, 0x68, 0x2a, 0x5c,
+  0xbf, 0x4c, 0xd0, 0xa5, 0xc9, 0x51, 0xbf, 0x24, 0x37, 0xe5, 0x40, 0x56, 0xa1, 0xe2, 0x0d, 0x1c,
+  0x35, 0xf6, 0xb8, 0xad, 0xa2, 0xd4, 0xf5, 0xc3, 0x08, 0xbf, 0x75, 0x0b, 0x10, 0x58, 0x5b, 0x8f,
+  0xae, 0xaa, 0x3d, 0xab, 0xc9, 0x0c, 0xd5, 0xe4, 0x44, 0x13, 0x5c, 0xcd, 0x16, 0x11, 0x17, 0x01,
+  0xd3, 0xf9, 0x42, 0x90, 0x65, 0x34, 0xaf, 0x32, 0x65, 0x32, 0x47, 0xd1, 0x92, 0x30, 0xaa, 0x60,
+  0x27, 0xfc, 0x54, 0xee, 0x93, 0x2b, 0x11, 0xa5, 0x4f, 0xcc, 0xe1, 0xee, 0x42, 0x85, 0xca, 0xdd,
+  0xaf, 0x5e, 0x77, 0x2e, 0x1d, 0x82, 0xe5, 0xb4, 0xa2, 0x15, 0xac, 0xa9, 0x8d, 0x3f, 0xdf, 0x22,
+  0xfb, 0xf9, 0xa3, 0x52, 0x6f, 0xfb, 0x93, 0x4c, 0xc9, 0x3f, 0x88, 0xa3, 0x05, 0xc4, 0xd2, 0xf4,
+  0x62, 0x4d, 0x94, 0xc8, 0x39, 0x00, 0x20, 0xc4, 0x67, 0xf6, 0x82, 0x7a, 0x73, 0x96, 0x5e, 0x0b,
+  0xc8, 0xca, 0x7f, 0xb4, 0xde, 0x75, 0x78, 0x58, 0x9d, 0x73, 0xcf, 0xf1, 0xcf, 0x3b, 0x47, 0xd8,
+  0x74, 0x0a, 0x30, 0xc0, 0x36, 0xf8, 0x48, 0x8d, 0x4d, 0x68, 0x5f, 0xa6, 0x77, 0x02, 0xe1, 0x54,
+  0x73, 0xd1, 0x45, 0xea, 0xdb, 0x0e, 0x75, 0x1c, 0x39, 0xe2, 0x98, 0x47, 0xe0, 0x29, 0x16, 0xaa,
+  0x72, 0x3b, 0xee, 0x2e, 0xb4, 0x56, 0xee, 0xde, 0xe1, 0xad, 0xd3, 0x87, 0x0f, 0x3a, 0x01, 0xfe,
+  0x8e, 0xa7, 0x05, 0xb6, 0xc2, 0x4b, 0x88, 0xec, 0x8f, 0x0c, 0xb4, 0x69, 0x1b, 0xcc, 0xf1, 0x1a,
+  0xfe, 0x46, 0x21, 0x64, 0x33, 0xc8, 0x95, 0x0b, 0x9c, 0x34, 0xbc, 0x20, 0xbb, 0x29, 0x63, 0x88,
+  0x8a, 0xbe, 0xba, 0x8f, 0x8c, 0xe2, 0x8c, 0xba, 0xad, 0xfc, 0x51, 0xb1, 0x05, 0x43, 0xca, 0x28,
+  0xc5, 0x7c, 0x9c, 0xac, 0x9e, 0xf3, 0x4b, 0xee, 0x22, 0x0f, 0xba, 0xea, 0x09, 0xbf, 0x83, 0xae,
+  0xfa, 0x79, 0xd2, 0xff, 0x01, 0x5c, 0x23, 0xf8, 0x49, 0xb6, 0x34, 0x00, 0x00,
+};
+static const WebAsset WEBASSET_MOON = {WEBASSET_MOON_DATA, 3309, "\"5cf50ec7\"", "text/html", "gzip"};
+
+static const uint8_t WEBASSET_STYLE_DATA[280] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6d, 0x51, 0xd1, 0x6e, 0x83, 0x30,
+  0x0c, 0x7c, 0xe7, 0x2b, 0x2c, 0xed, 0x65, 0x93, 0x9a, 0x2a, 0x94, 0x55, 0xaa, 0xd2, 0xa7, 0xaa,
+  0xd2, 0xfe, 0xc3, 0x90, 0x00, 0xd6, 0x68, 0x52, 0x39, 0xa1, 0xd0, 0x4d, 0xfd, 0xf7, 0x05, 0x4a,
+  0x19, 0xea, 0x16, 0xbf, 0xd9, 0xe7, 0x3b, 0xdf, 0x25, 0x77, 0xfa, 0x0a, 0xdf, 0x09, 0xc4, 0x57,
+  0x3a, 0x1b, 0x44, 0x89, 0x27, 0x6a, 0xae, 0x0a, 0x0e, 0x4c, 0xd8, 0xac, 0xc0, 0xa3, 0xf5, 0xc2,
+  0x1b, 0xa6, 0x72, 0x3f, 0x62, 0x4e, 0xd8, 0x8b, 0x8e, 0x74, 0xa8, 0x15, 0xec, 0xa4, 0x3c, 0xf7,
+  0x8f, 0x2e, 0x57, 0x64, 0x15, 0x6c, 0x63, 0x07, 0xb0, 0x0d, 0xee, 0xde, 0x3e, 0xa3, 0xd6, 0x64,
+  0x2b, 0x05, 0x9b, 0x19, 0x99, 0x63, 0xf1, 0x59, 0xb1, 0x6b, 0xad, 0x56, 0xf0, 0x52, 0xca, 0xa1,
+  0xf6, 0xc9, 0x2d, 0x59, 0x17, 0x51, 0x1b, 0xc9, 0x1a, 0x9e, 0x6e, 0x59, 0xe2, 0xba, 0x9a, 0x82,
+  0x79, 0x62, 0xcc, 0x7e, 0x19, 0x1d, 0x6b, 0xc3, 0x82, 0x51, 0x53, 0xeb, 0x15, 0xa4, 0x8b, 0x41,
+  0x2f, 0x7c, 0x8d, 0xda, 0x75, 0x0a, 0x24, 0x6c, 0xe2, 0x65, 0xc3, 0x0c, 0xb8, 0xca, 0xf1, 0x55,
+  0xae, 0xc6, 0x5a, 0xa7, 0x6f, 0x83, 0x7a, 0x9d, 0x4e, 0xaa, 0x85, 0x6b, 0x1c, 0xc7, 0xc3, 0xb2,
+  0x2c, 0xbb, 0x73, 0x04, 0xd3, 0x07, 0x81, 0x0d, 0x55, 0xd1, 0x5c, 0x61, 0x6c, 0x30, 0x3c, 0x5e,
+  0x6b, 0xf1, 0x32, 0x6d, 0xfc, 0x07, 0x58, 0x26, 0x32, 0x38, 0x07, 0x39, 0x2f, 0xe1, 0x93, 0xd0,
+  0xfb, 0xf1, 0xf0, 0xb1, 0x95, 0x0b, 0x2d, 0x6d, 0x0a, 0xc7, 0x18, 0xc8, 0xc5, 0x5d, 0xeb, 0xec,
+  0x64, 0x7b, 0xfc, 0x19, 0x4f, 0x5f, 0x26, 0xfa, 0xdb, 0x3d, 0x87, 0x2e, 0x27, 0xcf, 0x0f, 0x09,
+  0x55, 0xbb, 0xcb, 0x9c, 0xe3, 0x1f, 0xd2, 0x98, 0xa8, 0xe1, 0x86, 0x06, 0xe6, 0x5b, 0xf2, 0x03,
+  0x14, 0x21, 0x0e, 0x74, 0xfd, 0x01, 0x00, 0x00,
+};
+static const WebAsset WEBASSET_STYLE = {WEBASSET_STYLE_DATA, 280, "\"42738088\"", "text/css", "gzip"};
+
+#endif // WEBASSETS_H
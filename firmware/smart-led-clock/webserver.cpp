@@ -9,500 +9,1425 @@
  */
 
 #include "webserver.h"
+#include "printstream.h"
+#include "jsonwriter.h"
+#include "webassets.h"
 
 // ==========================================
 // GLOBAL WEB SERVER
 // ==========================================
 WiFiServer webServer(80);
 
+// Response being sent. Responses never interleave (each is written in
+// full before the next request is looked at): all connections share
+// this one segment.
+static uint8_t responseBuffer[WEB_WRITE_SIZE];
+
+// Body of the stream response being printed (see ResponseBody)
+static uint8_t bodyBuffer[WEB_BODY_SIZE];
+
 // ==========================================
 // HELPER FUNCTIONS
 // ==========================================
 
 /**
- * @brief Extract integer value from buffer
+ * @brief Extract a query parameter value
+ * 
+ * @param query Query string (without '?')
+ * @param key Parameter name with '=' (e.g. "tier=")
+ * @return true if found (value left unchanged otherwise)
  */
-static int extractInt(const char* data, const char* key) {
-    char searchStr[64];
-    snprintf(searchStr, sizeof(searchStr), "\"%s\":", key);
-    
-    const char* pos = strstr(data, searchStr);
-    if (pos == NULL) return -999;
+static bool getQueryParam(const char* query, const char* key, char* value, size_t size) {
+    size_t keyLen = strlen(key);
+    const char* pos = query;
     
-    pos += strlen(searchStr);
-    while (*pos == ' ') pos++;  // Skip spaces
+    // Only at the start of a "key=value" pair
+    while (pos != NULL && *pos != '\0') {
+        if (strncmp(pos, key, keyLen) == 0) {
+            pos += keyLen;
+            size_t i = 0;
+            while (i < size - 1 && pos[i] != '&' && pos[i] != '\0') {
+                value[i] = pos[i];
+                i++;
+            }
+            value[i] = '\0';
+            return true;
+        }
+        pos = strchr(pos, '&');
+        if (pos != NULL) pos++;
+    }
+    return false;
+}
+
+/**
+ * @brief Extract a numeric query parameter
+ * 
+ * @return Value, defaultValue if absent
+ */
+static uint32_t getQueryNumber(const char* query, const char* key, uint32_t defaultValue) {
+    char value[12];
+    if (!getQueryParam(query, key, value, sizeof(value))) return defaultValue;
+    return strtoul(value, NULL, 10);
+}
+
+/**
+ * @brief Find a sensor channel by key ("tIn"...)
+ * 
+ * @return Channel id, SENSOR_CHANNEL_COUNT if unknown
+ */
+static uint8_t findChannel(const char* key) {
+    uint8_t channel = 0;
+    while (channel < SENSOR_CHANNEL_COUNT && strcmp(sensorChannels[channel].key, key) != 0) {
+        channel++;
+    }
+    return channel;
+}
+
+/**
+ * @brief Parse the history query parameters
+ * 
+ * since=&from=&to=&limit=&points=&ch= (count= is the former limit)
+ */
+static void getHistoryQuery(const char* query, HistoryQuery* history) {
+    char channelKey[12] = "tIn";
+    history->since = getQueryNumber(query, "since=", 0);
+    history->from = getQueryNumber(query, "from=", 0);
+    history->to = getQueryNumber(query, "to=", 0);
+    history->limit = getQueryNumber(query, "limit=", getQueryNumber(query, "count=", 0));
+    history->points = getQueryNumber(query, "points=", 0);
+    getQueryParam(query, "ch=", channelKey, sizeof(channelKey));
+    history->channel = findChannel(channelKey);
+    if (history->channel >= SENSOR_CHANNEL_COUNT) history->channel = CH_TEMP_INDOOR;
+}
+
+// Content length of a body sent with chunked transfer encoding
+#define BODY_CHUNKED  ((size_t)-1)
+// Content length of a body that ends when the connection closes (HTTP/1.0)
+#define BODY_UNTIL_CLOSE  ((size_t)-2)
+
+/**
+ * @brief Print the status line and headers of a response
+ * 
+ * Formatted at once into the response stream, which sends them with the
+ * start of the body.
+ * 
+ * @param contentLength Body length, BODY_CHUNKED or BODY_UNTIL_CLOSE
+ */
+static void sendHeaders(Print& out, const char* status, const char* contentType,
+                        size_t contentLength, bool keepAlive) {
+    char length[40] = "";
+    if (contentLength == BODY_CHUNKED) {
+        strcpy(length, "Transfer-Encoding: chunked\r\n");
+    } else if (contentLength != BODY_UNTIL_CLOSE) {
+        snprintf(length, sizeof(length), "Content-Length: %lu\r\n", (unsigned long)contentLength);
+    }
     
-    return atoi(pos);
+    char headers[160];
+    int len = snprintf(headers, sizeof(headers),
+        "HTTP/1.1 %s\r\n"
+        "Content-Type: %s\r\n"
+        "%s"
+        "Connection: %s\r\n"
+        "\r\n",
+        status, contentType, length, keepAlive ? "keep-alive" : "close");
+    out.write((const uint8_t*)headers, len);
 }
 
 /**
- * @brief Extract RGB values from nested JSON
+ * @class ResponseBody
+ * @brief Body of a stream response, printed once
+ * 
+ * The body is gathered in bodyBuffer: if it fits, it is sent after its
+ * headers with a Content-Length. If it doesn't, the headers go out with
+ * chunked transfer encoding and each full buffer becomes a chunk; an
+ * HTTP/1.0 client doesn't know chunks, so it gets the bare body, ended
+ * by closing the connection. The stream handler runs only once, so
+ * values read from the clock (ages, elapsed times) can't make a body
+ * disagree with its length.
  */
-static bool extractRGB(const char* data, const char* colorKey, int& r, int& g, int& b) {
-    char searchStr[32];
-    snprintf(searchStr, sizeof(searchStr), "\"%s\":{", colorKey);
+class ResponseBody : public Print {
+public:
+    ResponseBody(Print& out, const char* contentType, const HttpRequest& request)
+        : out(out), contentType(contentType), keepAlive(request.keepAlive),
+          chunkedEncoding(request.version >= 11) {}
+    
+    size_t write(uint8_t b) override {
+        if (used == sizeof(bodyBuffer)) sendChunk();
+        bodyBuffer[used++] = b;
+        return 1;
+    }
+    
+    size_t write(const uint8_t* data, size_t count) override {
+        size_t n = 0;
+        while (n < count) {
+            if (used == sizeof(bodyBuffer)) sendChunk();
+            size_t room = min(sizeof(bodyBuffer) - used, count - n);
+            memcpy(bodyBuffer + used, data + n, room);
+            used += room;
+            n += room;
+        }
+        return count;
+    }
+    
+    /**
+     * @brief Send what is left: the whole body, or the last chunks
+     */
+    void finish() {
+        if (!streaming) {
+            sendHeaders(out, "200 OK", contentType, used, keepAlive);
+            out.write(bodyBuffer, used);
+            return;
+        }
+        sendChunk();
+        if (chunkedEncoding) out.write("0\r\n\r\n");
+    }
+    
+    /**
+     * @brief Whether the connection may stay open after the body
+     */
+    bool keepsAlive() const {
+        return keepAlive;
+    }
+    
+private:
+    Print& out;
+    const char* contentType;
+    bool keepAlive;
+    bool chunkedEncoding;
+    bool streaming = false;     // Headers sent, body going out in pieces
+    size_t used = 0;
     
-    const char* start = strstr(data, searchStr);
-    if (start == NULL) return false;
+    void sendChunk() {
+        if (!streaming) {
+            if (!chunkedEncoding) keepAlive = false;
+            sendHeaders(out, "200 OK", contentType,
+                        chunkedEncoding ? BODY_CHUNKED : BODY_UNTIL_CLOSE, keepAlive);
+            streaming = true;
+        }
+        if (used == 0) return;
+        if (!chunkedEncoding) {
+            out.write(bodyBuffer, used);
+            used = 0;
+            return;
+        }
+        
+        char size[8];
+        int len = snprintf(size, sizeof(size), "%x\r\n", (unsigned int)used);
+        out.write((const uint8_t*)size, len);
+        out.write(bodyBuffer, used);
+        out.write("\r\n");
+        used = 0;
+    }
+};
+
+// ==========================================
+// ROUTE HANDLERS
+// ==========================================
+// Document handlers return a ready document with its ETag (a page from
+// webassets.h, or the snapshot cache). Action handlers run once per
+// request, before the body is printed: side effects go there. Stream
+// handlers print the body, once (see ResponseBody).
+
+static const WebAsset* handleHomePage(const HttpRequest&) {
+    return &WEBASSET_HOME;
+}
+
+static const WebAsset* handleConfigPage(const HttpRequest&) {
+    return &WEBASSET_CONFIG;
+}
+
+static const WebAsset* handleMoonPage(const HttpRequest&) {
+    return &WEBASSET_MOON;
+}
+
+static const WebAsset* handleStyle(const HttpRequest&) {
+    return &WEBASSET_STYLE;
+}
+
+static void handleStatus(Print& out, const HttpRequest&) {
+    printSensorDataJSON(out);
+}
+
+static void handleGetConfig(Print& out, const HttpRequest&) {
+    printConfigJSON(out);
+}
+
+// Outcome of the last POST /api/config, printed by its stream handler
+static bool configSaved = false;
+static ConfigParseResult configResult;
+
+static void handleSaveConfig(const HttpRequest& request) {
+    configSaved = parseAndSaveConfig(request.body, request.bodyLength, &configResult);
+}
+
+static void handlePostConfig(Print& out, const HttpRequest&) {
+    JsonWriter json(out);
+    json.beginObject();
+    json.key("success").boolean(configSaved);
+    if (configSaved) {
+        json.key("message").string("Configuration saved");
+    } else if (configResult.error != CONFIG_PARSE_OK) {
+        json.key("message").string(configParseErrorText(configResult.error));
+        json.key("field").string(configResult.field);
+        json.key("position").number(configResult.position);
+    } else {
+        json.key("message").string("Save failed");
+    }
+    json.endObject();
+}
+
+static void handleLogStats(Print& out, const HttpRequest&) {
+    printLogStatsJSON(out);
+}
+
+// Job queued by the last ?action=recalibrate (0: queue full)
+static uint16_t calibrationJob = 0;
+
+static void handleMoonAction(const HttpRequest& request) {
+    char action[20] = "";
+    getQueryParam(request.query, "action=", action, sizeof(action));
+    if (strcmp(action, "recalibrate") != 0) return;
     
-    const char* end = strchr(start, '}');
-    if (end == NULL) return false;
+    // The scan takes about a minute: run as a job, answer at once
+    DEBUG_PRINTLN("[WEB] Manual moon recalibration requested");
+    calibrationJob = startJob(JOB_MOON_CALIBRATION);
+}
+
+static void handleMoon(Print& out, const HttpRequest& request) {
+    char action[20] = "";
+    getQueryParam(request.query, "action=", action, sizeof(action));
     
-    // Extract substring
-    int len = end - start;
-    if (len > 200) return false;
+    if (strcmp(action, "status") == 0) {
+        printMoonStatusJSON(out);
+        return;
+    }
     
-    char colorData[256];
-    strncpy(colorData, start, len);
-    colorData[len] = '\0';
+    const Job* job = findJob(calibrationJob);
+    if (strcmp(action, "recalibrate") == 0 && job != NULL) {
+        printJobJSON(out, job);
+        return;
+    }
     
-    r = extractInt(colorData, "r");
-    g = extractInt(colorData, "g");
-    b = extractInt(colorData, "b");
+    JsonWriter json(out);
+    json.beginObject();
+    if (strcmp(action, "recalibrate") == 0) {
+        json.key("error").string("Job queue full");
+    } else {
+        json.key("error").string("Invalid action");
+    }
+    json.endObject();
+}
+
+static void handleJobList(Print& out, const HttpRequest&) {
+    printJobsJSON(out);
+}
+
+static void handleJob(Print& out, const HttpRequest& request) {
+    // /api/jobs/<id>
+    const Job* job = findJob((uint16_t)atoi(strrchr(request.path, '/') + 1));
+    if (job != NULL) {
+        printJobJSON(out, job);
+        return;
+    }
     
-    return (r >= 0 && g >= 0 && b >= 0);
+    JsonWriter json(out);
+    json.beginObject();
+    json.key("error").string("Unknown job");
+    json.endObject();
+}
+
+static void handleHistory(Print& out, const HttpRequest& request) {
+    HistoryQuery query;
+    getHistoryQuery(request.query, &query);
+    printHistoryJSON(out, &query);
+}
+
+static void handleHistoryBinary(Print& out, const HttpRequest& request) {
+    HistoryQuery query;
+    getHistoryQuery(request.query, &query);
+    printHistoryBinary(out, &query);
 }
 
+static void handleRollup(Print& out, const HttpRequest& request) {
+    // ?tier=15m|1h&ch=<channel key>
+    char tierName[8] = "15m";
+    char channelKey[12] = "tIn";
+    getQueryParam(request.query, "tier=", tierName, sizeof(tierName));
+    getQueryParam(request.query, "ch=", channelKey, sizeof(channelKey));
+    printRollupJSON(out, findRollupTier(tierName), findChannel(channelKey));
+}
+
+static const WebAsset* handleSnapshot(const HttpRequest& request);
+static void handleWebStats(Print& out, const HttpRequest& request);
+
 // ==========================================
-// MAIN HANDLER
+// ROUTE TABLE
 // ==========================================
 
 /**
- * @brief Initialize web server
+ * @struct Route
+ * @brief One endpoint: exact path and method, document or action and stream handler
  * 
- * Starts the web server on port 80.
- * Call this after WiFi is connected.
+ * A route without any handler is the event stream (/api/events):
+ * its connection becomes a subscriber.
  */
-void initWebServer() {
-    webServer.begin();
-    DEBUG_PRINTLN("Web server started on port 80");
+struct Route {
+    HttpMethod method;
+    const char* path;
+    const char* contentType;
+    const WebAsset* (*document)(const HttpRequest& request);
+    void (*action)(const HttpRequest& request);
+    void (*stream)(Print& out, const HttpRequest& request);
+};
+
+#define MIME_JSON   "application/json"
+#define MIME_BINARY "application/octet-stream"
+#define MIME_EVENTS "text/event-stream"
+
+/**
+ * Sorted by path, then method (checked at compile time): lookup is a
+ * binary search on the exact path. A route whose last segment is "*"
+ * takes any last segment, left for the handler to read in request.path.
+ */
+static constexpr Route routes[] = {
+    {HTTP_GET,  "/",                 NULL,        handleHomePage,   NULL,             NULL},
+    {HTTP_GET,  "/api/config",       MIME_JSON,   NULL,             NULL,             handleGetConfig},
+    {HTTP_POST, "/api/config",       MIME_JSON,   NULL,             handleSaveConfig, handlePostConfig},
+    {HTTP_GET,  "/api/events",       MIME_EVENTS, NULL,             NULL,             NULL},
+    {HTTP_GET,  "/api/history",      MIME_JSON,   NULL,             NULL,             handleHistory},
+    {HTTP_GET,  "/api/history.bin",  MIME_BINARY, NULL,             NULL,             handleHistoryBinary},
+    {HTTP_GET,  "/api/jobs",         MIME_JSON,   NULL,             NULL,             handleJobList},
+    {HTTP_GET,  "/api/jobs/*",       MIME_JSON,   NULL,             NULL,             handleJob},
+    {HTTP_GET,  "/api/logstats",     MIME_JSON,   NULL,             NULL,             handleLogStats},
+    {HTTP_GET,  "/api/moon",         MIME_JSON,   NULL,             handleMoonAction, handleMoon},
+    {HTTP_GET,  "/api/rollup",       MIME_JSON,   NULL,             NULL,             handleRollup},
+    {HTTP_GET,  "/api/snapshot",     MIME_JSON,   handleSnapshot,   NULL,             NULL},
+    {HTTP_GET,  "/api/status",       MIME_JSON,   NULL,             NULL,             handleStatus},
+    {HTTP_GET,  "/api/webstats",     MIME_JSON,   NULL,             NULL,             handleWebStats},
+    {HTTP_GET,  "/config",           NULL,        handleConfigPage, NULL,             NULL},
+    {HTTP_GET,  "/index",            NULL,        handleHomePage,   NULL,             NULL},
+    {HTTP_GET,  "/index.html",       NULL,        handleHomePage,   NULL,             NULL},
+    {HTTP_GET,  "/moon",             NULL,        handleMoonPage,   NULL,             NULL},
+    {HTTP_GET,  "/style.css",        NULL,        handleStyle,      NULL,             NULL}
+};
+
+#define ROUTE_COUNT  (sizeof(routes) / sizeof(routes[0]))
+
+static constexpr int routeCompare(const char* a, const char* b) {
+    return (*a != *b || *a == '\0') ? (*a - *b) : routeCompare(a + 1, b + 1);
 }
 
+static constexpr bool routesSorted(size_t i) {
+    return i + 1 >= ROUTE_COUNT ||
+           ((routeCompare(routes[i].path, routes[i + 1].path) < 0 ||
+             (routeCompare(routes[i].path, routes[i + 1].path) == 0 &&
+              routes[i].method < routes[i + 1].method)) &&
+            routesSorted(i + 1));
+}
+
+static_assert(routesSorted(0), "routes[] must be sorted by path, then method");
+
+// Request counters
+static uint32_t routeHits[ROUTE_COUNT];
+static WebServerStats webStats = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
 /**
- * @brief Handle incoming web requests
+ * @brief Find the route of an exact path
  * 
- * Call this in main loop() to process HTTP requests.
- * Non-blocking - returns immediately if no client.
+ * @param pathFound Set if the path exists with another method
+ * @return Route index, -1 if none
  */
- void handleWebServer() {
-    WiFiClient client = webServer.available();
+static int findExactRoute(HttpMethod method, const char* path, bool* pathFound) {
+    int low = 0;
+    int high = ROUTE_COUNT - 1;
+    *pathFound = false;
     
-    if (!client) {
-        return;
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        int cmp = strcmp(path, routes[mid].path);
+        if (cmp < 0) {
+            high = mid - 1;
+        } else if (cmp > 0) {
+            low = mid + 1;
+        } else {
+            // Same path: routes with other methods are neighbours
+            while (mid > 0 && strcmp(routes[mid - 1].path, path) == 0) mid--;
+            for (; mid < (int)ROUTE_COUNT && strcmp(routes[mid].path, path) == 0; mid++) {
+                if (routes[mid].method == method) return mid;
+            }
+            *pathFound = true;
+            return -1;
+        }
     }
+    return -1;
+}
+
+/**
+ * @brief Find the route of a request
+ * 
+ * A path missing from the table is tried again with "*" as its last
+ * segment: /api/jobs/12 is served by the /api/jobs/<id> route.
+ * 
+ * @param pathFound Set if the path exists with another method
+ * @return Route index, -1 if none
+ */
+static int findRoute(HttpMethod method, const char* path, bool* pathFound) {
+    int route = findExactRoute(method, path, pathFound);
+    if (route >= 0 || *pathFound) return route;
     
-    unsigned long startTime = millis();
-    DEBUG_PRINTLN("New web client connected");
-    
-    // ✅ Reduced buffer sizes (768+256 = 1KB)
-    static char request[768];
-    static char postData[256];
-    int requestLen = 0;
-    int postDataLen = 0;
-    bool isPost = false;
-    int contentLength = 0;
+    const char* slash = strrchr(path, '/');
+    if (slash == NULL || slash[1] == '\0') return -1;
     
-    // Read HTTP request headers
-    while (client.connected() && client.available() && requestLen < sizeof(request) - 1) {
-        char c = client.read();
-        request[requestLen++] = c;
-        request[requestLen] = '\0';
-        
-        if (strstr(request, "POST") != NULL) {
-            isPost = true;
-        }
-        
-        char* contentLengthPos = strstr(request, "Content-Length: ");
-        if (contentLengthPos != NULL) {
-            contentLength = atoi(contentLengthPos + 16);
-        }
+    char pattern[HTTP_MAX_PATH + 2];
+    size_t length = slash - path + 1;
+    memcpy(pattern, path, length);
+    pattern[length] = '*';
+    pattern[length + 1] = '\0';
+    return findExactRoute(method, pattern, pathFound);
+}
+
+/**
+ * @brief Send an error response
+ */
+static void sendError(Print& out, const char* status, bool keepAlive) {
+    sendHeaders(out, status, "text/plain", strlen(status), keepAlive);
+    out.print(status);
+}
+
+#if WEB_STACK_PROBE
+#define STACK_PROBE_WORDS   (WEB_STACK_PROBE_BYTES / 4)
+#define STACK_PROBE_PATTERN 0xA5A5A5A5UL
+
+/**
+ * @brief Fill the free stack below the caller with a pattern
+ * @return Top of the painted area (about the caller's stack pointer)
+ */
+static uintptr_t __attribute__((noinline)) stackPaint() {
+    volatile uint32_t top = 0;
+    volatile uint32_t* word = &top;
+    for (uint16_t i = 1; i <= STACK_PROBE_WORDS; i++) {
+        word[-i] = STACK_PROBE_PATTERN;
+    }
+    return (uintptr_t)&top;
+}
+
+/**
+ * @brief Stack used below top since stackPaint()
+ * 
+ * The deepest word no longer holding the pattern marks the high-water
+ * mark (WEB_STACK_PROBE_BYTES if the whole area was used).
+ */
+static uint32_t __attribute__((noinline)) stackUsed(uintptr_t top) {
+    volatile uint32_t* word = (volatile uint32_t*)top - STACK_PROBE_WORDS;
+    uint16_t i = 0;
+    while (i < STACK_PROBE_WORDS && word[i] == STACK_PROBE_PATTERN) i++;
+    return (uint32_t)(STACK_PROBE_WORDS - i) * 4;
+}
+#endif
+
+/**
+ * @brief Whether an If-None-Match value names this entity tag
+ * 
+ * The value is "*" (any version) or a comma-separated list of tags, each
+ * compared whole with the weak comparison (a W/ prefix is ignored). A tag
+ * cut by HTTP_MAX_IF_NONE_MATCH never matches.
+ */
+static bool etagListMatches(const char* list, const char* etag) {
+    size_t etagLength = strlen(etag);
+    const char* p = list;
+    while (*p != '\0') {
+        while (*p == ' ' || *p == ',') p++;
+        const char* end = p;
+        while (*end != '\0' && *end != ',') end++;
+        const char* last = end;
+        while (last > p && last[-1] == ' ') last--;
         
-        // Headers end with \r\n\r\n
-        if (requestLen >= 4 && 
-            request[requestLen-4] == '\r' && request[requestLen-3] == '\n' &&
-            request[requestLen-2] == '\r' && request[requestLen-1] == '\n') {
-            break;
-        }
+        if (last - p == 1 && *p == '*') return true;
+        if (last - p > 2 && p[0] == 'W' && p[1] == '/') p += 2;
+        if ((size_t)(last - p) == etagLength && memcmp(p, etag, etagLength) == 0) return true;
+        p = end;
     }
+    return false;
+}
+
+/**
+ * @brief Send a document, or 304 if the client has this version
+ * 
+ * Documents are sent as stored (pages gzip); the ETag changes with the
+ * content, so a cached copy is only revalidated, never stale. A 304
+ * carries no body nor representation headers (length, type, encoding):
+ * the client keeps those of its copy.
+ */
+static void sendDocument(SegmentStream& out, const WebAsset* asset, const HttpRequest& request) {
+    const char* connection = request.keepAlive ? "keep-alive" : "close";
+    char headers[224];
     
-    // Read POST data if present
-    if (isPost && contentLength > 0 && contentLength < sizeof(postData)) {
-        unsigned long postStartTime = millis();
-        while (postDataLen < contentLength && (millis() - postStartTime) < 5000) {
-            if (client.available()) {
-                postData[postDataLen++] = (char)client.read();
-                postData[postDataLen] = '\0';
-            }
-        }
+    if (etagListMatches(request.ifNoneMatch, asset->etag)) {
+        int len = snprintf(headers, sizeof(headers),
+            "HTTP/1.1 304 Not Modified\r\n"
+            "ETag: %s\r\n"
+            "Cache-Control: no-cache\r\n"
+            "Connection: %s\r\n"
+            "\r\n",
+            asset->etag, connection);
+        out.write((const uint8_t*)headers, len);
+        webStats.notModified++;
+        return;
     }
     
-    // ========================================
-    // ROUTE HANDLING
-    // ========================================
-    
-    if (strstr(request, "GET / ") != NULL || strstr(request, "GET /index") != NULL) {
-        client.println("HTTP/1.1 200 OK");
-        client.println("Content-Type: text/html");
-        client.println("Connection: close");
-        client.println();
-        sendPageInChunks(client, WEBPAGE_HOME);
-    }
-    else if (strstr(request, "GET /config") != NULL) {
-        client.println("HTTP/1.1 200 OK");
-        client.println("Content-Type: text/html");
-        client.println("Connection: close");
-        client.println();
-        sendPageInChunks(client, WEBPAGE_CONFIG);
-    }
-    else if (strstr(request, "GET /moon") != NULL) {
-        client.println("HTTP/1.1 200 OK");
-        client.println("Content-Type: text/html");
-        client.println("Connection: close");
-        client.println();
-        sendPageInChunks(client, WEBPAGE_MOON);
-    }
-    else if (strstr(request, "GET /api/status") != NULL) {
-        const char* json = getSensorDataJSON();
-        client.println("HTTP/1.1 200 OK");
-        client.println("Content-Type: application/json");
-        client.println("Connection: close");
-        client.println();
-        client.println(json);
-    }
-    else if (strstr(request, "GET /api/config") != NULL) {
-        const char* json = getConfigJSON();
-        client.println("HTTP/1.1 200 OK");
-        client.println("Content-Type: application/json");
-        client.println("Connection: close");
-        client.println();
-        client.println(json);
-    }
-    else if (strstr(request, "GET /api/history") != NULL) {
-        uint16_t count = 20;
-        char* countPos = strstr(request, "count=");
-        if (countPos != NULL) {
-            count = atoi(countPos + 6);
-            if (count == 0 || count > 20) count = 20;
-        }
-        
-        const char* json = getBufferJSON(count);
-        client.println("HTTP/1.1 200 OK");
-        client.println("Content-Type: application/json");
-        client.println("Connection: close");
-        client.println();
-        client.println(json);
-    }
-    else if (strstr(request, "GET /api/logstats") != NULL) {
-        const char* json = getLogStatsJSON();
-        client.println("HTTP/1.1 200 OK");
-        client.println("Content-Type: application/json");
-        client.println("Connection: close");
-        client.println();
-        client.println(json);
-    }
-    else if (strstr(request, "GET /api/moon") != NULL) {
-        char action[20] = "";
-        char* actionPos = strstr(request, "action=");
-        if (actionPos != NULL) {
-            actionPos += 7;
-            int i = 0;
-            while (i < 19 && actionPos[i] != ' ' && actionPos[i] != '&' && actionPos[i] != '\0') {
-                action[i] = actionPos[i];
-                i++;
-            }
-            action[i] = '\0';
-        }
-        
-        const char* json = getMoonDataJSON(action);
-        client.println("HTTP/1.1 200 OK");
-        client.println("Content-Type: application/json");
-        client.println("Connection: close");
-        client.println();
-        client.println(json);
-    }
-    else if (isPost && strstr(request, "POST /api/config") != NULL) {
-        bool success = parseAndSaveConfig(postData, postDataLen);
-        
-        client.println("HTTP/1.1 200 OK");
-        client.println("Content-Type: application/json");
-        client.println("Connection: close");
-        client.println();
-        
-        if (success) {
-            client.println("{\"success\":true,\"message\":\"Configuration saved\"}");
-        } else {
-            client.println("{\"success\":false,\"message\":\"Save failed\"}");
-        }
+    char encoding[32] = "";
+    if (asset->encoding != NULL) {
+        snprintf(encoding, sizeof(encoding), "Content-Encoding: %s\r\n", asset->encoding);
     }
-    else {
-        client.println("HTTP/1.1 404 Not Found");
-        client.println("Content-Type: text/plain");
-        client.println("Connection: close");
-        client.println();
-        client.println("404 Not Found");
+    int len = snprintf(headers, sizeof(headers),
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: %s\r\n"
+        "%s"
+        "Content-Length: %lu\r\n"
+        "ETag: %s\r\n"
+        "Cache-Control: no-cache\r\n"
+        "Connection: %s\r\n"
+        "\r\n",
+        asset->contentType, encoding, (unsigned long)asset->length, asset->etag, connection);
+    out.write((const uint8_t*)headers, len);
+    
+    unsigned long start = micros();
+    out.write(asset->data, asset->length);
+    out.flush();
+    unsigned long elapsed = micros() - start;
+    
+    webStats.assetsSent++;
+    webStats.assetMicrosTotal += elapsed;
+    if (elapsed > webStats.assetMicrosMax) webStats.assetMicrosMax = elapsed;
+}
+
+/**
+ * @brief Send the response of a route
+ * 
+ * @return true if the connection may stay open (request.keepAlive,
+ *         unless the body had to end with the connection)
+ */
+static bool sendRoute(SegmentStream& out, const Route& route, const HttpRequest& request) {
+    if (route.document != NULL) {
+        sendDocument(out, route.document(request), request);
+        return request.keepAlive;
     }
     
-    delay(10);
-    client.stop();
+    if (route.action != NULL) route.action(request);
     
-    DEBUG_PRINT("Request handled in ");
-    DEBUG_PRINT(millis() - startTime);
-    DEBUG_PRINTLN("ms");
+    ResponseBody body(out, route.contentType, request);
+    route.stream(body, request);
+    body.finish();
+    return body.keepsAlive();
 }
 
 // ==========================================
-// JSON GENERATION FUNCTIONS (NO STRING)
+// SNAPSHOT DOCUMENT (/api/snapshot)
 // ==========================================
 
 /**
- * @brief Get sensor data as JSON string
- * 
- * Formats current sensor readings into JSON format.
- * 
- * ⚠️ Returns pointer to static buffer - valid until next call
- * 
- * @return Pointer to static JSON buffer
+ * @struct MoonState
+ * @brief Moon status as printed by printMoonStatusJSON(), at its precision
+ *
+ * The phase, age and illumination are recomputed every day even when the
+ * motor doesn't move, and the days since calibration grow with time: the
+ * printed status changes when one of these does.
+ */
+struct MoonState {
+    int steps;
+    uint8_t phase;
+    bool calibrated;
+    int32_t exactPhase;         ///< × 1000
+    int32_t illumination;       ///< × 10
+    int32_t lunarAge;           ///< × 100
+    int32_t daysSinceCalib;     ///< × 10, -1 if not printed
+};
+
+/**
+ * @brief Read the moon status at the precision it is printed with
+ * @param epoch Current time (days since calibration)
  */
-const char* getSensorDataJSON() {
-    static char json[384];
+static void readMoonState(MoonState* state, unsigned long epoch) {
+    MoonPhaseData& moon = getMoonData();
     
-    DateTime now = getCurrentTime();
+    // Zeroed first: padding bytes take part in comparisons
+    memset(state, 0, sizeof(MoonState));
+    state->steps = moon.currentSteps;
+    state->phase = moon.phase;
+    state->calibrated = moon.isCalibrated;
+    state->exactPhase = lroundf(moon.exactPhase * 1000);
+    state->illumination = lroundf(moon.illumination * 10);
+    state->lunarAge = lroundf(moon.lunarAge * 100);
+    state->daysSinceCalib = (moon.isCalibrated && moon.lastCalib > 0) ?
+                            lroundf(daysSinceLastCalibration(epoch) * 10) : -1;
+}
+
+/**
+ * @struct SnapshotInputs
+ * @brief Everything the snapshot is built from, compared as raw bytes
+ */
+struct SnapshotInputs {
+    int16_t channels[SENSOR_CHANNEL_COUNT];     ///< Channel values (SENSOR_VALUE_INVALID if not valid)
+    MoonState moon;
+    uint32_t configSaves;
+    uint16_t totalLogged;
+    uint16_t totalSent;
+    uint16_t bufferCount;
+    bool mqttConnected;
+};
+
+static uint32_t configSaves = 0;        // Bumped by parseAndSaveConfig()
+static SnapshotInputs snapshotInputs;
+static uint32_t snapshotVersion = 0;
+static uint32_t snapshotSalt = 0;       // Tells boots apart in the ETag
+static char snapshotJSON[SNAPSHOT_BUFFER_SIZE];
+static char snapshotETag[HTTP_MAX_ETAG];
+static WebAsset snapshotDocument = {(const uint8_t*)snapshotJSON, 0, snapshotETag, MIME_JSON, NULL};
+
+static inline int16_t channelValue(uint8_t ch) {
+    return sensorChannels[ch].valid ? sensorChannels[ch].value : SENSOR_VALUE_INVALID;
+}
+
+/**
+ * @brief Read the current snapshot inputs
+ */
+static void readSnapshotInputs(SnapshotInputs* inputs) {
+    // Zeroed first: padding bytes take part in the comparison
+    memset(inputs, 0, sizeof(SnapshotInputs));
+    for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+        inputs->channels[ch] = channelValue(ch);
+    }
+    readMoonState(&inputs->moon, getCurrentTime().unixtime());
+    inputs->configSaves = configSaves;
+    DataLogStats stats = getLogStats();
+    inputs->totalLogged = stats.totalLogged;
+    inputs->totalSent = stats.totalSent;
+    inputs->bufferCount = stats.bufferCount;
+    inputs->mqttConnected = stats.mqttConnected;
+}
+
+/**
+ * @brief Build the snapshot from the current state (new version)
+ */
+static void buildSnapshot() {
+    if (snapshotSalt == 0) snapshotSalt = micros() | 1;
+    snapshotVersion++;
     
-    snprintf(json, sizeof(json),
-        "{"
-        "\"indoor\":{"
-          "\"temp\":%.1f,"
-          "\"humidity\":%.1f,"
-          "\"valid\":%s"
-        "},"
-        "\"outdoor\":{"
-          "\"temp\":%.1f,"
-          "\"humidity\":%.1f,"
-          "\"valid\":%s"
-        "},"
-        "\"airQuality\":{"
-          "\"aqi\":%d,"
-          "\"quality\":\"%s\""
-        "},"
-        "\"time\":\"%02d:%02d:%02d\""
-        "}",
-        indoorData.temperature,
-        indoorData.humidity,
-        indoorData.valid ? "true" : "false",
-        outdoorData.temperature,
-        outdoorData.humidity,
-        outdoorData.valid ? "true" : "false",
-        airQuality.estimatedAQI,
-        airQuality.quality,
-        now.hour(), now.minute(), now.second()
-    );
-    
-    return json;
-}
-
-/**
- * @brief Get configuration as JSON string
+    BufferStream sink(snapshotJSON, sizeof(snapshotJSON));
+    JsonWriter json(sink);
+    json.beginObject();
+    json.key("version").number((unsigned long)snapshotVersion);
+    printChannelsJSON(json.key("channels").raw());
+    json.key("quality").string(airQuality.quality);
+    json.key("log").beginObject();
+    json.key("bufferCount").number(snapshotInputs.bufferCount);
+    json.key("totalLogged").number(snapshotInputs.totalLogged);
+    json.key("totalSent").number(snapshotInputs.totalSent);
+    json.key("mqttConnected").boolean(snapshotInputs.mqttConnected);
+    json.endObject();
+    printMoonStatusJSON(json.key("moon").raw());
+    printConfigJSON(json.key("config").raw());
+    json.endObject();
+    
+    if (sink.overflow) {
+        DEBUG_PRINTLN("ERROR: Snapshot JSON buffer overflow!");
+        sink.rewind(0);
+        JsonWriter minimal(sink);
+        minimal.beginObject();
+        minimal.key("version").number((unsigned long)snapshotVersion);
+        minimal.endObject();
+    }
+    
+    snapshotDocument.length = sink.length;
+    snprintf(snapshotETag, sizeof(snapshotETag), "\"%lx-%lx\"",
+             (unsigned long)snapshotVersion, (unsigned long)snapshotSalt);
+}
+
+/**
+ * @brief Serve the snapshot, rebuilt only if one of its inputs changed
+ *
+ * Polling it costs a comparison of a few bytes; unchanged data is sent
+ * from the cache, or answered 304 against the version's ETag.
+ */
+static const WebAsset* handleSnapshot(const HttpRequest&) {
+    SnapshotInputs current;
+    readSnapshotInputs(&current);
+
+    if (snapshotVersion == 0 || memcmp(&current, &snapshotInputs, sizeof(SnapshotInputs)) != 0) {
+        snapshotInputs = current;
+        buildSnapshot();
+        webStats.snapshotBuilds++;
+    }
+    webStats.snapshotHits++;
+    return &snapshotDocument;
+}
+
+static void handleWebStats(Print& out, const HttpRequest&) {
+    JsonWriter json(out);
+    json.beginObject();
+    json.key("requests").number((unsigned long)webStats.requests);
+    json.key("notModified").number((unsigned long)webStats.notModified);
+    json.key("notFound").number((unsigned long)webStats.notFound);
+    json.key("badRequests").number((unsigned long)webStats.badRequests);
+    json.key("timeouts").number((unsigned long)webStats.timeouts);
+    json.key("connections").number((unsigned long)webStats.connections);
+    json.key("keepAliveReused").number((unsigned long)webStats.keepAliveReused);
+    json.key("rejected").number((unsigned long)webStats.rejected);
+    json.key("subscribers").number((unsigned long)webStats.subscribers);
+    json.key("eventsPushed").number((unsigned long)webStats.eventsPushed);
+    json.key("eventsPerMin").number((unsigned long)webStats.eventsLastMinute);
+    json.key("eventBytes").number((unsigned long)webStats.eventBytes);
+    json.key("snapshotHits").number((unsigned long)webStats.snapshotHits);
+    json.key("snapshotBuilds").number((unsigned long)webStats.snapshotBuilds);
+    json.key("responseWrites").number((unsigned long)webStats.responseWrites);
+    json.key("parseUsAvg").number((unsigned long)(webStats.requests ? webStats.parseMicrosTotal / webStats.requests : 0));
+    json.key("parseUsMax").number((unsigned long)webStats.parseMicrosMax);
+    json.key("bytesParsed").number((unsigned long)webStats.bytesParsed);
+    json.key("assetsSent").number((unsigned long)webStats.assetsSent);
+    json.key("assetUsAvg").number((unsigned long)(webStats.assetsSent ? webStats.assetMicrosTotal / webStats.assetsSent : 0));
+    json.key("assetUsMax").number((unsigned long)webStats.assetMicrosMax);
+    json.key("stackPeak").number((unsigned long)webStats.stackPeak);
+    
+    json.key("routes").beginArray();
+    for (uint8_t i = 0; i < ROUTE_COUNT; i++) {
+        json.beginObject();
+        json.key("method").string(routes[i].method == HTTP_POST ? "POST" : "GET");
+        json.key("path").string(routes[i].path);
+        json.key("hits").number((unsigned long)routeHits[i]);
+        json.endObject();
+    }
+    json.endArray();
+    json.endObject();
+}
+
+// ==========================================
+// CONNECTION SLOTS
+// ==========================================
+
+/**
+ * @enum SlotState
+ * @brief Connection slot state
+ */
+enum SlotState {
+    SLOT_FREE,      ///< No connection
+    SLOT_IDLE,      ///< Connected, waiting for a request (keep-alive)
+    SLOT_READING,   ///< Request partly received
+    SLOT_EVENTS     ///< Subscribed to /api/events, receives pushed events
+};
+
+/**
+ * @struct ConnectionSlot
+ * @brief One client connection and its request parser
+ */
+struct ConnectionSlot {
+    WiFiClient client;
+    HttpRequest request;
+    SlotState state;
+    unsigned long lastActivity;     ///< Last byte received or response sent (ms)
+    uint32_t parseMicros;           ///< Parser time of the current request (µs)
+    uint16_t served;                ///< Requests answered on this connection
+};
+
+static ConnectionSlot slots[WEB_MAX_CONNECTIONS];
+
+/**
+ * @brief Close the connection of a slot
+ */
+static void closeSlot(ConnectionSlot* slot) {
+    if (slot->state == SLOT_EVENTS) webStats.subscribers--;
+    slot->client.stop();
+    slot->state = SLOT_FREE;
+}
+
+// ==========================================
+// EVENT STREAM (/api/events)
+// ==========================================
+
+// Channel values and moon state last pushed to the subscribers
+static int16_t pushedValue[SENSOR_CHANNEL_COUNT];
+static MoonState pushedMoon;
+
+// Events being sent (one write per subscriber)
+static char eventBuffer[SSE_BUFFER_SIZE];
+
+// Push rate over the last full minute
+static unsigned long pushWindowStart = 0;
+static uint32_t pushWindowEvents = 0;
+
+/**
+ * @brief Start one SSE event ("event: name\ndata: ")
+ * @return Length before the event, for endEvent()
+ */
+static size_t beginEvent(BufferStream& events, const char* name) {
+    size_t start = events.length;
+    events.print("event: ");
+    events.print(name);
+    events.print("\ndata: ");
+    return start;
+}
+
+/**
+ * @brief End the event started at start ("\n\n")
+ * @return false if it did not fit (event dropped)
+ */
+static bool endEvent(BufferStream& events, size_t start) {
+    events.print("\n\n");
+    if (events.overflow) {
+        events.rewind(start);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Print the sensors event: changed channels only, or all
+ */
+static void printSensorsEvent(Print& out, bool all) {
+    JsonWriter json(out);
+    char value[12];
+    
+    json.beginObject();
+    for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+        int16_t v = channelValue(ch);
+        if (!all && v == pushedValue[ch]) continue;
+        formatChannelValue(ch, v, value, sizeof(value));
+        json.key(sensorChannels[ch].key).raw().print(value);
+        if (ch == CH_AQI) {
+            json.key("quality").string(airQuality.quality);
+        }
+    }
+    json.endObject();
+}
+
+/**
+ * @brief Check whether the printed moon status changed (same fields as
+ *        the snapshot: position, phase values, days since calibration)
+ */
+static bool moonChanged(const MoonState* moon) {
+    return memcmp(moon, &pushedMoon, sizeof(MoonState)) != 0;
+}
+
+/**
+ * @brief Take the current readings and moon state as pushed
+ */
+static void rememberPushed(const MoonState* moon) {
+    pushedMoon = *moon;
+    for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+        pushedValue[ch] = channelValue(ch);
+    }
+}
+
+/**
+ * @brief Write a block of events to one subscriber
  * 
- * ⚠️ Returns pointer to static buffer - valid until next call
+ * @return false if the subscriber is gone (slot closed)
+ */
+static bool pushToSlot(ConnectionSlot* slot, const char* events, size_t length, uint8_t count) {
+    if (slot->client.write((const uint8_t*)events, length) != length) {
+        closeSlot(slot);
+        return false;
+    }
+    webStats.eventsPushed += count;
+    webStats.eventBytes += length;
+    pushWindowEvents += count;
+    return true;
+}
+
+/**
+ * @brief Turn a connection into an event stream subscriber
  * 
- * @return Pointer to static JSON buffer
+ * Prints the headers (no Content-Length: the body never ends) and a full
+ * sensors and moon event, then only changes are pushed.
+ * 
+ * @return false if the subscriber limit is reached (503 sent)
  */
-const char* getConfigJSON() {
-    static char json[384];
+static bool subscribe(ConnectionSlot* slot, SegmentStream& out) {
+    if (webStats.subscribers >= WEB_MAX_SUBSCRIBERS) {
+        webStats.rejected++;
+        sendError(out, "503 Service Unavailable", false);
+        return false;
+    }
     
-    ClockConfig config;
-    getCurrentConfig(&config);
+    static const char headers[] =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: " MIME_EVENTS "\r\n"
+        "Cache-Control: no-cache\r\n"
+        "Connection: keep-alive\r\n"
+        "\r\n"
+        "retry: 5000\n\n";
+    out.write((const uint8_t*)headers, sizeof(headers) - 1);
     
-    snprintf(json, sizeof(json),
-        "{"
-        "\"timezoneOffset\":%d,"
-        "\"ntpSyncHour\":%d,"
-        "\"ntpSyncMinute\":%d,"
-        "\"led\":{"
-          "\"hour\":{\"r\":%d,\"g\":%d,\"b\":%d},"
-          "\"minute\":{\"r\":%d,\"g\":%d,\"b\":%d},"
-          "\"second\":{\"r\":%d,\"g\":%d,\"b\":%d},"
-          "\"brightness\":%d"
-        "},"
-        "\"lcdTimeout\":%lu"
-        "}",
-        config.timezoneOffset,
-        config.ntpSyncHour,
-        config.ntpSyncMinute,
-        config.colorHourR, config.colorHourG, config.colorHourB,
-        config.colorMinuteR, config.colorMinuteG, config.colorMinuteB,
-        config.colorSecondR, config.colorSecondG, config.colorSecondB,
-        config.ledBrightness,
-        config.lcdTimeout
-    );
-    
-    return json;
-}
-
-/**
- * @brief Get logging statistics as JSON string
- * 
- * ⚠️ Returns pointer to static buffer - valid until next call
+    // First subscriber: changes are counted from the full event below
+    if (webStats.subscribers == 0) {
+        MoonState moon;
+        readMoonState(&moon, getCurrentTime().unixtime());
+        rememberPushed(&moon);
+    }
+    slot->state = SLOT_EVENTS;
+    webStats.subscribers++;
+    
+    BufferStream events(eventBuffer, sizeof(eventBuffer));
+    uint8_t count = 0;
+    
+    size_t start = beginEvent(events, "sensors");
+    printSensorsEvent(events, true);
+    if (endEvent(events, start)) count++;
+    start = beginEvent(events, "moon");
+    printMoonStatusJSON(events);
+    if (endEvent(events, start)) count++;
+    out.write((const uint8_t*)eventBuffer, events.length);
+    
+    webStats.eventsPushed += count;
+    webStats.eventBytes += events.length;
+    pushWindowEvents += count;
+    return true;
+}
+
+
+/**
+ * @brief Print the answer to the complete request of a slot
  * 
- * @return Pointer to static JSON buffer
+ * @return true if the connection stays open for another request
  */
-const char* getLogStatsJSON() {
-    static char json[256];
+static bool answer(ConnectionSlot* slot, SegmentStream& out) {
+    HttpRequest& request = slot->request;
     
-    DataLogStats stats = getLogStats();
+    webStats.requests++;
+    if (slot->served > 0) webStats.keepAliveReused++;
+    webStats.parseMicrosTotal += slot->parseMicros;
+    if (slot->parseMicros > webStats.parseMicrosMax) webStats.parseMicrosMax = slot->parseMicros;
+    
+    // Parse errors leave the stream out of sync: close after the answer
+    if (request.error != 0) {
+        webStats.badRequests++;
+        sendError(out, request.error == 413 ? "413 Payload Too Large" :
+                       request.error == 414 ? "414 URI Too Long" :
+                       request.error == 431 ? "431 Request Header Fields Too Large" :
+                                              "400 Bad Request", false);
+        return false;
+    }
+    
+    if (slot->served + 1 >= HTTP_KEEPALIVE_MAX) request.keepAlive = false;
+    
+    bool pathFound = false;
+    int route = findRoute(request.method, request.path, &pathFound);
+    
+    if (route >= 0 && routes[route].document == NULL && routes[route].action == NULL &&
+        routes[route].stream == NULL) {
+        routeHits[route]++;
+        slot->served++;
+        return subscribe(slot, out);
+    }
+    else if (route >= 0) {
+        routeHits[route]++;
+#if WEB_STACK_PROBE
+        uintptr_t top = stackPaint();
+        request.keepAlive = sendRoute(out, routes[route], request);
+        uint32_t used = stackUsed(top);
+        if (used > webStats.stackPeak) webStats.stackPeak = used;
+#else
+        request.keepAlive = sendRoute(out, routes[route], request);
+#endif
+    }
+    else if (pathFound) {
+        webStats.badRequests++;
+        sendError(out, "405 Method Not Allowed", request.keepAlive);
+    }
+    else {
+        webStats.notFound++;
+        sendError(out, "404 Not Found", request.keepAlive);
+    }
     
-    snprintf(json, sizeof(json),
-        "{"
-        "\"bufferCount\":%d,"
-        "\"bufferMax\":%d,"
-        "\"bufferUsage\":%d,"
-        "\"totalLogged\":%d,"
-        "\"totalSent\":%d,"
-        "\"mqttConnected\":%s,"
-        "\"lastLogTime\":%lu,"
-        "\"lastSendTime\":%lu"
-        "}",
-        stats.bufferCount,
-        MAX_DATA_POINTS,
-        (stats.bufferCount * 100) / MAX_DATA_POINTS,
-        stats.totalLogged,
-        stats.totalSent,
-        stats.mqttConnected ? "true" : "false",
-        stats.lastLogTime,
-        stats.lastSendTime
-    );
-    
-    return json;
-}
-
-/**
- * @brief Get moon phase data as JSON string
+    slot->served++;
+    return request.keepAlive;
+}
+
+/**
+ * @brief Answer the complete request of a slot
  * 
- * Formats moon phase data into JSON format based on action parameter.
+ * The whole response goes through one SegmentStream: headers and body
+ * leave in WEB_WRITE_SIZE writes, one for most responses.
  * 
- * ⚠️ Returns pointer to static buffer - valid until next call
+ * @return true if the connection stays open for another request
+ */
+static bool respond(ConnectionSlot* slot) {
+    SegmentStream out(slot->client, responseBuffer, sizeof(responseBuffer));
+    bool keepOpen = answer(slot, out);
+    out.flush();
+    webStats.responseWrites += out.writes;
+    return keepOpen && !out.failed;
+}
+
+/**
+ * @brief Advance one connection without blocking
  * 
- * @param action Action to perform ("status" or "recalibrate")
- * @return Pointer to static JSON buffer
+ * Parses the bytes already received; answers each request as soon as
+ * it is complete. Bytes following a request start the next one.
  */
-const char* getMoonDataJSON(const char* action) {
-    static char json[384];
+static void serviceSlot(ConnectionSlot* slot) {
+    // Each client read is a round trip to the WiFi module: one block
+    static uint8_t chunk[128];
+    unsigned long now = millis();
     
-    if (strcmp(action, "status") == 0) {
-        MoonPhaseData& data = getMoonData();
-        
-        int pos = snprintf(json, sizeof(json),
-            "{"
-            "\"phase\":%d,"
-            "\"phaseName\":\"%s\","
-            "\"exactPhase\":%.3f,"
-            "\"illumination\":%.1f,"
-            "\"lunarAge\":%.2f,"
-            "\"currentSteps\":%d,"
-            "\"calibrated\":%s",
-            data.phase,
-            getMoonPhaseName(data.phase),
-            data.exactPhase,
-            data.illumination,
-            data.lunarAge,
-            data.currentSteps,
-            data.isCalibrated ? "true" : "false"
-        );
-        
-        if (data.isCalibrated && data.lastCalib > 0) {
-            DateTime now = getCurrentTime();
-            float daysSinceCalib = daysSinceLastCalibration(now.unixtime());
-            pos += snprintf(json + pos, sizeof(json) - pos,
-                ",\"daysSinceCalibration\":%.1f",
-                daysSinceCalib
-            );
+    int available = slot->client.available();
+    int n = (available > 0) ? slot->client.read(chunk, min(available, (int)sizeof(chunk))) : 0;
+    
+    // Subscribers only receive: input is dropped, the stream never times out
+    if (slot->state == SLOT_EVENTS) {
+        if (n <= 0 && !slot->client.connected()) closeSlot(slot);
+        return;
+    }
+    
+    if (n <= 0) {
+        if (!slot->client.connected()) {
+            closeSlot(slot);
+        }
+        else if (slot->state == SLOT_READING && now - slot->lastActivity >= HTTP_READ_TIMEOUT) {
+            webStats.timeouts++;
+            SegmentStream out(slot->client, responseBuffer, sizeof(responseBuffer));
+            sendError(out, "408 Request Timeout", false);
+            out.flush();
+            closeSlot(slot);
+        }
+        else if (slot->state == SLOT_IDLE && now - slot->lastActivity >= HTTP_IDLE_TIMEOUT) {
+            closeSlot(slot);
+        }
+        return;
+    }
+    
+    slot->lastActivity = now;
+    webStats.bytesParsed += n;
+    
+    size_t offset = 0;
+    while (offset < (size_t)n) {
+        if (slot->state == SLOT_IDLE) {
+            httpRequestInit(&slot->request);
+            slot->parseMicros = 0;
+            slot->state = SLOT_READING;
         }
         
-        snprintf(json + pos, sizeof(json) - pos, "}");
-        
-    } else if (strcmp(action, "recalibrate") == 0) {
-        DEBUG_PRINTLN("[WEB] Manual moon recalibration requested");
-        
-        MoonCalibrationResult result = calibrateMoonHome();
+        unsigned long parseStart = micros();
+        offset += httpRequestFeed(&slot->request, chunk + offset, n - offset);
+        slot->parseMicros += micros() - parseStart;
         
-        snprintf(json, sizeof(json),
-            "{"
-            "\"success\":%s,"
-            "\"peakValue\":%d,"
-            "\"peakStep\":%d,"
-            "\"finalValue\":%d,"
-            "\"difference\":%d,"
-            "\"duration\":%lu"
-            "}",
-            result.success ? "true" : "false",
-            result.peakValue,
-            result.peakStep,
-            result.finalValue,
-            result.difference,
-            result.duration
-        );
+        if (!httpRequestComplete(&slot->request)) break;
         
-        if (result.success) {
-            DateTime now = getCurrentTime();
-            updateMoonPosition(now.unixtime());
+        if (!respond(slot)) {
+            closeSlot(slot);
+            return;
+        }
+        if (slot->state != SLOT_READING) return;    // Subscribed, or closed
+        slot->state = SLOT_IDLE;
+        slot->lastActivity = millis();
+    }
+}
+
+/**
+ * @brief Give a new connection a slot
+ * 
+ * When all slots are busy, the connection idle for the longest time is
+ * closed; if none is idle the new client gets a 503.
+ */
+static void acceptConnection(WiFiClient& client) {
+    ConnectionSlot* slot = NULL;
+    ConnectionSlot* oldest = NULL;
+    unsigned long now = millis();
+    
+    for (uint8_t i = 0; i < WEB_MAX_CONNECTIONS && slot == NULL; i++) {
+        if (slots[i].state == SLOT_FREE) {
+            slot = &slots[i];
+        } else if (slots[i].state == SLOT_IDLE &&
+                   (oldest == NULL || now - slots[i].lastActivity > now - oldest->lastActivity)) {
+            oldest = &slots[i];
         }
-        
-    } else {
-        snprintf(json, sizeof(json), "{\"error\":\"Invalid action\"}");
+    }
+    if (slot == NULL && oldest != NULL) {
+        closeSlot(oldest);
+        slot = oldest;
+    }
+    
+    if (slot == NULL) {
+        webStats.rejected++;
+        SegmentStream out(client, responseBuffer, sizeof(responseBuffer));
+        sendError(out, "503 Service Unavailable", false);
+        out.flush();
+        client.stop();
+        return;
     }
     
-    return json;
+    webStats.connections++;
+    slot->client = client;
+    slot->state = SLOT_IDLE;
+    slot->lastActivity = millis();
+    slot->served = 0;
 }
 
+// ==========================================
+// MAIN HANDLER
+// ==========================================
+
 /**
- * @brief Parse and save configuration from POST data
- * @param postData POST data buffer (null-terminated)
- * @param length Length of POST data
- * @return true if config saved successfully
+ * @brief Initialize web server
+ * 
+ * Starts the web server on port 80.
+ * Call this after WiFi is connected.
  */
-bool parseAndSaveConfig(const char* postData, size_t length) {
-    DEBUG_PRINTLN("Parsing config from POST data...");
+void initWebServer() {
+    for (uint8_t i = 0; i < WEB_MAX_CONNECTIONS; i++) {
+        slots[i].state = SLOT_FREE;
+    }
+    webServer.begin();
+    DEBUG_PRINTLN("Web server started on port 80");
+}
+
+/**
+ * @brief Handle incoming web requests
+ * 
+ * Call this in main loop(). Accepts at most one new connection, then
+ * advances every open connection by what it has received: never waits
+ * for a client.
+ */
+void handleWebServer() {
+    WiFiClient client = webServer.accept();
+    if (client) {
+        DEBUG_PRINTLN("New web client connected");
+        acceptConnection(client);
+    }
     
-    ClockConfig config;
-    getCurrentConfig(&config);
+    for (uint8_t i = 0; i < WEB_MAX_CONNECTIONS; i++) {
+        if (slots[i].state != SLOT_FREE) serviceSlot(&slots[i]);
+    }
+}
+
+/**
+ * @brief Push the tick and the changes to the event stream subscribers
+ * 
+ * Called every second from loop(): the readings were just polled and
+ * the time just read, nothing is measured again here. One write per
+ * subscriber per second.
+ */
+void publishWebEvents(const DateTime& now) {
+    unsigned long ms = millis();
+    if (ms - pushWindowStart >= 60000UL) {
+        webStats.eventsLastMinute = pushWindowEvents;
+        pushWindowEvents = 0;
+        pushWindowStart = ms;
+    }
+    if (webStats.subscribers == 0) return;
     
-    // Parse NTP settings
-    int tz = extractInt(postData, "timezoneOffset");
-    if (tz != -999) config.timezoneOffset = tz;
+    BufferStream events(eventBuffer, sizeof(eventBuffer));
+    uint8_t count = 0;
     
-    int syncH = extractInt(postData, "ntpSyncHour");
-    if (syncH != -999) config.ntpSyncHour = syncH;
+    char time[12];
+    snprintf(time, sizeof(time), "%02d:%02d:%02d", now.hour(), now.minute(), now.second());
+    size_t start = beginEvent(events, "tick");
+    JsonWriter json(events);
+    json.beginObject();
+    json.key("time").string(time);
+    json.key("ts").number((unsigned long)now.unixtime());
+    json.endObject();
+    if (endEvent(events, start)) count++;
     
-    int syncM = extractInt(postData, "ntpSyncMinute");
-    if (syncM != -999) config.ntpSyncMinute = syncM;
+    bool sensorsChanged = false;
+    for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+        if (channelValue(ch) != pushedValue[ch]) sensorsChanged = true;
+    }
+    MoonState moon;
+    readMoonState(&moon, now.unixtime());
+    bool moonMoved = moonChanged(&moon);
+    if (sensorsChanged) {
+        start = beginEvent(events, "sensors");
+        printSensorsEvent(events, false);
+        if (endEvent(events, start)) count++;
+    }
+    if (moonMoved) {
+        start = beginEvent(events, "moon");
+        printMoonStatusJSON(events);
+        if (endEvent(events, start)) count++;
+    }
+    if (sensorsChanged || moonMoved) rememberPushed(&moon);
     
-    // Parse LED colors
-    int r, g, b;
-    if (extractRGB(postData, "hour", r, g, b)) {
-        if (r >= 0 && r <= 255) config.colorHourR = r;
-        if (g >= 0 && g <= 255) config.colorHourG = g;
-        if (b >= 0 && b <= 255) config.colorHourB = b;
+    for (uint8_t i = 0; i < WEB_MAX_CONNECTIONS; i++) {
+        if (slots[i].state == SLOT_EVENTS) pushToSlot(&slots[i], eventBuffer, events.length, count);
     }
+}
+
+// ==========================================
+// JSON GENERATION FUNCTIONS (NO STRING)
+// ==========================================
+
+/**
+ * @brief Print sensor data as JSON
+ * 
+ * Current readings, channels and the health of every sensor.
+ */
+void printSensorDataJSON(Print& out) {
+    DateTime now = getCurrentTime();
+    char time[12];
+    snprintf(time, sizeof(time), "%02d:%02d:%02d", now.hour(), now.minute(), now.second());
+    
+    JsonWriter json(out);
+    json.beginObject();
+    
+    json.key("indoor").beginObject();
+    json.key("temp").number(indoorData.temperature, 1);
+    json.key("humidity").number(indoorData.humidity, 1);
+    json.key("rawTemp").number(indoorData.rawTemperature, 1);
+    json.key("rawHumidity").number(indoorData.rawHumidity, 1);
+    json.key("valid").boolean(indoorData.valid);
+    json.endObject();
+    
+    json.key("outdoor").beginObject();
+    json.key("temp").number(outdoorData.temperature, 1);
+    json.key("humidity").number(outdoorData.humidity, 1);
+    json.key("rawTemp").number(outdoorData.rawTemperature, 1);
+    json.key("rawHumidity").number(outdoorData.rawHumidity, 1);
+    json.key("valid").boolean(outdoorData.valid);
+    json.endObject();
+    
+    json.key("airQuality").beginObject();
+    json.key("aqi").number(airQuality.estimatedAQI);
+    json.key("raw").number(airQuality.rawADC);
+    json.key("filtered").number(airQuality.filteredADC);
+    json.key("ppm").number(airQuality.ppm);
+    json.key("r0").number(getMQ135State().r0, 1);
+    json.key("quality").string(airQuality.quality);
+    json.endObject();
     
-    if (extractRGB(postData, "minute", r, g, b)) {
-        if (r >= 0 && r <= 255) config.colorMinuteR = r;
-        if (g >= 0 && g <= 255) config.colorMinuteG = g;
-        if (b >= 0 && b <= 255) config.colorMinuteB = b;
+    json.key("time").string(time);
+    
+    // All sensor channels from the registry
+    printChannelsJSON(json.key("channels").raw());
+    
+    // Health telemetry of every registered sensor
+    json.key("health").beginArray();
+    for (uint8_t i = 0; i < getSensorCount(); i++) {
+        printSensorHealthJSON(json.raw(), i);
     }
+    json.endArray();
+    
+    json.endObject();
+}
+
+/**
+ * @brief Print configuration as JSON
+ */
+void printConfigJSON(Print& out) {
+    ClockConfig config;
+    getCurrentConfig(&config);
+    
+    JsonWriter json(out);
+    json.beginObject();
+    json.key("timezoneOffset").number(config.timezoneOffset);
+    json.key("ntpSyncHour").number(config.ntpSyncHour);
+    json.key("ntpSyncMinute").number(config.ntpSyncMinute);
+    
+    json.key("led").beginObject();
+    json.key("hour").beginObject();
+    json.key("r").number(config.colorHourR);
+    json.key("g").number(config.colorHourG);
+    json.key("b").number(config.colorHourB);
+    json.endObject();
+    json.key("minute").beginObject();
+    json.key("r").number(config.colorMinuteR);
+    json.key("g").number(config.colorMinuteG);
+    json.key("b").number(config.colorMinuteB);
+    json.endObject();
+    json.key("second").beginObject();
+    json.key("r").number(config.colorSecondR);
+    json.key("g").number(config.colorSecondG);
+    json.key("b").number(config.colorSecondB);
+    json.endObject();
+    json.key("brightness").number(config.ledBrightness);
+    json.endObject();
+    
+    json.key("lcdTimeout").number((unsigned long)config.lcdTimeout);
+    json.endObject();
+}
+
+/**
+ * @brief Print logging statistics as JSON
+ */
+void printLogStatsJSON(Print& out) {
+    DataLogStats stats = getLogStats();
+    HistoryStats flash = getHistoryStats();
+    
+    JsonWriter json(out);
+    json.beginObject();
+    json.key("bufferCount").number(stats.bufferCount);
+    json.key("bufferMax").number(stats.bufferMax);
+    json.key("bufferUsage").number((int)((stats.bufferBytes * 100UL) / TSRING_BYTES));
+    json.key("bufferBytes").number(stats.bufferBytes);
+    json.key("bufferEvicted").number((unsigned long)stats.bufferEvicted);
+    json.key("totalLogged").number(stats.totalLogged);
+    json.key("totalSent").number(stats.totalSent);
+    json.key("deadbandSkipped").number((unsigned long)stats.deadbandSkipped);
+    json.key("heartbeatLogged").number((unsigned long)stats.heartbeatLogged);
+    json.key("mqttConnected").boolean(stats.mqttConnected);
+    json.key("lastLogTime").number(stats.lastLogTime);
+    json.key("lastSendTime").number(stats.lastSendTime);
+    json.key("drainInterval").number(stats.drainInterval);
+    
+    json.key("flash").beginObject();
+    json.key("recordWrites").number((unsigned long)flash.recordWrites);
+    json.key("bytesWritten").number((unsigned long)flash.bytesWritten);
+    json.key("pageOpens").number(flash.pageOpens);
+    json.key("recordsLoaded").number(flash.recordsLoaded);
+    json.key("crcErrors").number(flash.crcErrors);
+    json.key("maxPageCycles").number((unsigned long)flash.maxPageCycles);
+    json.key("enduranceDays").number((unsigned long)flash.enduranceDays);
+    json.endObject();
     
-    if (extractRGB(postData, "second", r, g, b)) {
-        if (r >= 0 && r <= 255) config.colorSecondR = r;
-        if (g >= 0 && g <= 255) config.colorSecondG = g;
-        if (b >= 0 && b <= 255) config.colorSecondB = b;
+    json.endObject();
+}
+
+/**
+ * @brief Print moon phase status as JSON
+ */
+void printMoonStatusJSON(Print& out) {
+    MoonPhaseData& data = getMoonData();
+    
+    JsonWriter json(out);
+    json.beginObject();
+    json.key("phase").number(data.phase);
+    json.key("phaseName").string(getMoonPhaseName(data.phase));
+    json.key("exactPhase").number(data.exactPhase, 3);
+    json.key("illumination").number(data.illumination, 1);
+    json.key("lunarAge").number(data.lunarAge, 2);
+    json.key("currentSteps").number(data.currentSteps);
+    json.key("calibrated").boolean(data.isCalibrated);
+    
+    if (data.isCalibrated && data.lastCalib > 0) {
+        DateTime now = getCurrentTime();
+        json.key("daysSinceCalibration").number(daysSinceLastCalibration(now.unixtime()), 1);
     }
     
-    // Parse brightness
-    int bright = extractInt(postData, "brightness");
-    if (bright >= 0 && bright <= 255) config.ledBrightness = bright;
+    json.endObject();
+}
+
+/**
+ * @brief Parse and save configuration from POST data
+ * @param postData POST data buffer
+ * @param length Length of POST data
+ * @param result Filled with the parse error, if any
+ * @return true if config saved successfully
+ */
+bool parseAndSaveConfig(const char* postData, size_t length, ConfigParseResult* result) {
+    DEBUG_PRINTLN("Parsing config from POST data...");
+    
+    // Whole body checked first: nothing is changed by an invalid one
+    ConfigDelta delta;
+    if (!parseConfigJSON(postData, length, &delta, result)) {
+        DEBUG_PRINT("Config rejected: ");
+        DEBUG_PRINT(configParseErrorText(result->error));
+        DEBUG_PRINT(" at ");
+        DEBUG_PRINTLN(result->field);
+        return false;
+    }
     
-    // Parse LCD timeout
-    int lcdTime = extractInt(postData, "lcdTimeout");
-    if (lcdTime >= 5000) config.lcdTimeout = lcdTime;
+    ClockConfig config;
+    getCurrentConfig(&config);
+    applyConfigDelta(&delta, &config);
     
     // Save to EEPROM
     bool saved = saveConfig(&config);
@@ -510,28 +1435,8 @@ bool parseAndSaveConfig(const char* postData, size_t length) {
     if (saved) {
         DEBUG_PRINTLN("Config saved successfully");
         applyConfig(&config);
+        configSaves++;
     }
     
     return saved;
 }
-
-/**
- * @brief Send page content in chunks (internal helper)
- */
-void sendPageInChunks(WiFiClient& client, const char* content) {
-    const size_t CHUNK_SIZE = 512;
-    char buffer[CHUNK_SIZE + 1];
-    size_t contentLen = strlen_P(content);
-    size_t sent = 0;
-    
-    while (sent < contentLen) {
-        size_t toSend = min(CHUNK_SIZE, contentLen - sent);
-        memcpy_P(buffer, content + sent, toSend);
-        buffer[toSend] = '\0';
-        
-        client.write((uint8_t*)buffer, toSend);
-        sent += toSend;
-        
-        delay(1);
-    }
-}
@@ -6,8 +6,11 @@
  * 
  * Features:
  * - Web interface on port 80
+ * - HTTP/1.1 keep-alive, WEB_MAX_CONNECTIONS concurrent connections
+ * - Server-Sent Events push channel (/api/events) for the pages
  * - JSON API endpoint for sensor data
- * - Simple HTML page
+ * - Versioned /api/snapshot document, cached until its inputs change
+ * - HTML pages stored gzip-compressed (webassets.h), ETag revalidation
  * 
  * @author F. Baillon
  * @version 1.1.0
@@ -24,11 +27,59 @@
 #include "rtc.h"
 #include "storage.h"
 #include "leds.h"
-#include "webpage.h"
 #include "datalog.h"
 #include "moon.h"
+#include "jobs.h"
+#include "rollup.h"
+#include "mq135.h"
+#include "httpparser.h"
+#include "configparser.h"
 
 
+// ==========================================
+// WEB SERVER CONFIGURATION
+// ==========================================
+#define WEB_MAX_CONNECTIONS 4       ///< Connection slots (~500 bytes RAM each)
+#define WEB_MAX_SUBSCRIBERS 2       ///< Slots that may hold an /api/events stream
+#define SSE_BUFFER_SIZE     768     ///< Events pushed in one write (tick + sensors + moon)
+#define SNAPSHOT_BUFFER_SIZE 1280   ///< Cached /api/snapshot document
+#define HTTP_READ_TIMEOUT   2000    ///< Max time to receive a request (ms)
+#define HTTP_IDLE_TIMEOUT   5000    ///< Keep-alive connection closed after this idle time (ms)
+#define HTTP_KEEPALIVE_MAX  100     ///< Requests per connection before it is closed
+#define WEB_WRITE_SIZE      1436    ///< Response buffer, bytes per client write: one TCP segment (MSS of the WiFi module)
+#define WEB_BODY_SIZE       1280    ///< API body sent with a Content-Length; larger ones are sent chunked
+#define WEB_STACK_PROBE     false   ///< true: measure stack used by responses (stackPeak, paints the free stack)
+#define WEB_STACK_PROBE_BYTES 1024  ///< Free stack painted below the server by the probe
+
+/**
+ * @struct WebServerStats
+ * @brief Request and parser statistics (since boot, /api/webstats)
+ */
+struct WebServerStats {
+  uint32_t requests;          ///< Requests received
+  uint32_t notModified;       ///< Pages answered 304 (cached by the browser)
+  uint32_t notFound;          ///< Unknown paths (404)
+  uint32_t badRequests;       ///< Malformed, oversized or wrong method (4xx)
+  uint32_t timeouts;          ///< Incomplete requests (408)
+  uint32_t connections;       ///< Connections accepted
+  uint32_t keepAliveReused;   ///< Requests on an already used connection
+  uint32_t rejected;          ///< Connections or subscriptions refused (503)
+  uint32_t subscribers;       ///< Open /api/events streams
+  uint32_t eventsPushed;      ///< Events written to subscribers
+  uint32_t eventsLastMinute;  ///< Events written during the last full minute
+  uint32_t eventBytes;        ///< Bytes written to subscribers
+  uint32_t snapshotHits;      ///< /api/snapshot requests (200 or 304)
+  uint32_t snapshotBuilds;    ///< Snapshot versions built (inputs changed)
+  uint32_t responseWrites;    ///< Client writes for responses (round trips to the WiFi module)
+  uint32_t bytesParsed;       ///< Request bytes parsed
+  uint32_t parseMicrosTotal;  ///< Time spent in the parser (µs)
+  uint32_t parseMicrosMax;    ///< Longest parse of one request (µs)
+  uint32_t assetsSent;        ///< Pages sent in full (200)
+  uint32_t assetMicrosTotal;  ///< Time spent sending pages (µs)
+  uint32_t assetMicrosMax;    ///< Longest page send (µs)
+  uint32_t stackPeak;         ///< Most stack used by a response (bytes, WEB_STACK_PROBE)
+};
+
 // ==========================================
 // WEB SERVER OBJECT
 // ==========================================
@@ -49,63 +100,63 @@ void initWebServer();
 /**
  * @brief Handle incoming web requests
  * 
- * Call this in main loop() to process HTTP requests.
- * Non-blocking - returns immediately if no client.
+ * Call this in main loop() to process HTTP requests. Up to
+ * WEB_MAX_CONNECTIONS clients are served side by side, each with its
+ * own parser: a slow or idle client never blocks the others.
+ * Non-blocking - returns immediately if no client has sent data.
  */
 void handleWebServer();
 
 /**
- * @brief Get sensor data as JSON string
- * 
- * Formats current sensor readings into JSON format.
+ * @brief Push live data to the /api/events subscribers
  * 
- * ⚠️ Returns pointer to static buffer - valid until next call
+ * Call once per second from loop(), after the sensors are polled. Sends
+ * a "tick" event (time), plus "sensors" with the channels that changed
+ * and "moon" when the moon moved. Returns at once without subscribers.
  * 
- * @return Pointer to static JSON buffer
+ * @param now Current time, as just read for the clock
  */
-const char* getSensorDataJSON();
+void publishWebEvents(const DateTime& now);
 
 /**
- * @brief Get moon phase data as JSON string
- * 
- * Formats moon phase data into JSON format based on action parameter.
+ * @brief Print sensor data as JSON
  * 
- * ⚠️ Returns pointer to static buffer - valid until next call
+ * Current readings, channels and the health of every sensor, written
+ * as produced (no buffer).
  * 
- * @param action Action to perform ("status" or "recalibrate")
- * @return Pointer to static JSON buffer
+ * @param out Output (client, stream, buffer)
  */
-const char* getMoonDataJSON(const char* action);
+void printSensorDataJSON(Print& out);
 
 /**
- * @brief Get configuration as JSON string
- * 
- * ⚠️ Returns pointer to static buffer - valid until next call
- * 
- * @return Pointer to static JSON buffer
+ * @brief Print moon phase status as JSON
+ * @param out Output (client, stream, buffer)
  */
-const char* getConfigJSON();
+void printMoonStatusJSON(Print& out);
 
 /**
- * @brief Get logging statistics as JSON string
- * 
- * ⚠️ Returns pointer to static buffer - valid until next call
- * 
- * @return Pointer to static JSON buffer
+ * @brief Print configuration as JSON
+ * @param out Output (client, stream, buffer)
  */
-const char* getLogStatsJSON();
+void printConfigJSON(Print& out);
 
 /**
- * @brief Parse and save configuration from POST data
- * @param postData POST data buffer (null-terminated)
- * @param length Length of POST data
- * @return true if config saved successfully
+ * @brief Print logging statistics as JSON
+ * @param out Output (client, stream, buffer)
  */
-bool parseAndSaveConfig(const char* postData, size_t length);
+void printLogStatsJSON(Print& out);
 
 /**
- * @brief Send page content in chunks (internal helper)
+ * @brief Parse and save configuration from POST data
+ * 
+ * The body is validated as a whole (configparser.h): nothing is saved
+ * unless every field is known and in range.
+ * 
+ * @param postData POST data buffer
+ * @param length Length of POST data
+ * @param result Filled with the parse error, if any
+ * @return true if config saved successfully
  */
-void sendPageInChunks(WiFiClient& client, const char* content);
+bool parseAndSaveConfig(const char* postData, size_t length, ConfigParseResult* result);
 
 #endif // WEBSERVER_H
\ No newline at end of file
@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+"""
+Decode binary data log chunks published on home/clock/buffer/bin
+(MQTT_BUFFER_BINARY in firmware/smart-led-clock/datalog.h) to JSON or CSV.
+
+Payload schema v1, little endian:
+    uint8   version
+    uint8   channel count
+    uint16  point count
+    uint32  timestamp + int16 x channels      first point, raw values
+    records                                   following points (tsring.h):
+        varint(zigzag(delta-of-delta ts) << 1 | maskChanged)
+        [varint(validity mask)]               only if maskChanged
+        varint(zigzag(value delta))           for each valid channel
+
+Payloads are self-delimiting, so several can be concatenated in one file
+or on stdin, e.g.:
+    mosquitto_sub -t home/clock/buffer/bin -C 10 -N | python3 tools/decode_buffer.py --csv
+
+Output is one JSON object per point, with the same keys and scaling as
+the JSON topic ({"ts":...,"tIn":21.5,...}, null for missing values).
+
+Usage: python3 tools/decode_buffer.py [--csv] [file ...]
+       python3 tools/decode_buffer.py --selftest
+"""
+import csv
+import json
+import random
+import struct
+import sys
+
+VERSION = 1
+INVALID = -32768               # SENSOR_VALUE_INVALID
+# sensorChannels[] in sensors.cpp: key, decimals
+CHANNELS = [("tIn", 1), ("hIn", 1), ("tOut", 1), ("hOut", 1), ("aqi", 0), ("tRtc", 1)]
+
+
+def zigzag(v):
+    return ((v << 1) ^ (v >> 31)) & 0xFFFFFFFF
+
+
+def unzigzag(u):
+    return (u >> 1) ^ -(u & 1)
+
+
+def varint(v):
+    out = bytearray()
+    while v >= 0x80:
+        out.append((v & 0x7F) | 0x80)
+        v >>= 7
+    out.append(v)
+    return out
+
+
+def read_varint(buf, pos):
+    v = shift = 0
+    while True:
+        b = buf[pos]
+        pos += 1
+        v |= (b & 0x7F) << shift
+        shift += 7
+        if not b & 0x80:
+            return v, pos
+
+
+def wrap16(v):
+    return (v + 0x8000) % 0x10000 - 0x8000
+
+
+def decode_payload(buf, pos=0):
+    """Decode one payload at pos, return (points, next pos)."""
+    version, channels, count = struct.unpack_from("<BBH", buf, pos)
+    if version != VERSION:
+        raise ValueError(f"unsupported payload version {version} at offset {pos}")
+    pos += 4
+    ts, *values = struct.unpack_from("<I%dh" % channels, buf, pos)
+    pos += 4 + 2 * channels
+    points = [(ts, list(values))]
+
+    last = [v if v != INVALID else 0 for v in values]
+    mask = sum(1 << ch for ch, v in enumerate(values) if v != INVALID)
+    delta = 0
+    for _ in range(count - 1):
+        tag, pos = read_varint(buf, pos)
+        delta += unzigzag(tag >> 1)
+        ts = (ts + delta) & 0xFFFFFFFF
+        if tag & 1:
+            mask, pos = read_varint(buf, pos)
+        point = []
+        for ch in range(channels):
+            if mask >> ch & 1:
+                d, pos = read_varint(buf, pos)
+                last[ch] = wrap16(last[ch] + unzigzag(d))
+                point.append(last[ch])
+            else:
+                point.append(INVALID)
+        points.append((ts, point))
+    return points, pos
+
+
+def decode_stream(buf):
+    pos = 0
+    while pos < len(buf):
+        points, pos = decode_payload(buf, pos)
+        yield from points
+
+
+def encode_payload(points):
+    """Reference encoder (mirror of packBufferChunkBinary), for --selftest."""
+    ts, values = points[0]
+    out = bytearray(struct.pack("<BBHI%dh" % len(values), VERSION, len(values), len(points), ts, *values))
+    last = [v if v != INVALID else 0 for v in values]
+    mask = sum(1 << ch for ch, v in enumerate(values) if v != INVALID)
+    prev_delta = 0
+    for ts_next, values in points[1:]:
+        delta = ts_next - ts
+        new_mask = sum(1 << ch for ch, v in enumerate(values) if v != INVALID)
+        out += varint((zigzag(delta - prev_delta) << 1) | (new_mask != mask))
+        if new_mask != mask:
+            out += varint(new_mask)
+        for ch, v in enumerate(values):
+            if new_mask >> ch & 1:
+                out += varint(zigzag(v - last[ch]))
+                last[ch] = v
+        ts, prev_delta, mask = ts_next, delta, new_mask
+    return out
+
+
+def channel_names(count):
+    return [CHANNELS[ch] if ch < len(CHANNELS) else (f"ch{ch}", 0) for ch in range(count)]
+
+
+def scaled(value, decimals):
+    if value == INVALID:
+        return None
+    return round(value / 10 ** decimals, decimals) if decimals else value
+
+
+def selftest():
+    rnd = random.Random(3)
+    points, ts = [], 1760000000
+    for i in range(200):
+        ts += 300 + rnd.choice((0, 0, 0, 1, -1, 3600))
+        values = [rnd.randint(-400, 900) for _ in CHANNELS]
+        if rnd.random() < 0.1:
+            values[2] = values[3] = INVALID
+        points.append((ts, values))
+    stream = encode_payload(points[:70]) + encode_payload(points[70:])
+    decoded = list(decode_stream(stream))
+    ok = decoded == points
+    print(f"{len(points)} points in {len(stream)} bytes ({len(stream) / len(points):.1f} B/point): "
+          f"{'OK' if ok else 'FAIL'}")
+    return 0 if ok else 1
+
+
+def main():
+    args = sys.argv[1:]
+    if "--selftest" in args:
+        return selftest()
+    as_csv = "--csv" in args
+    files = [a for a in args if not a.startswith("--")]
+
+    data = b"".join(open(f, "rb").read() for f in files) if files else sys.stdin.buffer.read()
+    points = list(decode_stream(data))
+    count = len(points[0][1]) if points else len(CHANNELS)
+    names = channel_names(count)
+
+    if as_csv:
+        writer = csv.writer(sys.stdout)
+        writer.writerow(["ts"] + [key for key, _ in names])
+        for ts, values in points:
+            writer.writerow([ts] + ["" if v == INVALID else scaled(v, d) for v, (_, d) in zip(values, names)])
+    else:
+        for ts, values in points:
+            record = {"ts": ts}
+            record.update({key: scaled(v, d) for v, (key, d) in zip(values, names)})
+            print(json.dumps(record, separators=(",", ":")))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""
+Generate the lookup tables used by firmware/smart-led-clock/comfort.cpp and
+measure the error of the fixed-point kernels against the float formulas they
+replace (sensors.cpp calculateDewPoint()/calculateHumidex() and the DHT
+library computeHeatIndex()).
+
+The kernels are emulated here with the exact integer arithmetic of the
+firmware, over -40..+60 °C (0.1 °C) × 0..100 %RH (0.1 %). The script prints
+the C tables and the maximum errors; it exits non-zero if an error exceeds
+the bound documented in comfort.h.
+
+Usage: python3 tools/gen_comfort_tables.py
+"""
+import math
+import sys
+
+MAGNUS_A = 17.27
+MAGNUS_B = 237.3
+Q = 4096                       # Q12
+LN_FIRST, LN_LAST = 20, 100    # ln table covers 20..100 %RH (1 % steps)
+E_FIRST, E_LAST = -60, 60      # vapour pressure table covers Td -60..+60 °C
+
+DEW_POINT_BOUND = 0.07         # °C, RH >= 1 % (includes 0.1 °C output quantisation)
+HUMIDEX_BOUND = 0.40           # humidex points, before rounding to integer
+HEAT_INDEX_BOUND = 0.01        # °C
+
+
+def ln_table():
+    return [round(math.log(rh / 100.0) * Q) for rh in range(LN_FIRST, LN_LAST + 1)]
+
+
+def e_table():
+    return [round(611.0 * math.exp(5417.753 * (1 / 273.16 - 1 / (273.15 + td))))
+            for td in range(E_FIRST, E_LAST + 1)]
+
+
+LN = ln_table()
+E = e_table()
+LN2_Q12 = round(math.log(2) * Q)
+A_Q12 = round(MAGNUS_A * Q)
+
+
+def idiv(n, d):
+    """C integer division (truncates toward zero)."""
+    q = abs(n) // abs(d)
+    return q if (n >= 0) == (d >= 0) else -q
+
+
+def rdiv(n, d):
+    """Rounded division as done in the firmware (d > 0)."""
+    return idiv(n + d // 2, d) if n >= 0 else idiv(n - d // 2, d)
+
+
+def ln_q12(h10):
+    g = 0
+    while h10 < LN_FIRST * 10:
+        h10 *= 2
+        g -= LN2_Q12
+    i = h10 // 10 - LN_FIRST
+    f = h10 % 10
+    if i >= len(LN) - 1:
+        return g + LN[-1]
+    return g + LN[i] + idiv((LN[i + 1] - LN[i]) * f, 10)
+
+
+def dew_point10(t10, h10):
+    h10 = max(h10, 1)
+    gamma = ln_q12(h10) + idiv(A_Q12 * t10, 2373 + t10)
+    return rdiv(2373 * gamma, A_Q12 - gamma)
+
+
+def humidex10(t10, td10):
+    td10 = min(max(td10, E_FIRST * 10), E_LAST * 10)
+    i = idiv(td10 - E_FIRST * 10, 10)
+    f = (td10 - E_FIRST * 10) % 10
+    e100 = E[i] if i >= len(E) - 1 else E[i] + idiv((E[i + 1] - E[i]) * f, 10)
+    return t10 + rdiv(5555 * e100 - 5555000, 100000)
+
+
+def ref_dew(t, h):
+    a = math.log(h / 100.0) + (MAGNUS_A * t) / (MAGNUS_B + t)
+    return (MAGNUS_B * a) / (MAGNUS_A - a)
+
+
+def ref_humidex(t, h):
+    dp = ref_dew(t, h)
+    e = 6.11 * math.exp(5417.753 * (1.0 / 273.16 - 1.0 / (273.15 + dp)))
+    return t + 0.5555 * (e - 10.0)
+
+
+def ref_heat_index_c(t, h):
+    """Adafruit DHT computeHeatIndex(t, h, false)."""
+    f = t * 1.8 + 32
+    hi = 0.5 * (f + 61.0 + ((f - 68.0) * 1.2) + (h * 0.094))
+    if hi > 79:
+        hi = (-42.379 + 2.04901523 * f + 10.14333127 * h - 0.22475541 * f * h
+              - 0.00683783 * f ** 2 - 0.05481717 * h ** 2 + 0.00122874 * f ** 2 * h
+              + 0.00085282 * f * h ** 2 - 0.00000199 * f ** 2 * h ** 2)
+        if h < 13 and 80.0 <= f <= 112.0:
+            hi -= ((13.0 - h) * 0.25) * math.sqrt((17.0 - abs(f - 95.0)) * 0.05882)
+        elif h > 85.0 and 80.0 <= f <= 87.0:
+            hi += ((h - 85.0) * 0.1) * ((87.0 - f) * 0.2)
+    return (hi - 32) * 0.55555
+
+
+def horner_heat_index_c(t, h):
+    """Same regression as the firmware: Horner form, single pass."""
+    f = t * 1.8 + 32
+    hi = 0.5 * (f + 61.0 + ((f - 68.0) * 1.2) + (h * 0.094))
+    if hi > 79:
+        hi = (-42.379 + h * (10.14333127 - 0.05481717 * h)
+              + f * (2.04901523 - 0.22475541 * h + 0.00085282 * h * h)
+              + f * f * (-0.00683783 + h * (0.00122874 - 0.00000199 * h)))
+        if h < 13 and 80.0 <= f <= 112.0:
+            hi -= ((13.0 - h) * 0.25) * math.sqrt((17.0 - abs(f - 95.0)) * 0.05882)
+        elif h > 85.0 and 80.0 <= f <= 87.0:
+            hi += ((h - 85.0) * 0.1) * ((87.0 - f) * 0.2)
+    return (hi - 32) * 0.55555
+
+
+def main():
+    worst_dp = worst_hx = worst_hi = 0.0
+    for t10 in range(-400, 601):
+        t = t10 / 10.0
+        for h10 in range(10, 1001):
+            h = h10 / 10.0
+            td10 = dew_point10(t10, h10)
+            worst_dp = max(worst_dp, abs(td10 / 10.0 - ref_dew(t, h)))
+            worst_hx = max(worst_hx, abs(humidex10(t10, td10) / 10.0 - ref_humidex(t, h)))
+            worst_hi = max(worst_hi, abs(horner_heat_index_c(t, h) - ref_heat_index_c(t, h)))
+
+    print("// Generated by tools/gen_comfort_tables.py")
+    print(f"// Max error over -40..+60 °C, 1..100 %RH: dew point {worst_dp:.3f} °C, "
+          f"humidex {worst_hx:.2f}, heat index {worst_hi:.4f} °C")
+    print(f"static const int16_t LN_RH_Q12[COMFORT_LN_POINTS] PROGMEM = {{")
+    for i in range(0, len(LN), 9):
+        print("  " + ", ".join(f"{v:6d}" for v in LN[i:i + 9]) + ",")
+    print("};")
+    print(f"static const uint16_t SAT_VAPOUR_PA[COMFORT_E_POINTS] PROGMEM = {{")
+    for i in range(0, len(E), 11):
+        print("  " + ", ".join(f"{v:5d}" for v in E[i:i + 11]) + ",")
+    print("};")
+
+    ok = worst_dp <= DEW_POINT_BOUND and worst_hx <= HUMIDEX_BOUND and worst_hi <= HEAT_INDEX_BOUND
+    if not ok:
+        print("FAIL: error bound exceeded", file=sys.stderr)
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+"""
+Generate the MQ135 Rs/R0 -> ppm lookup table used by firmware/smart-led-clock/mq135.cpp.
+
+The MQ135 CO2 sensitivity curve (datasheet Fig. 2, log-log) is modelled by the
+usual power-law fit  ppm = A * (Rs/R0)^B. The firmware stores the curve as
+geometrically spaced (ratio, ppm) knots in flash and interpolates linearly
+between them, so no pow() is evaluated at run time.
+
+Running this script prints the C table and checks that:
+  - the fit passes through the reference points below (within REF_TOL),
+  - linear interpolation between knots stays within INTERP_TOL of the curve
+    (or 1 ppm, whichever is larger, since knots are stored as integers).
+
+Usage: python3 tools/gen_mq135_table.py
+"""
+import math
+import sys
+
+A = 116.6020682          # Power-law scale (ppm at Rs/R0 = 1)
+B = -2.769034857         # Power-law exponent
+ATMO_CO2 = 400.0         # Clean-air CO2 reference (ppm)
+
+RATIO_MIN = 0.15         # ~22000 ppm
+RATIO_MAX = 2.50         # ~9 ppm
+KNOTS = 48
+Q = 4096                 # Ratio fixed point (Q12)
+
+# Reference points (Rs/R0, ppm) read from the datasheet CO2 curve (log-log plot).
+REFERENCE = [(2.40, 10.0), (1.06, 100.0), (0.46, 1000.0), (0.36, 2000.0)]
+REF_TOL = 0.05
+INTERP_TOL = 0.01
+
+
+def ppm(ratio):
+    return A * ratio ** B
+
+
+def main():
+    step = (RATIO_MAX / RATIO_MIN) ** (1.0 / (KNOTS - 1))
+    knots = []
+    for i in range(KNOTS):
+        r = RATIO_MIN * step ** i
+        knots.append((round(r * Q), round(ppm(round(r * Q) / Q))))
+
+    ok = True
+    for r, p in REFERENCE:
+        err = abs(ppm(r) - p) / p
+        if err > REF_TOL:
+            print(f"FAIL reference ratio={r} ppm={p} fit={ppm(r):.1f}", file=sys.stderr)
+            ok = False
+
+    worst = 0.0
+    for (r0, p0), (r1, p1) in zip(knots, knots[1:]):
+        for k in range(1, 16):
+            r = r0 + (r1 - r0) * k / 16
+            approx = p0 + (p1 - p0) * k / 16
+            exact = ppm(r / Q)
+            worst = max(worst, max(abs(approx - exact) - 1.0, 0.0) / exact)
+    if worst > INTERP_TOL:
+        print(f"FAIL interpolation error {worst:.4f}", file=sys.stderr)
+        ok = False
+
+    print(f"// Generated by tools/gen_mq135_table.py (max interpolation error {worst * 100:.2f} % + 1 ppm)")
+    print(f"static const MQ135CurvePoint MQ135_CURVE[MQ135_CURVE_POINTS] PROGMEM = {{")
+    for i in range(0, KNOTS, 4):
+        row = ", ".join(f"{{{r:5d}, {p:5d}}}" for r, p in knots[i:i + 4])
+        print(f"  {row},")
+    print("};")
+    print(f"// Clean-air ratio at {ATMO_CO2:.0f} ppm: {(ATMO_CO2 / A) ** (1 / B):.4f}")
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
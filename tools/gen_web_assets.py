@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""
+Generate firmware/smart-led-clock/webassets.h from the pages in
+firmware/smart-led-clock/web/.
+
+Each asset is stored gzip-compressed in flash, with its length and ETag
+(hash of the compressed bytes) fixed at compile time: the web server sends
+the bytes as they are (Content-Encoding: gzip) and answers If-None-Match
+with 304 Not Modified, without ever decompressing or measuring anything.
+
+Edit the files in web/, then run this script and commit both. Running it
+checks that every asset decompresses back to its source; with --check it
+only verifies that webassets.h is up to date (exit status 1 otherwise).
+
+Usage: python3 tools/gen_web_assets.py [--check]
+"""
+import gzip
+import hashlib
+import os
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "firmware", "smart-led-clock")
+WEB_DIR = os.path.join(ROOT, "web")
+OUTPUT = os.path.join(ROOT, "webassets.h")
+
+# (source file, C name, content type)
+ASSETS = [
+    ("index.html", "WEBASSET_HOME", "text/html"),
+    ("config.html", "WEBASSET_CONFIG", "text/html"),
+    ("moon.html", "WEBASSET_MOON", "text/html"),
+    ("style.css", "WEBASSET_STYLE", "text/css"),
+]
+
+HEADER = """/**
+ * @file webassets.h
+ * @brief Web pages, gzip-compressed (generated - do not edit)
+ *
+ * Generated by tools/gen_web_assets.py from the files in web/: edit the
+ * sources and run the script again.
+ *
+{table}
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#ifndef WEBASSETS_H
+#define WEBASSETS_H
+
+#include <Arduino.h>
+
+/**
+ * @struct WebAsset
+ * @brief Document sent with an ETag (static file in flash, or cached in RAM)
+ */
+struct WebAsset {{
+  const uint8_t* data;            ///< Bytes as sent (flash or RAM)
+  uint32_t length;                ///< Number of bytes
+  const char* etag;               ///< Quoted entity tag
+  const char* contentType;        ///< MIME type of the uncompressed file
+  const char* encoding;           ///< Content-Encoding ("gzip"), NULL if none
+}};
+"""
+
+
+def compress(data):
+    # mtime=0 and no file name: same input, same bytes, same ETag
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def c_array(name, data):
+    lines = [f"static const uint8_t {name}_DATA[{len(data)}] PROGMEM = {{"]
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join(f"0x{b:02x}" for b in data[i:i + 16]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def generate():
+    table = []
+    body = []
+    for source, name, content_type in ASSETS:
+        with open(os.path.join(WEB_DIR, source), "rb") as f:
+            raw = f.read()
+        packed = compress(raw)
+        if gzip.decompress(packed) != raw:
+            sys.exit(f"FAIL {source}: gzip round trip")
+        etag = hashlib.sha1(packed).hexdigest()[:8]
+
+        table.append(f" * - {name}: web/{source}, {len(raw)} -> {len(packed)} bytes")
+        body.append("")
+        body.append(c_array(name, packed))
+        body.append(f'static const WebAsset {name} = {{{name}_DATA, {len(packed)}, "\\"{etag}\\"", "{content_type}", "gzip"}};')
+        print(f"{source:12s} {len(raw):6d} -> {len(packed):5d} bytes  etag {etag}", file=sys.stderr)
+
+    text = HEADER.format(table="\n".join(table)) + "\n".join(body) + "\n\n#endif // WEBASSETS_H\n"
+    return text
+
+
+def main():
+    text = generate()
+    if "--check" in sys.argv[1:]:
+        with open(OUTPUT) as f:
+            if f.read() != text:
+                sys.exit("webassets.h is out of date: run tools/gen_web_assets.py")
+        print("webassets.h is up to date", file=sys.stderr)
+        return
+    with open(OUTPUT, "w") as f:
+        f.write(text)
+    print(f"Wrote {os.path.relpath(OUTPUT)}", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
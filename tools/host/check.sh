@@ -0,0 +1,65 @@
+#!/bin/sh
+# Build the host harnesses of tools/host: compare the web server's JSON
+# with the golden files, fuzz the config parser (sanitizers on) and check
+# its verdicts against Python's json, run the numeric checks of the
+# sensor code and the data log ring, compare the MQTT JSON messages with
+# their golden file, and decode real binary buffer uploads with
+# tools/decode_buffer.py. Run from the repository root:
+#
+#   sh tools/host/check.sh            # diff, exit 1 on any change
+#   sh tools/host/check.sh --update   # rewrite the golden files
+#
+# Only a deliberate change of a response may be committed with --update.
+set -e
+FW=firmware/smart-led-clock
+OUT=${TMPDIR:-/tmp}/smart-led-clock-host
+mkdir -p "$OUT"
+CXXFLAGS="-std=gnu++17 -Wall -Wextra -Werror"
+
+g++ $CXXFLAGS -Itools/host/stubs -I$FW tools/host/host_web.cpp \
+  $FW/webserver.cpp $FW/httpparser.cpp $FW/sensors.cpp $FW/comfort.cpp \
+  $FW/mq135.cpp $FW/filter.cpp $FW/rollup.cpp $FW/configparser.cpp \
+  -o "$OUT/host_web"
+"$OUT/host_web" > "$OUT/web_json.txt"
+
+if [ "$1" = "--update" ]; then
+  cp "$OUT/web_json.txt" tools/host/golden/web_json.txt
+  echo "golden/web_json.txt updated"
+else
+  diff -u tools/host/golden/web_json.txt "$OUT/web_json.txt"
+  echo "web_json: identical"
+fi
+
+g++ $CXXFLAGS -g -fsanitize=address,undefined -fno-sanitize-recover=undefined -Itools/host/stubs -I$FW \
+  tools/host/host_configparser.cpp $FW/configparser.cpp -o "$OUT/host_configparser"
+"$OUT/host_configparser" 200000 "$OUT/configparser_dump.txt"
+python3 tools/host/configparser_ref.py "$OUT/configparser_dump.txt"
+
+g++ $CXXFLAGS -Itools/host/stubs -I$FW tools/host/host_mq135.cpp $FW/mq135.cpp -o "$OUT/host_mq135"
+"$OUT/host_mq135"
+
+g++ $CXXFLAGS -O2 -Itools/host/stubs -I$FW tools/host/host_comfort.cpp $FW/comfort.cpp -o "$OUT/host_comfort"
+"$OUT/host_comfort"
+
+g++ $CXXFLAGS -O2 -Itools/host/stubs -I$FW tools/host/host_tsring.cpp $FW/tsring.cpp -o "$OUT/host_tsring"
+"$OUT/host_tsring"
+
+g++ $CXXFLAGS -Itools/host/stubs -I$FW tools/host/host_datalog.cpp \
+  $FW/datalog.cpp $FW/tsring.cpp $FW/history.cpp $FW/rollup.cpp $FW/sensors.cpp \
+  $FW/comfort.cpp $FW/mq135.cpp $FW/filter.cpp -o "$OUT/host_datalog_json"
+"$OUT/host_datalog_json" "$OUT/mqtt_json.txt" "$OUT/mqtt_points.txt"
+
+if [ "$1" = "--update" ]; then
+  cp "$OUT/mqtt_json.txt" tools/host/golden/mqtt_json.txt
+  echo "golden/mqtt_json.txt updated"
+else
+  diff -u tools/host/golden/mqtt_json.txt "$OUT/mqtt_json.txt"
+  echo "mqtt_json: identical"
+fi
+
+g++ $CXXFLAGS -DMQTT_BUFFER_BINARY=true -Itools/host/stubs -I$FW tools/host/host_datalog.cpp \
+  $FW/datalog.cpp $FW/tsring.cpp $FW/history.cpp $FW/rollup.cpp $FW/sensors.cpp \
+  $FW/comfort.cpp $FW/mq135.cpp $FW/filter.cpp -o "$OUT/host_datalog_bin"
+"$OUT/host_datalog_bin" "$OUT/buffer_chunks.bin" "$OUT/buffer_points.txt"
+python3 tools/decode_buffer.py "$OUT/buffer_chunks.bin" | diff -u "$OUT/buffer_points.txt" -
+echo "decode_buffer: identical"
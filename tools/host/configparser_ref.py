@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""
+Differential check of the config parser (configparser.cpp) against
+Python's json module.
+
+host_configparser dumps its mutated documents, one per line:
+"<accepted> <error> <hex bytes>". Each one is judged again with
+json.loads (NaN/Infinity refused) and the field table of configparser.h.
+Both must agree on accepted or rejected, and on the kind of error
+(unknown field, wrong type, out of range) when neither calls it a
+syntax error. The script prints the mismatches and exits non-zero if
+there are any.
+
+Usage: python3 tools/host/configparser_ref.py <dump file>
+"""
+import json
+import sys
+
+PATHS = ["timezoneOffset", "ntpSyncHour", "ntpSyncMinute",
+         "led.hour.r", "led.hour.g", "led.hour.b",
+         "led.minute.r", "led.minute.g", "led.minute.b",
+         "led.second.r", "led.second.g", "led.second.b",
+         "led.brightness", "lcdTimeout"]
+MINIMUM = [-12, 0, 0] + [0] * 10 + [5000]
+MAXIMUM = [14, 23, 59] + [255] * 10 + [300000]
+ERRORS = {0: "ok", 1: "syntax", 2: "unknown", 3: "type", 4: "range"}   # ConfigParseError
+
+
+def reject_constant(name):
+    raise ValueError(name)
+
+
+def check_object(obj, prefix):
+    for key, value in obj.items():
+        path = prefix + key
+        if path in PATHS:
+            if type(value) is not int:
+                return "type"
+            i = PATHS.index(path)
+            if not MINIMUM[i] <= value <= MAXIMUM[i]:
+                return "range"
+        elif any(p.startswith(path + ".") for p in PATHS):
+            if not isinstance(value, dict):
+                return "type"
+            error = check_object(value, path + ".")
+            if error:
+                return error
+        else:
+            return "unknown"
+    return None
+
+
+def reference(body):
+    try:
+        doc = json.loads(body.decode("latin-1"), parse_constant=reject_constant)
+    except ValueError:
+        return "syntax"
+    if not isinstance(doc, dict):
+        return "syntax"
+    return check_object(doc, "") or "ok"
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(__doc__.strip().splitlines()[-1])
+    cases = mismatches = 0
+    with open(sys.argv[1]) as dump:
+        for line in dump:
+            parts = line.split()
+            body = bytes.fromhex(parts[2] if len(parts) > 2 else "")
+            mine = "ok" if parts[0] == "1" else ERRORS[int(parts[1])]
+            theirs = reference(body)
+            cases += 1
+            if (mine == "ok") != (theirs == "ok") or \
+               (mine != "syntax" and theirs != "syntax" and mine != theirs):
+                mismatches += 1
+                if mismatches <= 10:
+                    print("parser %s, json %s: %r" % (mine, theirs, body))
+    print("configparser_ref: %d documents, %d mismatches" % (cases, mismatches))
+    return 1 if mismatches else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,147 @@
+/**
+ * @file host_comfort.cpp
+ * @brief Host harness: comfort kernels against the float formulas
+ *
+ * comfort.cpp is compiled for the PC and swept over -40..+60 °C and
+ * 0..100 %RH in 0.1 steps. dewPoint10(), humidex10() and heatIndexC() are
+ * compared with the double-precision formulas they replaced
+ * (the former calculateDewPoint() / calculateHumidex() of sensors.cpp and
+ * DHT::computeHeatIndex()), and must stay within the bounds of comfort.h
+ * from 1 %RH up; below, the input is clamped to 0.1 %RH. The time per
+ * call of both versions is printed (PC figures, for comparison only):
+ *
+ *   sh tools/host/check.sh
+ *
+ * Build alone (from the repository root):
+ *
+ *   g++ -std=gnu++17 -Wall -Wextra -Werror -O2 -Itools/host/stubs -Ifirmware/smart-led-clock tools/host/host_comfort.cpp firmware/smart-led-clock/comfort.cpp -o host_comfort
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#include "comfort.h"
+#include <chrono>
+
+#define DEW_POINT_BOUND   0.07      ///< °C, includes the 0.1 °C output resolution
+#define HUMIDEX_BOUND     0.40      ///< Humidex points, before rounding
+#define HEAT_INDEX_BOUND  0.01      ///< °C
+
+static int failures = 0;
+
+#define CHECK(condition, ...) do { \
+    if (!(condition)) { \
+      if (++failures <= 20) { printf("FAIL line %d: ", __LINE__); printf(__VA_ARGS__); printf("\n"); } \
+    } \
+  } while (0)
+
+// ==========================================
+// REFERENCE (previous float implementations)
+// ==========================================
+
+static double refDewPoint(double t, double h) {
+  double a = log(h / 100.0) + (17.27 * t) / (237.3 + t);
+  return (237.3 * a) / (17.27 - a);
+}
+
+static double refHumidex(double t, double h) {
+  double dp = refDewPoint(t, h);
+  double e = 6.11 * exp(5417.753 * (1.0 / 273.16 - 1.0 / (273.15 + dp)));
+  return t + 0.5555 * (e - 10.0);
+}
+
+static double refHeatIndexC(double t, double h) {
+  double f = t * 1.8 + 32;
+  double hi = 0.5 * (f + 61.0 + ((f - 68.0) * 1.2) + (h * 0.094));
+  if (hi > 79) {
+    hi = -42.379 + 2.04901523 * f + 10.14333127 * h + -0.22475541 * f * h +
+         -0.00683783 * pow(f, 2) + -0.05481717 * pow(h, 2) +
+         0.00122874 * pow(f, 2) * h + 0.00085282 * f * pow(h, 2) +
+         -0.00000199 * pow(f, 2) * pow(h, 2);
+    if ((h < 13) && (f >= 80.0) && (f <= 112.0)) {
+      hi -= ((13.0 - h) * 0.25) * sqrt((17.0 - fabs(f - 95.0)) * 0.05882);
+    } else if ((h > 85.0) && (f >= 80.0) && (f <= 87.0)) {
+      hi += ((h - 85.0) * 0.1) * ((87.0 - f) * 0.2);
+    }
+  }
+  return (hi - 32) * 0.55555;
+}
+
+// ==========================================
+// TESTS
+// ==========================================
+
+static void testAccuracy() {
+  double worstDew = 0, worstHumidex = 0, worstHeat = 0;
+
+  for (int16_t t10 = -400; t10 <= 600; t10++) {
+    double t = t10 / 10.0;
+    for (uint16_t h10 = 0; h10 <= 1000; h10++) {
+      double h = h10 / 10.0;
+      int16_t dew10 = dewPoint10(t10, h10);
+      int16_t hx10 = humidex10(t10, dew10);
+      float hi = heatIndexC((float)t, (float)h);
+
+      if (h10 < 10) {
+        // ln(0) has no reference: clamped, and no colder than at 1 %RH
+        CHECK(dew10 == dewPoint10(t10, h10 ? h10 : 1), "%.1f °C %.1f %%: dew point not clamped", t, h);
+        CHECK(dew10 <= dewPoint10(t10, 10), "%.1f °C %.1f %%: dew point above 1 %%RH", t, h);
+        continue;
+      }
+      worstDew = fmax(worstDew, fabs(dew10 / 10.0 - refDewPoint(t, h)));
+      worstHumidex = fmax(worstHumidex, fabs(hx10 / 10.0 - refHumidex(t, h)));
+      worstHeat = fmax(worstHeat, fabs(hi - refHeatIndexC(t, h)));
+    }
+  }
+
+  printf("  max error: dew point %.3f °C, humidex %.2f, heat index %.4f °C\n",
+         worstDew, worstHumidex, worstHeat);
+  CHECK(worstDew <= DEW_POINT_BOUND, "dew point off by %.3f °C", worstDew);
+  CHECK(worstHumidex <= HUMIDEX_BOUND, "humidex off by %.2f", worstHumidex);
+  CHECK(worstHeat < HEAT_INDEX_BOUND, "heat index off by %.4f °C", worstHeat);
+}
+
+/**
+ * @brief Nanoseconds per reading (dew point + humidex + heat index)
+ */
+template <typename F>
+static double timePerCall(F metrics) {
+  volatile double sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  long calls = 0;
+  for (int pass = 0; pass < 4; pass++) {
+    for (int16_t t10 = -400; t10 <= 600; t10 += 3) {
+      for (uint16_t h10 = 10; h10 <= 1000; h10 += 7) {
+        sink = sink + metrics(t10, h10);
+        calls++;
+      }
+    }
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count() / calls;
+}
+
+static void testTiming() {
+  double kernels = timePerCall([](int16_t t10, uint16_t h10) {
+    int16_t dew10 = dewPoint10(t10, h10);
+    return dew10 + humidex10(t10, dew10) + heatIndexC(t10 / 10.0f, h10 / 10.0f);
+  });
+  double reference = timePerCall([](int16_t t10, uint16_t h10) {
+    double t = t10 / 10.0, h = h10 / 10.0;
+    return refDewPoint(t, h) + refHumidex(t, h) + refHeatIndexC(t, h);
+  });
+  printf("  per reading: kernels %.1f ns, float formulas %.1f ns (PC)\n", kernels, reference);
+}
+
+int main() {
+  printf("Comfort kernels:\n");
+  testAccuracy();
+  testTiming();
+
+  printf("comfort: %d failures\n", failures);
+  return failures != 0;
+}
@@ -0,0 +1,289 @@
+/**
+ * @file host_configparser.cpp
+ * @brief Host harness: property and fuzz tests of the config parser
+ *
+ * configparser.cpp is compiled for the PC with AddressSanitizer and
+ * UndefinedBehaviorSanitizer, and given:
+ * - fixed documents, with the expected error and field path
+ * - random valid documents (any subset of fields, any order, whitespace),
+ *   whose delta must hold exactly the fields and values written
+ * - the same documents with one field out of range, which must be named
+ *   along with the offset of its value
+ * - strict prefixes of valid documents, which must be rejected
+ * - random mutations, which must never crash nor accept a value out of
+ *   range
+ * Every body is copied to a buffer of its exact size, so a read past the
+ * end is caught by the sanitizer.
+ *
+ * The first 20000 mutants can be dumped and checked against Python's json
+ * module by configparser_ref.py (differential test):
+ *
+ *   sh tools/host/check.sh
+ *
+ * Build alone (from the repository root):
+ *
+ *   g++ -std=gnu++17 -Wall -Wextra -Werror -g -fsanitize=address,undefined -fno-sanitize-recover=undefined -Itools/host/stubs -Ifirmware/smart-led-clock tools/host/host_configparser.cpp firmware/smart-led-clock/configparser.cpp -o host_configparser
+ *   ./host_configparser [iterations] [dump file]
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#include "configparser.h"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+HardwareSerial Serial;
+
+// ==========================================
+// FIELD TABLE (as documented in configparser.h)
+// ==========================================
+static const char* const paths[CONFIG_FIELD_COUNT] = {"timezoneOffset", "ntpSyncHour", "ntpSyncMinute",
+  "led.hour.r", "led.hour.g", "led.hour.b", "led.minute.r", "led.minute.g", "led.minute.b",
+  "led.second.r", "led.second.g", "led.second.b", "led.brightness", "lcdTimeout"};
+static const long minimum[CONFIG_FIELD_COUNT] = {-12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5000};
+static const long maximum[CONFIG_FIELD_COUNT] = {14, 23, 59, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 300000};
+
+typedef std::vector<std::pair<int, long>> FieldList;
+
+static std::mt19937 rng(12345);
+static int failures = 0;
+
+static int randomInt(int n) { return rng() % n; }
+
+#define CHECK(condition, ...) do { \
+    if (!(condition)) { \
+      if (++failures <= 20) { printf("FAIL line %d: ", __LINE__); printf(__VA_ARGS__); printf("\n"); } \
+    } \
+  } while (0)
+
+// ==========================================
+// DOCUMENTS
+// ==========================================
+
+static std::string whitespace() {
+  static const char* const runs[] = {"", " ", "\n", "\t ", " \r\n"};
+  return randomInt(3) ? "" : runs[randomInt(5)];
+}
+
+static std::string join(std::vector<std::string>& items) {
+  std::shuffle(items.begin(), items.end(), rng);
+  std::string text;
+  for (size_t i = 0; i < items.size(); i++) {
+    if (i) text += ",";
+    text += items[i];
+  }
+  return text;
+}
+
+/**
+ * @brief Nested document holding the given fields, members shuffled
+ */
+static std::string buildDocument(const FieldList& fields) {
+  static const char* const groups[3] = {"hour", "minute", "second"};
+  std::vector<std::string> top, led, colors[3];
+
+  for (const auto& field : fields) {
+    std::string value = whitespace() + std::to_string(field.second) + whitespace();
+    const char* path = paths[field.first];
+    if (strncmp(path, "led.", 4) != 0) {
+      top.push_back(whitespace() + "\"" + path + "\"" + whitespace() + ":" + value);
+    } else if (field.first == CONFIG_BRIGHTNESS) {
+      led.push_back(whitespace() + "\"brightness\":" + value);
+    } else {
+      int group = (field.first - CONFIG_HOUR_R) / 3;
+      colors[group].push_back(whitespace() + "\"" + path[strlen(path) - 1] + "\":" + value);
+    }
+  }
+  for (int group = 0; group < 3; group++) {
+    if (!colors[group].empty() || randomInt(4) == 0) {
+      led.push_back(whitespace() + "\"" + groups[group] + "\":{" + join(colors[group]) + "}");
+    }
+  }
+  if (!led.empty()) top.push_back(whitespace() + "\"led\":" + whitespace() + "{" + join(led) + "}");
+  return whitespace() + "{" + join(top) + "}" + whitespace();
+}
+
+/**
+ * @brief Parse from an exact-size heap copy (over-reads are caught)
+ */
+static bool parse(const std::string& text, ConfigDelta* delta, ConfigParseResult* result) {
+  char* body = (char*)malloc(text.size() ? text.size() : 1);
+  memcpy(body, text.data(), text.size());
+  bool ok = parseConfigJSON(body, text.size(), delta, result);
+  free(body);
+  return ok;
+}
+
+// ==========================================
+// TESTS
+// ==========================================
+
+static void testFixedCases() {
+  static const struct {
+    const char* document;
+    ConfigParseError error;
+    const char* field;
+  } cases[] = {
+    {"{}", CONFIG_PARSE_OK, ""},
+    {"{\"timezoneOffset\":-12}", CONFIG_PARSE_OK, ""},
+    {"", CONFIG_PARSE_SYNTAX, ""},
+    {"[]", CONFIG_PARSE_SYNTAX, ""},
+    {"{\"timezoneOffset\":01}", CONFIG_PARSE_SYNTAX, ""},
+    {"{\"ntpSyncHour\":1,}", CONFIG_PARSE_SYNTAX, ""},
+    {"{\"ntpSyncHour\":1} x", CONFIG_PARSE_SYNTAX, ""},
+    {"{\"ntpSyncHour\" 1}", CONFIG_PARSE_SYNTAX, "ntpSyncHour"},
+    {"{\"ntp\\qHour\":1}", CONFIG_PARSE_SYNTAX, ""},
+    {"{\"led\":{\"hour\":{\"r\":1}}", CONFIG_PARSE_SYNTAX, ""},
+    {"{\"brightnes\":10}", CONFIG_PARSE_UNKNOWN, "brightnes"},
+    {"{\"r\":10}", CONFIG_PARSE_UNKNOWN, "r"},
+    {"{\"led\":{\"r\":10}}", CONFIG_PARSE_UNKNOWN, "led.r"},
+    {"{\"ntp\\u0053yncHour\":1}", CONFIG_PARSE_UNKNOWN, "ntp?yncHour"},
+    {"{\"ntpSync\\/Hour\":1}", CONFIG_PARSE_UNKNOWN, "ntpSync/Hour"},
+    {"{\"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\":1}", CONFIG_PARSE_UNKNOWN, "aaaaaaaaaaaaaaaaaaaaaaa"},
+    {"{\"led\":{\"hour\":{\"r\":null}}}", CONFIG_PARSE_TYPE, "led.hour.r"},
+    {"{\"led\":{\"hour\":5}}", CONFIG_PARSE_TYPE, "led.hour"},
+    {"{\"led\":{\"brightness\":1.5}}", CONFIG_PARSE_TYPE, "led.brightness"},
+    {"{\"lcdTimeout\":\"60000\"}", CONFIG_PARSE_TYPE, "lcdTimeout"},
+    {"{\"led\":{\"hour\":{\"r\":300}}}", CONFIG_PARSE_RANGE, "led.hour.r"},
+    {"{\"led\":{\"minute\":{\"r\":1},\"hour\":{\"r\":-1}}}", CONFIG_PARSE_RANGE, "led.hour.r"},
+    {"{\"timezoneOffset\":-13}", CONFIG_PARSE_RANGE, "timezoneOffset"},
+    {"{\"lcdTimeout\":4999}", CONFIG_PARSE_RANGE, "lcdTimeout"},
+    {"{\"lcdTimeout\":99999999999999999999}", CONFIG_PARSE_RANGE, "lcdTimeout"},
+  };
+  ConfigDelta delta;
+  ConfigParseResult result;
+
+  for (const auto& c : cases) {
+    bool ok = parse(c.document, &delta, &result);
+    CHECK(ok == (c.error == CONFIG_PARSE_OK) && result.error == c.error && strcmp(result.field, c.field) == 0,
+          "%s -> ok=%d error=%d field=%s", c.document, ok, result.error, result.field);
+  }
+}
+
+static void testApply() {
+  const char* all = "{\"timezoneOffset\":2,\"ntpSyncHour\":2,\"ntpSyncMinute\":0,"
+    "\"led\":{\"hour\":{\"r\":0,\"g\":0,\"b\":200},\"minute\":{\"r\":0,\"g\":200,\"b\":0},"
+    "\"second\":{\"r\":200,\"g\":0,\"b\":0},\"brightness\":150},\"lcdTimeout\":60000}";
+  ConfigDelta delta;
+  ConfigParseResult result;
+  ClockConfig config;
+  memset(&config, 0xEE, sizeof(config));
+
+  CHECK(parse(all, &delta, &result), "full document rejected");
+  CHECK(delta.fields == (1 << CONFIG_FIELD_COUNT) - 1, "fields %x", delta.fields);
+  applyConfigDelta(&delta, &config);
+  CHECK(config.timezoneOffset == 2 && config.ntpSyncHour == 2 && config.colorHourR == 0 &&
+        config.colorHourB == 200 && config.colorMinuteG == 200 && config.colorSecondR == 200 &&
+        config.ledBrightness == 150 && config.lcdTimeout == 60000, "values not applied");
+  CHECK(config.magic == 0xEEEE && (uint8_t)config.wifiSSID[0] == 0xEE && config.moonModuleEnabled == 0xEE,
+        "fields outside the delta changed");
+
+  parse("{\"timezoneOffset\":-5}", &delta, &result);
+  applyConfigDelta(&delta, &config);
+  CHECK(config.timezoneOffset == -5 && config.ntpSyncHour == 2, "partial update");
+}
+
+/**
+ * @brief Random documents: properties, then mutations
+ * @return Mutants accepted
+ */
+static int testRandom(int iterations, FILE* dump) {
+  static const char alphabet[] = "{}[]:,\"\\-.eE+0123456789 \ntfnurlax\x01\xff";
+  ConfigDelta delta;
+  ConfigParseResult result;
+  int accepted = 0;
+
+  for (int it = 0; it < iterations; it++) {
+    // Valid subset: the delta holds exactly what was written
+    FieldList fields;
+    long wanted[CONFIG_FIELD_COUNT];
+    bool present[CONFIG_FIELD_COUNT] = {};
+    for (int i = 0; i < CONFIG_FIELD_COUNT; i++) {
+      if (randomInt(2)) {
+        wanted[i] = minimum[i] + randomInt(maximum[i] - minimum[i] + 1);
+        present[i] = true;
+        fields.push_back({i, wanted[i]});
+      }
+    }
+    std::string document = buildDocument(fields);
+    bool ok = parse(document, &delta, &result);
+    CHECK(ok, "valid rejected: %s error=%d field=%s", document.c_str(), result.error, result.field);
+    for (int i = 0; ok && i < CONFIG_FIELD_COUNT; i++) {
+      bool found = (delta.fields >> i) & 1;
+      CHECK(found == present[i] && (!found || delta.values[i] == wanted[i]), "%s: field %d", document.c_str(), i);
+    }
+
+    // One field out of range: named, positioned on its value
+    if (!fields.empty()) {
+      int k = randomInt(fields.size());
+      int i = fields[k].first;
+      fields[k].second = randomInt(2) ? maximum[i] + 1 + randomInt(1000) : minimum[i] - 1 - randomInt(1000);
+      std::string bad = buildDocument(fields);
+      std::string value = std::to_string(fields[k].second);
+      ok = parse(bad, &delta, &result);
+      CHECK(!ok && result.error == CONFIG_PARSE_RANGE && strcmp(result.field, paths[i]) == 0,
+            "%s -> error=%d field=%s", bad.c_str(), result.error, result.field);
+      CHECK(bad.compare(result.position, value.size(), value) == 0, "%s: position %u", bad.c_str(), result.position);
+    }
+
+    // Strict prefix (ignoring trailing whitespace): rejected
+    std::string prefix = document.substr(0, randomInt(document.size()));
+    size_t last = prefix.find_last_not_of(" \t\r\n");
+    if (last != document.find_last_not_of(" \t\r\n")) {
+      CHECK(!parse(prefix, &delta, &result), "prefix accepted: [%s]", prefix.c_str());
+    }
+
+    // Mutants: no crash, nothing out of range accepted
+    std::string mutant = document;
+    int mutations = 1 + randomInt(4);
+    for (int j = 0; j < mutations && !mutant.empty(); j++) {
+      size_t p = randomInt(mutant.size());
+      switch (randomInt(4)) {
+        case 0: mutant[p] = alphabet[randomInt(sizeof(alphabet) - 1)]; break;
+        case 1: mutant.erase(p, 1); break;
+        case 2: mutant.insert(p, 1, alphabet[randomInt(sizeof(alphabet) - 1)]); break;
+        case 3: mutant.resize(p); break;
+      }
+    }
+    ok = parse(mutant, &delta, &result);
+    if (ok) {
+      accepted++;
+      for (int i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        if ((delta.fields >> i) & 1) {
+          CHECK(delta.values[i] >= minimum[i] && delta.values[i] <= maximum[i], "out of range accepted: %s", mutant.c_str());
+        }
+      }
+    } else {
+      CHECK(result.error != CONFIG_PARSE_OK && result.position <= mutant.size() &&
+            strlen(result.field) < CONFIG_MAX_PATH, "inconsistent error for %s", mutant.c_str());
+    }
+
+    // "<ok> <error> <hex bytes>" for configparser_ref.py
+    if (dump != NULL && it < 20000) {
+      fprintf(dump, "%d %d ", ok, result.error);
+      for (unsigned char c : mutant) fprintf(dump, "%02x", c);
+      fprintf(dump, "\n");
+    }
+  }
+  return accepted;
+}
+
+int main(int argc, char** argv) {
+  int iterations = argc > 1 ? atoi(argv[1]) : 200000;
+  FILE* dump = argc > 2 ? fopen(argv[2], "w") : NULL;
+
+  testFixedCases();
+  testApply();
+  int accepted = testRandom(iterations, dump);
+  if (dump != NULL) fclose(dump);
+
+  printf("configparser: %d iterations, %d mutants accepted, %d failures\n", iterations, accepted, failures);
+  return failures != 0;
+}
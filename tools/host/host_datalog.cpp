@@ -0,0 +1,289 @@
+/**
+ * @file host_datalog.cpp
+ * @brief Host harness: MQTT buffer uploads and live messages
+ *
+ * datalog.cpp is compiled for the PC, logs a WiFi outage (noisy readings,
+ * sensors dropping out, an RTC jump that forces a keyframe) through
+ * logDataPoint(), then drains it with sendBufferToMQTT() into a fake MQTT
+ * client. The deadband is then checked on live logging: a one-reading
+ * spike must not log a point, a step must, and the heartbeat must be
+ * counted once per heartbeat point.
+ *
+ * Built with MQTT_BUFFER_BINARY, the payloads published on
+ * MQTT_TOPIC_BUFFER_BIN are written to one file, and the logged points
+ * to another, one JSON object per line as decode_buffer.py prints them:
+ *
+ *   host_datalog payloads.bin expected.txt
+ *   python3 tools/decode_buffer.py payloads.bin | diff expected.txt -
+ *
+ * Built without, the first file gets every streamed message (JSON buffer
+ * chunks, live messages of the points logged online), each after its
+ * topic, to be diffed against golden/mqtt_json.txt. sh tools/host/check.sh
+ * runs both builds.
+ *
+ * Build alone (from the repository root):
+ *
+ *   g++ -std=gnu++17 -Wall -Wextra -Werror -DMQTT_BUFFER_BINARY=true -Itools/host/stubs -Ifirmware/smart-led-clock tools/host/host_datalog.cpp firmware/smart-led-clock/{datalog,tsring,history,rollup,sensors,comfort,mq135,filter}.cpp -o host_datalog
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#include "datalog.h"
+#include "storage.h"
+#include <random>
+#include <string>
+
+#define OUTAGE_POINTS   400       ///< Points logged while WiFi is down
+
+// ==========================================
+// BOARD
+// ==========================================
+static unsigned long fakeMillis = 100000;
+
+unsigned long millis() { return fakeMillis; }
+unsigned long micros() { return fakeMillis * 1000; }
+void delay(unsigned long ms) { fakeMillis += ms; }
+void pinMode(uint8_t, uint8_t) {}
+int analogRead(uint8_t) { return 0; }
+void analogReadResolution(int) {}
+HardwareSerial Serial;
+EEPROMClass EEPROM;
+
+// ==========================================
+// FAKE MQTT CLIENT
+// ==========================================
+static bool brokerUp = false;
+static std::string published;       // Payload being streamed
+static std::string publishedTopic;
+static std::string messages;        // Streamed payloads, each after "== <topic>"
+static std::string payloads;        // Binary chunks, concatenated
+static unsigned int expectedLength = 0;
+static uint16_t chunks = 0;
+
+void PubSubClient::setClient(Client&) {}
+void PubSubClient::setServer(const char*, uint16_t) {}
+bool PubSubClient::setBufferSize(uint16_t) { return true; }
+void PubSubClient::setSocketTimeout(uint16_t) {}
+void PubSubClient::setKeepAlive(uint16_t) {}
+bool PubSubClient::connect(const char*, const char*, const char*) { return brokerUp; }
+bool PubSubClient::connected() { return brokerUp; }
+int PubSubClient::state() { return brokerUp ? 0 : -2; }
+bool PubSubClient::loop() { return brokerUp; }
+bool PubSubClient::publish(const char*, const char*) { return brokerUp; }
+bool PubSubClient::publish(const char*, const char*, bool) { return brokerUp; }
+
+bool PubSubClient::publish(const char* topic, const uint8_t* payload, unsigned int length) {
+  if (!brokerUp) return false;
+  if (strcmp(topic, MQTT_TOPIC_BUFFER_BIN) == 0) {
+    payloads.append((const char*)payload, length);
+    chunks++;
+  }
+  return true;
+}
+
+bool PubSubClient::beginPublish(const char* topic, unsigned int length, bool) {
+  published.clear();
+  publishedTopic = topic;
+  expectedLength = length;
+  return brokerUp;
+}
+
+int PubSubClient::endPublish() {
+  if (published.size() != expectedLength) return 0;
+  messages += "== " + publishedTopic + "\n" + published + "\n";
+  return 1;
+}
+
+size_t PubSubClient::write(uint8_t b) {
+  published += (char)b;
+  return 1;
+}
+
+size_t PubSubClient::write(const uint8_t* buffer, size_t size) {
+  published.append((const char*)buffer, size);
+  return size;
+}
+
+WiFiClient::WiFiClient() {}
+int WiFiClient::connect(IPAddress, uint16_t) { return 0; }
+int WiFiClient::connect(const char*, uint16_t) { return 0; }
+uint8_t WiFiClient::connected() { return 0; }
+void WiFiClient::stop() {}
+WiFiClient::operator bool() { return false; }
+int WiFiClient::read(uint8_t*, size_t) { return 0; }
+int WiFiClient::read() { return -1; }
+int WiFiClient::available() { return 0; }
+int WiFiClient::peek() { return -1; }
+size_t WiFiClient::write(uint8_t) { return 1; }
+size_t WiFiClient::write(const uint8_t*, size_t size) { return size; }
+bool WiFiClient::operator==(const WiFiClient&) const { return true; }
+
+// ==========================================
+// MODULE STUBS
+// ==========================================
+static uint32_t clockTime = 1760000000;
+
+const char* mqttServer = "192.0.2.1";
+const char* mqttPort = "1883";
+const char* mqttClientId = "host";
+const char* mqttUsername = "host";
+const char* mqttPassword = "host";
+bool mqttBusy = false;
+WiFiClient mqttWifiClient;
+SensorData indoorData = {0, 0, 0, 0, 0, false, 0, 0, 0};
+SensorData outdoorData = {0, 0, 0, 0, 0, false, 0, 0, 0};
+AirQualityData airQuality = {0, 0, 0, 0, "Unknown", false, 0};
+RTC_DS3231 rtc;
+int lastAirQualityValue = -1;
+
+DateTime getCurrentTime() { return DateTime(clockTime); }
+bool wifiConnected() { return brokerUp; }
+bool loadMQ135Baseline(MQ135Baseline*) { return false; }
+bool saveMQ135Baseline(const MQ135Baseline*) { return true; }
+bool loadHistoryCursor(HistoryCursor*) { return false; }
+bool saveHistoryCursor(const HistoryCursor*) { return true; }
+void updateAirQualityLEDs() {}
+
+static int failures = 0;
+
+#define CHECK(condition, ...) do { \
+    if (!(condition)) { \
+      if (++failures <= 20) { printf("FAIL line %d: ", __LINE__); printf(__VA_ARGS__); printf("\n"); } \
+    } \
+  } while (0)
+
+// ==========================================
+// SCENARIO
+// ==========================================
+
+/**
+ * @brief Log a WiFi outage, return the points as decode_buffer.py prints them
+ */
+static std::string logOutage() {
+  std::mt19937 rng(34);
+  int16_t base[SENSOR_CHANNEL_COUNT] = {215, 452, -33, 780, 43, 230};
+  std::string expected;
+  char value[12];
+
+  for (uint16_t i = 0; i < OUTAGE_POINTS; i++) {
+    clockTime += (i == 150) ? TSRING_MAX_DOD + 1000 : 300 + rng() % 3;
+    fakeMillis += DATALOG_INTERVAL_WIFI_DOWN;
+
+    for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+      base[ch] += (int16_t)(rng() % 41) - 20;
+      sensorChannels[ch].value = base[ch];
+      // Outdoor sensor drops out for a while, the RTC now and then
+      sensorChannels[ch].valid = !((ch == CH_TEMP_OUTDOOR || ch == CH_HUM_OUTDOOR) && i >= 60 && i < 90) &&
+                                 !(ch == CH_TEMP_RTC && rng() % 10 == 0);
+    }
+    CHECK(logDataPoint(), "point %u not logged", i);
+
+    expected += "{\"ts\":" + std::to_string(clockTime);
+    for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+      formatChannelValue(ch, sensorChannels[ch].valid ? sensorChannels[ch].value : SENSOR_VALUE_INVALID,
+                         value, sizeof(value));
+      expected += std::string(",\"") + sensorChannels[ch].key + "\":" + value;
+    }
+    expected += "}\n";
+  }
+  return expected;
+}
+
+/**
+ * @brief One reading of every channel (tIn as given, others steady)
+ */
+static void feedReading(int16_t tIn) {
+  fakeMillis += 30000;
+  clockTime += 30;
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+    sensorChannels[ch].value = (ch == CH_TEMP_INDOOR) ? tIn : 100;
+    sensorChannels[ch].valid = true;
+    sensorChannels[ch].lastUpdate++;
+  }
+  handleDataLog();
+}
+
+/**
+ * @brief One log interval of DATALOG_INTERVAL_WIFI_OK, a reading every 30 s
+ * @param spike Added to tIn for the second reading only
+ */
+static void logInterval(int16_t tIn, int16_t spike) {
+  for (uint8_t r = 0; r < DATALOG_INTERVAL_WIFI_OK / 30000; r++) {
+    feedReading(tIn + (r == 1 ? spike : 0));
+  }
+}
+
+/**
+ * @brief Deadband on interval means, heartbeat counted per logged point
+ */
+static void testDeadband() {
+  feedReading(200);                     // First check: differs from the outage, logged
+  logInterval(200, 0);
+  DataLogStats before = getLogStats();
+
+  logInterval(200, 6);                  // One reading +0.6 °C: mean +0.15 °C
+  CHECK(getLogStats().totalLogged == before.totalLogged, "spike within the deadband logged");
+
+  logInterval(205, 0);                  // Step of +0.5 °C
+  CHECK(getLogStats().totalLogged == before.totalLogged + 1, "step beyond the deadband not logged");
+
+  // The step point stored the mean of the three intervals (20.2 °C): the
+  // next interval (20.5 °C) logs again, then nothing until the heartbeat
+  logInterval(205, 0);
+  CHECK(getLogStats().totalLogged == before.totalLogged + 2, "point after the step not logged");
+  for (uint8_t i = 0; i < DATALOG_HEARTBEAT_INTERVAL / DATALOG_INTERVAL_WIFI_OK; i++) {
+    logInterval(205, 0);
+  }
+  DataLogStats after = getLogStats();
+  CHECK(after.totalLogged == before.totalLogged + 3, "%lu points over a heartbeat interval",
+        (unsigned long)(after.totalLogged - before.totalLogged - 2));
+  CHECK(after.heartbeatLogged == before.heartbeatLogged + 1, "%lu heartbeat points counted",
+        (unsigned long)(after.heartbeatLogged - before.heartbeatLogged));
+}
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    printf("Usage: host_datalog <payload file> <expected file>\n");
+    return 2;
+  }
+
+  initDataLog(mqttWifiClient);
+  indoorData = {21.45f, 45.2f, 21.3f, 8.96f, 24, true, 0, 21.5f, 45.0f};
+  outdoorData = {-3.25f, 78.0f, -5.1f, -6.07f, 0, true, 0, -3.3f, 77.9f};
+  airQuality = {8123, 8000, 412, 43, "Bon", true, 0};
+  std::string expected = logOutage();
+  CHECK(tsRingCount(&logRing) == OUTAGE_POINTS, "%u points buffered", tsRingCount(&logRing));
+
+  // Broker back: drain one chunk per call
+  brokerUp = true;
+  size_t previous = 0;
+  for (uint16_t i = 0; tsRingCount(&logRing) > 0 && i < OUTAGE_POINTS; i++) {
+    CHECK(sendBufferToMQTT(), "chunk %u not sent", i);
+    CHECK(payloads.size() - previous <= MQTT_BINARY_CHUNK_BYTES, "chunk %u: %zu bytes", chunks,
+          payloads.size() - previous);
+    previous = payloads.size();
+  }
+  CHECK(getLogStats().totalSent == OUTAGE_POINTS, "%lu points sent", (unsigned long)getLogStats().totalSent);
+  testDeadband();
+
+  FILE* file = fopen(argv[1], "wb");
+  FILE* text = fopen(argv[2], "w");
+  CHECK(file && text, "cannot write the output files");
+  const std::string& output = MQTT_BUFFER_BINARY ? payloads : messages;
+  if (file) fwrite(output.data(), 1, output.size(), file);
+  if (text) fputs(expected.c_str(), text);
+  if (file) fclose(file);
+  if (text) fclose(text);
+
+  if (MQTT_BUFFER_BINARY) {
+    printf("datalog: %u points in %u binary chunks, %zu bytes (%.1f bytes/point)\n", OUTAGE_POINTS, chunks,
+           payloads.size(), (double)payloads.size() / OUTAGE_POINTS);
+  }
+  printf("datalog: %d failures\n", failures);
+  return failures != 0;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file host_mq135.cpp
+ * @brief Host harness: MQ135 curve lookup and baseline warm-up
+ *
+ * mq135.cpp is compiled for the PC and checked:
+ * - mq135RatioToPPM() at the datasheet CO2 points (Fig. 2, read off the
+ *   log-log plot) and at the clean-air ratio, within REFERENCE_TOLERANCE
+ *   (+ 1 ppm: the table holds integers)
+ * - the shipped Q12 table against the power-law fit it was generated
+ *   from (tools/gen_mq135_table.py): 0.5 % + 1 ppm over the whole range,
+ *   decreasing, clamped at both ends
+ * - mq135PPMToIndex() at its breakpoints
+ * - the warm-up: no learning for MQ135_WARMUP_MS after initMQ135(), and
+ *   no pause once it is over, when millis() wraps (long is 64-bit on the
+ *   PC: the wrap is played by millis() going back to a small value)
+ *
+ *   sh tools/host/check.sh
+ *
+ * Build alone (from the repository root):
+ *
+ *   g++ -std=gnu++17 -Wall -Wextra -Werror -Itools/host/stubs -Ifirmware/smart-led-clock tools/host/host_mq135.cpp firmware/smart-led-clock/mq135.cpp -o host_mq135
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#include "mq135.h"
+#include "storage.h"
+
+#define REFERENCE_TOLERANCE   0.05      ///< Datasheet points are read off a log-log plot
+#define FIT_TOLERANCE         0.005     ///< Table vs power law (plus 1 ppm: integer knots)
+#define FIT_A                 116.6020682
+#define FIT_B                 -2.769034857
+
+// ==========================================
+// BOARD
+// ==========================================
+static unsigned long fakeMillis = 0;
+
+unsigned long millis() { return fakeMillis; }
+int analogRead(uint8_t) { return 0; }
+void analogReadResolution(int) {}
+HardwareSerial Serial;
+
+bool loadMQ135Baseline(MQ135Baseline*) { return false; }
+bool saveMQ135Baseline(const MQ135Baseline*) { return true; }
+
+static int failures = 0;
+
+#define CHECK(condition, ...) do { \
+    if (!(condition)) { \
+      if (++failures <= 20) { printf("FAIL line %d: ", __LINE__); printf(__VA_ARGS__); printf("\n"); } \
+    } \
+  } while (0)
+
+// ==========================================
+// TESTS
+// ==========================================
+
+static void testDatasheetPoints() {
+  static const struct { float ratio; float ppm; } points[] = {
+    {2.40f, 10}, {1.06f, 100}, {MQ135_CLEAN_AIR_RATIO, 400}, {0.46f, 1000}, {0.36f, 2000},
+  };
+  for (const auto& point : points) {
+    uint16_t ppm = mq135RatioToPPM(point.ratio);
+    double error = fmax(fabs(ppm - point.ppm) - 1.0, 0.0) / point.ppm;
+    printf("  Rs/R0 %.4f -> %5u ppm (datasheet %5.0f, %+.1f %%)\n", point.ratio, ppm, point.ppm,
+           100.0 * (ppm - point.ppm) / point.ppm);
+    CHECK(error <= REFERENCE_TOLERANCE, "ratio %.4f: %u ppm, datasheet %.0f", point.ratio, ppm, point.ppm);
+  }
+}
+
+static void testTable() {
+  double worst = 0;
+  uint16_t previous = UINT16_MAX;
+
+  for (float ratio = 0.15f; ratio <= 2.50f; ratio += 0.0005f) {
+    uint16_t ppm = mq135RatioToPPM(ratio);
+    double exact = FIT_A * pow(lroundf(ratio * 4096) / 4096.0, FIT_B);
+    double error = fmax(fabs(ppm - exact) - 1.0, 0.0) / exact;
+    if (error > worst) worst = error;
+    CHECK(ppm <= previous, "not decreasing at ratio %.4f", ratio);
+    previous = ppm;
+  }
+  printf("  table vs fit: max error %.2f %% + 1 ppm\n", 100.0 * worst);
+  CHECK(worst <= FIT_TOLERANCE, "table off the fit by %.2f %%", 100.0 * worst);
+
+  CHECK(mq135RatioToPPM(0.01f) == mq135RatioToPPM(0.15f), "low end not clamped");
+  CHECK(mq135RatioToPPM(10.0f) == mq135RatioToPPM(2.50f), "high end not clamped");
+}
+
+static void testIndex() {
+  static const uint16_t ppm[] = {0, 400, 500, 600, 1000, 1500, 2000, 5000, 10000, 60000};
+  static const uint16_t index[] = {0, 0, 25, 50, 100, 150, 200, 300, 500, 500};
+  for (size_t i = 0; i < sizeof(ppm) / sizeof(ppm[0]); i++) {
+    CHECK(mq135PPMToIndex(ppm[i]) == index[i], "%u ppm -> index %u, expected %u", ppm[i], mq135PPMToIndex(ppm[i]), index[i]);
+  }
+}
+
+/**
+ * @brief Learning starts MQ135_WARMUP_MS after init, and never pauses again
+ */
+static void testWarmup() {
+  fakeMillis = 0;
+  initMQ135();
+
+  fakeMillis = MQ135_WARMUP_MS - 1;
+  mq135LearnBaseline(50.0f);
+  CHECK(getMQ135State().windowMaxRs == 0, "learning during warm-up");
+
+  fakeMillis = MQ135_WARMUP_MS;
+  mq135LearnBaseline(50.0f);
+  CHECK(getMQ135State().windowMaxRs == 50.0f, "no learning after warm-up");
+
+  // 49.7 days later millis() wraps: below MQ135_WARMUP_MS again
+  fakeMillis = 1000;
+  mq135LearnBaseline(60.0f);
+  CHECK(getMQ135State().windowMaxRs == 60.0f, "learning paused after millis() wrapped");
+}
+
+int main() {
+  printf("MQ135 curve:\n");
+  testDatasheetPoints();
+  testTable();
+  testIndex();
+  testWarmup();
+
+  printf("mq135: %d failures\n", failures);
+  return failures != 0;
+}
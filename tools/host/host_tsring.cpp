@@ -0,0 +1,215 @@
+/**
+ * @file host_tsring.cpp
+ * @brief Host harness: round trip of the compressed data log ring
+ *
+ * tsring.cpp is compiled for the PC. Simulated series are appended with
+ * tsRingAppend() and read back with tsRingSeek() / tsRingNext() and
+ * tsRingRead(); every readable point must come back bit for bit, in order,
+ * and the points lost to eviction must be exactly the oldest ones. The
+ * series cover a steady 5 min log, noisy values with jittered intervals,
+ * channels dropping out and coming back (validity mask changes), clock
+ * jumps beyond TSRING_MAX_DOD and full int16 swings. Bytes per point and
+ * encode / decode throughput are printed (PC figures, for comparison
+ * only):
+ *
+ *   sh tools/host/check.sh
+ *
+ * Build alone (from the repository root):
+ *
+ *   g++ -std=gnu++17 -Wall -Wextra -Werror -O2 -Itools/host/stubs -Ifirmware/smart-led-clock tools/host/host_tsring.cpp firmware/smart-led-clock/tsring.cpp -o host_tsring
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#include "tsring.h"
+#include <chrono>
+#include <random>
+#include <vector>
+
+#define SERIES_POINTS   20000     ///< Points appended per series (several ring turns)
+
+static int failures = 0;
+
+#define CHECK(condition, ...) do { \
+    if (!(condition)) { \
+      if (++failures <= 20) { printf("FAIL line %d: ", __LINE__); printf(__VA_ARGS__); printf("\n"); } \
+    } \
+  } while (0)
+
+static TsRing ring;
+
+// ==========================================
+// SERIES
+// ==========================================
+
+enum Series { SERIES_STEADY, SERIES_NOISY, SERIES_DROPOUTS, SERIES_JUMPS, SERIES_EXTREMES };
+
+static const char* const SERIES_NAMES[] = {"steady", "noisy", "dropouts", "clock jumps", "extremes"};
+
+/**
+ * @brief A simulated log: timestamps never go backwards
+ */
+static std::vector<DataPoint> makeSeries(Series series) {
+  std::mt19937 rng(1234 + series);
+  std::vector<DataPoint> points(SERIES_POINTS);
+  uint32_t t = 1760000000;
+  int16_t base[SENSOR_CHANNEL_COUNT] = {215, 452, -33, 780, 43, 230};
+
+  for (uint32_t i = 0; i < SERIES_POINTS; i++) {
+    DataPoint& p = points[i];
+    switch (series) {
+      case SERIES_STEADY:
+        t += 300;
+        for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+          base[ch] += (int16_t)(rng() % 3) - 1;
+          p.values[ch] = base[ch];
+        }
+        break;
+      case SERIES_NOISY:
+        t += 240 + rng() % 120;
+        for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+          base[ch] += (int16_t)(rng() % 601) - 300;
+          p.values[ch] = base[ch];
+        }
+        break;
+      case SERIES_DROPOUTS:
+        t += 300;
+        for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+          base[ch] += (int16_t)(rng() % 21) - 10;
+          p.values[ch] = (rng() % 8 == 0) ? SENSOR_VALUE_INVALID : base[ch];
+        }
+        break;
+      case SERIES_JUMPS:
+        // RTC from its 2000 default, set forward by more than TSRING_MAX_DOD
+        // five times while the last ring turn is being written
+        t = (i == 0) ? 946684800UL : t + 300;
+        if (i % 200 == 100 && i > SERIES_POINTS - 1000) t += TSRING_MAX_DOD + 301;
+        for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+          p.values[ch] = base[ch] + (int16_t)(rng() % 5);
+        }
+        break;
+      case SERIES_EXTREMES:
+        t += rng() % 2 ? 0 : 1;
+        for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+          uint32_t pick = rng() % 4;
+          p.values[ch] = pick == 0 ? INT16_MAX : pick == 1 ? (int16_t)(SENSOR_VALUE_INVALID + 1)
+                       : pick == 2 ? SENSOR_VALUE_INVALID : (int16_t)rng();
+        }
+        break;
+    }
+    p.timestamp = t;
+  }
+  return points;
+}
+
+static bool samePoint(const DataPoint& a, const DataPoint& b) {
+  return a.timestamp == b.timestamp && memcmp(a.values, b.values, sizeof(a.values)) == 0;
+}
+
+// ==========================================
+// TESTS
+// ==========================================
+
+/**
+ * @brief Append a series, then read every readable point back
+ */
+static void testRoundTrip(Series series) {
+  std::vector<DataPoint> points = makeSeries(series);
+  memset(&ring, 0, sizeof(ring));
+  tsRingClear(&ring);
+
+  auto start = std::chrono::steady_clock::now();
+  uint32_t jumps = 0;
+  int64_t delta = 0;
+  for (size_t i = 0; i < points.size(); i++) {
+    bool started = tsRingAppend(&ring, &points[i]);
+    if (i == 0) continue;
+    int64_t next = (int64_t)points[i].timestamp - points[i - 1].timestamp;
+    if (next - delta > TSRING_MAX_DOD || next - delta < -TSRING_MAX_DOD) {
+      CHECK(started, "%s: point %zu jumps by %lld s in the same block", SERIES_NAMES[series], i, (long long)next);
+      jumps++;
+      next = 0;   // delta restarts from the new keyframe
+    }
+    delta = next;
+  }
+  std::chrono::duration<double, std::nano> encode = std::chrono::steady_clock::now() - start;
+  CHECK(series != SERIES_JUMPS || jumps == 5, "%s: %u jumps", SERIES_NAMES[series], jumps);
+
+  uint16_t count = tsRingCount(&ring);
+  CHECK(count > 0 && count + ring.evicted == points.size(),
+        "%s: %u readable + %lu evicted != %zu appended", SERIES_NAMES[series], count,
+        (unsigned long)ring.evicted, points.size());
+  size_t oldest = points.size() - count;
+
+  // Sequential
+  TsCursor cursor;
+  DataPoint p;
+  uint32_t mismatches = 0;
+  start = std::chrono::steady_clock::now();
+  CHECK(tsRingSeek(&ring, &cursor, 0), "%s: seek 0 failed", SERIES_NAMES[series]);
+  for (uint16_t i = 0; i < count; i++) {
+    if (!tsRingNext(&ring, &cursor, &p) || !samePoint(p, points[oldest + i])) mismatches++;
+  }
+  std::chrono::duration<double, std::nano> decode = std::chrono::steady_clock::now() - start;
+  CHECK(!tsRingNext(&ring, &cursor, &p), "%s: read past the newest point", SERIES_NAMES[series]);
+  CHECK(mismatches == 0, "%s: %u points differ", SERIES_NAMES[series], mismatches);
+
+  // Random access
+  mismatches = 0;
+  for (uint16_t i = 0; i < count; i += 37) {
+    if (!tsRingRead(&ring, i, &p) || !samePoint(p, points[oldest + i])) mismatches++;
+  }
+  CHECK(mismatches == 0, "%s: %u random reads differ", SERIES_NAMES[series], mismatches);
+  CHECK(!tsRingRead(&ring, count, &p), "%s: read out of range", SERIES_NAMES[series]);
+
+  // Consuming keeps the remaining points intact
+  uint16_t consumed = count / 3;
+  tsRingConsume(&ring, consumed);
+  mismatches = 0;
+  CHECK(tsRingCount(&ring) == count - consumed, "%s: consume count", SERIES_NAMES[series]);
+  for (uint16_t i = 0; tsRingRead(&ring, i, &p); i += 11) {
+    if (!samePoint(p, points[oldest + consumed + i])) mismatches++;
+  }
+  CHECK(mismatches == 0, "%s: %u points differ after consume", SERIES_NAMES[series], mismatches);
+
+  printf("  %-12s %5u points %5.2f bytes/point  encode %5.1f ns/point  decode %5.1f ns/point\n",
+         SERIES_NAMES[series], count, (double)tsRingBytesUsed(&ring) / (tsRingCount(&ring) + ring.skip),
+         encode.count() / points.size(), decode.count() / count);
+}
+
+/**
+ * @brief Codec alone: a jump beyond TSRING_MAX_DOD is refused, state untouched
+ */
+static void testCodecLimit() {
+  DataPoint key = {1000, {1, 2, 3, 4, 5, 6}};
+  DataPoint next = key;
+  TsCodecState state;
+  uint8_t record[TSRING_MAX_RECORD];
+
+  tsCodecStart(&state, &key);
+  next.timestamp = key.timestamp + TSRING_MAX_DOD;
+  CHECK(tsCodecEncode(&state, &next, record) > 0, "largest delta-of-delta refused");
+
+  tsCodecStart(&state, &key);
+  next.timestamp = key.timestamp + TSRING_MAX_DOD + 1;
+  CHECK(tsCodecEncode(&state, &next, record) == 0, "delta-of-delta beyond the limit encoded");
+  CHECK(state.timestamp == key.timestamp, "state moved on a refused point");
+
+  for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) next.values[ch] = ch % 2 ? INT16_MAX : INT16_MIN + 1;
+  next.timestamp = key.timestamp;
+  CHECK(tsCodecEncode(&state, &next, record) <= TSRING_MAX_RECORD, "record above TSRING_MAX_RECORD");
+}
+
+int main() {
+  printf("Time-series ring (%u blocks of %u bytes):\n", TSRING_BLOCKS, TSRING_BLOCK_SIZE);
+  testCodecLimit();
+  for (int s = SERIES_STEADY; s <= SERIES_EXTREMES; s++) testRoundTrip((Series)s);
+
+  printf("tsring: %d failures\n", failures);
+  return failures != 0;
+}
@@ -0,0 +1,285 @@
+/**
+ * @file host_web.cpp
+ * @brief Host harness: JSON responses of the web server, for golden files
+ *
+ * webserver.cpp, sensors.cpp and rollup.cpp are compiled for the PC with
+ * the stand-ins of stubs/, and served requests through a fake client.
+ * The clock, moon, logger and configuration are fixed stubs set to three
+ * states; the rollups are fed a simulated day of readings. Every JSON
+ * route is printed (headers and body), so that a serializer change can be
+ * diffed byte for byte against golden/web_json.txt:
+ *
+ *   sh tools/host/check.sh
+ *
+ * Build alone (from the repository root):
+ *
+ *   g++ -std=gnu++17 -Wall -Wextra -Werror -Itools/host/stubs -Ifirmware/smart-led-clock tools/host/host_web.cpp firmware/smart-led-clock/{webserver,httpparser,sensors,comfort,mq135,filter,rollup,configparser}.cpp -o host_web
+ *
+ * @author F. Baillon
+ * @version 1.2.0
+ * @date October 2026
+ * @license MIT License
+ *
+ * Copyright (c) 2025 F. Baillon
+ */
+
+#include "webserver.h"
+#include "sensors.h"
+#include <string>
+
+// ==========================================
+// BOARD
+// ==========================================
+static unsigned long fakeMillis = 100000;
+static unsigned long fakeMicros = 0;
+
+unsigned long millis() { return fakeMillis; }
+unsigned long micros() { return fakeMicros += 7; }
+void delay(unsigned long ms) { fakeMillis += ms; }
+void pinMode(uint8_t, uint8_t) {}
+HardwareSerial Serial;
+
+// ==========================================
+// FAKE CLIENT (one connection at a time)
+// ==========================================
+static std::string inbox;
+static std::string outbox;
+static bool clientOpen = false;
+static bool clientPending = false;
+static bool acceptedNow = false;
+
+WiFiClient::WiFiClient() {}
+int WiFiClient::connect(IPAddress, uint16_t) { return 0; }
+int WiFiClient::connect(const char*, uint16_t) { return 0; }
+uint8_t WiFiClient::connected() { return clientOpen; }
+void WiFiClient::stop() { clientOpen = false; }
+WiFiClient::operator bool() { bool accepted = acceptedNow; acceptedNow = false; return accepted; }
+int WiFiClient::available() { return inbox.size(); }
+int WiFiClient::read() { return -1; }
+int WiFiClient::peek() { return -1; }
+bool WiFiClient::operator==(const WiFiClient&) const { return true; }
+
+int WiFiClient::read(uint8_t* buffer, size_t size) {
+  size = std::min(size, inbox.size());
+  memcpy(buffer, inbox.data(), size);
+  inbox.erase(0, size);
+  return size;
+}
+
+size_t WiFiClient::write(uint8_t b) {
+  outbox += (char)b;
+  return 1;
+}
+
+size_t WiFiClient::write(const uint8_t* buffer, size_t size) {
+  outbox.append((const char*)buffer, size);
+  return size;
+}
+
+WiFiServer::WiFiServer(int) {}
+void WiFiServer::begin() {}
+
+WiFiClient WiFiServer::accept() {
+  acceptedNow = clientPending;
+  if (clientPending) {
+    clientPending = false;
+    clientOpen = true;
+  }
+  return WiFiClient();
+}
+
+// ==========================================
+// MODULE STUBS
+// ==========================================
+static uint32_t clockTime = 1760000000;
+static MoonPhaseData moon;
+static DataLogStats logStatsStub = {12, 480, 300, 3, 340, 328, 71, 9, 99000, 98000, 250, true};
+static HistoryStats historyStub = {55, 4096, 300, 2, 7, 0, 12, 400};
+static ClockConfig config;
+
+SensorData indoorData = {0, 0, 0, 0, 0, false, 0, 0, 0};
+SensorData outdoorData = {0, 0, 0, 0, 0, false, 0, 0, 0};
+AirQualityData airQuality = {0, 0, 0, 0, "Unknown", false, 0};
+RTC_DS3231 rtc;
+int lastAirQualityValue = -1;
+
+DateTime getCurrentTime() { return DateTime(clockTime); }
+MoonPhaseData& getMoonData() { return moon; }
+float daysSinceLastCalibration(unsigned long epoch) { return (epoch - moon.lastCalib) / 86400.0f; }
+bool updateMoonPosition(unsigned long) { return true; }
+int analogRead(uint8_t) { return 0; }
+void analogReadResolution(int) {}
+bool loadMQ135Baseline(MQ135Baseline*) { return false; }
+bool saveMQ135Baseline(const MQ135Baseline*) { return true; }
+void updateAirQualityLEDs() {}
+DataLogStats getLogStats() { return logStatsStub; }
+HistoryStats getHistoryStats() { return historyStub; }
+void printHistoryJSON(Print& out, const HistoryQuery*) { out.print("[]"); }
+void printHistoryBinary(Print&, const HistoryQuery*) {}
+void getCurrentConfig(ClockConfig* out) { *out = config; }
+bool saveConfig(const ClockConfig* in) { config = *in; return true; }
+void applyConfig(const ClockConfig*) {}
+
+const char* getMoonPhaseName(uint8_t phase) {
+  static const char* const names[] = {"Nouvelle Lune", "Premier Croissant", "Premier Quartier",
+    "Gibbeuse Croissante", "Pleine Lune", "Gibbeuse D\xc3\xa9" "croissante", "Dernier Quartier",
+    "Dernier Croissant"};
+  return names[phase & 7];
+}
+
+MoonCalibrationResult calibrateMoonHome() {
+  MoonCalibrationResult result = {true, 1234, 987, 960, 27, 118000UL};
+  return result;
+}
+
+uint16_t startJob(JobType) { return 0; }
+const Job* findJob(uint16_t) { return NULL; }
+void printJobJSON(Print& out, const Job*) { out.print("{}"); }
+void printJobsJSON(Print& out) { out.print("[]"); }
+
+// ==========================================
+// SCENARIO
+// ==========================================
+
+static std::string request(const char* text) {
+  outbox.clear();
+  inbox = text;
+  for (int i = 0; i < 3; i++) handleWebServer();
+  return outbox;
+}
+
+static void show(const char* path) {
+  char text[128];
+  snprintf(text, sizeof(text), "GET %s HTTP/1.1\r\n\r\n", path);
+  printf("== %s\n%s\n", path, request(text).c_str());
+}
+
+/**
+ * @brief Print a raw request's answer, and whether the server closed the connection
+ */
+static void showRaw(const char* label, const char* text) {
+  std::string answer = request(text);
+  printf("== %s\n%s\n%s", label, answer.c_str(), clientOpen ? "" : "[connection closed]\n");
+  if (!clientOpen) clientPending = true;
+}
+
+/**
+ * @brief Revalidate a document with an If-None-Match value
+ */
+static void showRevalidation(const char* path, const std::string& ifNoneMatch) {
+  std::string text = std::string("GET ") + path + " HTTP/1.1\r\nIf-None-Match: " + ifNoneMatch + "\r\n\r\n";
+  printf("== %s If-None-Match: %s\n%s\n", path, ifNoneMatch.c_str(), request(text.c_str()).c_str());
+}
+
+/**
+ * @brief 304 for a listed, weak or wildcard tag; 200 for a near miss
+ */
+static void testRevalidation() {
+  std::string answer = request("GET /api/snapshot HTTP/1.1\r\n\r\n");
+  size_t at = answer.find("ETag: ") + 6;
+  std::string etag = answer.substr(at, answer.find("\r\n", at) - at);
+  std::string cut = etag.substr(0, etag.size() - 2) + "\"";
+
+  showRevalidation("/api/snapshot", etag);
+  showRevalidation("/api/snapshot", "\"0-0\", W/" + etag + " ");
+  showRevalidation("/api/snapshot", "\"x" + etag + "\", " + cut);
+  showRevalidation("/style.css", "*");
+}
+
+static void setState(int k) {
+  memset(&config, 0, sizeof(config));
+  config.timezoneOffset = k ? -5 : 1;
+  config.ntpSyncHour = 3;
+  config.ntpSyncMinute = 30;
+  config.colorHourR = 255;
+  config.colorMinuteG = 128;
+  config.colorSecondB = 7;
+  config.ledBrightness = 80;
+  config.lcdTimeout = 30000 + k;
+
+  indoorData = {21.45f + k, 45.2f, 21.61f, 44.96f, 0, k != 2, 0, 0, 0};
+  outdoorData = {-3.25f * k, 78.0f, -3.3f, 77.95f, 0, k == 1, 0, 0, 0};
+  airQuality = {8123 + k, 8000, 412, 43 + k * 100, k ? "Mauvais" : "Bon", true, 0};
+  sensorChannels[0].value = 214 + k;
+  sensorChannels[0].valid = true;
+  sensorChannels[1].value = 452;
+  sensorChannels[1].valid = k != 2;
+  sensorChannels[2].value = -33 * k;
+  sensorChannels[2].valid = k == 1;
+  sensorChannels[4].value = 43 + k;
+  sensorChannels[4].valid = true;
+  sensorChannels[5].value = 230;
+  sensorChannels[5].valid = true;
+
+  for (uint8_t i = 0; i < getSensorCount(); i++) {
+    SensorHealth& h = const_cast<SensorSlot*>(getSensorSlot(i))->health;
+    h.started = true;
+    h.valid = i != (uint8_t)k;
+    h.lastGood = i == 3 ? 0 : fakeMillis - 4000 * i;
+    h.successes = 1000 * i + k;
+    h.nanErrors = i;
+    h.checksumErrors = k;
+    h.rangeErrors = 2;
+    h.consecutiveFailures = 0;
+    h.maxConsecutiveFailures = 5;
+    h.lastDurationUs = 4200 + i;
+    h.maxDurationUs = 25000;
+    for (int b = 0; b < SENSOR_HIST_BUCKETS; b++) h.durationHist[b] = b * i + k;
+  }
+
+  moon.phase = 3 + k;
+  moon.exactPhase = 3.4567f + k;
+  moon.illumination = 62.35f;
+  moon.lunarAge = 10.125f;
+  moon.currentSteps = 700 + k;
+  moon.isCalibrated = k != 2;
+  moon.lastCalib = k == 0 ? 0 : clockTime - 3 * 86400 - 5000;
+  logStatsStub.bufferCount = 12 + k;
+  logStatsStub.mqttConnected = k != 1;
+}
+
+/**
+ * @brief A day of readings every 5 min, one channel left without data
+ */
+static void feedRollups() {
+  initRollups();
+  uint32_t start = clockTime - 86400;
+  for (uint32_t t = start; t < clockTime; t += 300) {
+    uint32_t i = (t - start) / 300;
+    sensorChannels[0].value = 180 + (int16_t)(i * 7 % 60);
+    sensorChannels[1].value = 400 + (int16_t)(i * 13 % 200);
+    sensorChannels[2].value = -50 + (int16_t)(i * 11 % 150);
+    sensorChannels[4].value = 20 + (int16_t)(i * 17 % 300);
+    sensorChannels[5].value = 230;
+    for (uint8_t ch = 0; ch < SENSOR_CHANNEL_COUNT; ch++) {
+      sensorChannels[ch].valid = ch != 3;
+      sensorChannels[ch].lastUpdate = t;
+    }
+    updateRollups(t);
+  }
+}
+
+int main() {
+  initWebServer();
+  clientPending = true;
+
+  static const char* const routes[] = {"/api/status", "/api/config", "/api/logstats",
+    "/api/moon?action=status", "/api/snapshot"};
+  for (int k = 0; k < 3; k++) {
+    setState(k);
+    for (const char* path : routes) show(path);
+  }
+
+  feedRollups();
+  static const char* const rollups[] = {"/api/rollup", "/api/rollup?tier=1h&ch=hOut",
+    "/api/rollup?tier=15m&ch=aqi", "/api/rollup?tier=1h&ch=hIn", "/api/rollup?tier=1d"};
+  for (const char* path : rollups) show(path);
+  testRevalidation();
+  showRaw("/api/rollup HTTP/1.0 keep-alive (body over WEB_BODY_SIZE)",
+          "GET /api/rollup HTTP/1.0\r\nConnection: keep-alive\r\n\r\n");
+  showRaw("/api/logstats HTTP/1.0 keep-alive (Content-Length)",
+          "GET /api/logstats HTTP/1.0\r\nConnection: keep-alive\r\n\r\n");
+
+  show("/api/webstats");
+  return 0;
+}
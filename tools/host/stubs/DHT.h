@@ -0,0 +1,11 @@
+#pragma once
+#include <Arduino.h>
+#define DHT22 22
+
+class DHT {
+public:
+  DHT(uint8_t, uint8_t, uint8_t = 6) {}
+  void begin(uint8_t = 55) {}
+  float readTemperature(bool = false, bool = false) { return NAN; }
+  float readHumidity(bool = false) { return NAN; }
+};
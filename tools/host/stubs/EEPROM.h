@@ -0,0 +1,16 @@
+#pragma once
+#include <Arduino.h>
+
+/** 8 KB data flash kept in RAM */
+class EEPROMClass {
+public:
+  uint8_t read(int address) { return bytes[address]; }
+  void write(int address, uint8_t value) { bytes[address] = value; }
+  void update(int address, uint8_t value) { bytes[address] = value; }
+  template <typename T> T& get(int address, T& t) { memcpy(&t, bytes + address, sizeof(T)); return t; }
+  template <typename T> const T& put(int address, const T& t) { memcpy(bytes + address, &t, sizeof(T)); return t; }
+  uint16_t length() { return sizeof(bytes); }
+private:
+  uint8_t bytes[8192] = {};
+};
+extern EEPROMClass EEPROM;
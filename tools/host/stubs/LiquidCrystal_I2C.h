@@ -0,0 +1,3 @@
+#pragma once
+#include <Arduino.h>
+class LiquidCrystal_I2C {};
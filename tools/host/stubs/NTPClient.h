@@ -0,0 +1,3 @@
+#pragma once
+#include <WiFiUdp.h>
+class NTPClient {};
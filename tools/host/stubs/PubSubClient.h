@@ -0,0 +1,25 @@
+#pragma once
+#include <Arduino.h>
+#include <WiFiS3.h>
+
+/** Defined by the harness: publishes are captured, not sent */
+class PubSubClient : public Print {
+public:
+  void setClient(Client& client);
+  void setServer(const char* domain, uint16_t port);
+  bool setBufferSize(uint16_t size);
+  void setSocketTimeout(uint16_t timeout);
+  void setKeepAlive(uint16_t keepAlive);
+  bool connect(const char* id, const char* user, const char* pass);
+  bool connected();
+  int state();
+  bool loop();
+  bool publish(const char* topic, const char* payload);
+  bool publish(const char* topic, const char* payload, bool retained);
+  bool publish(const char* topic, const uint8_t* payload, unsigned int length);
+  bool beginPublish(const char* topic, unsigned int length, bool retained);
+  int endPublish();
+  size_t write(uint8_t b) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  using Print::write;
+};
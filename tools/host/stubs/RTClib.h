@@ -0,0 +1,35 @@
+#pragma once
+#include <Arduino.h>
+
+/** Unix time only (UTC), no time zone */
+class DateTime {
+public:
+  DateTime(uint32_t t = 0) : t(t) {}
+  uint16_t year() const { return civil(0); }
+  uint8_t month() const { return civil(1); }
+  uint8_t day() const { return civil(2); }
+  uint8_t hour() const { return (t / 3600) % 24; }
+  uint8_t minute() const { return (t / 60) % 60; }
+  uint8_t second() const { return t % 60; }
+  uint32_t unixtime() const { return t; }
+private:
+  uint32_t t;
+
+  /** Days since 1970 to year, month or day (H. Hinnant's civil_from_days) */
+  uint16_t civil(int part) const {
+    long z = t / 86400 + 719468;
+    long era = z / 146097;
+    long doe = z - era * 146097;
+    long yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    long doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    long mp = (5 * doy + 2) / 153;
+    long d = doy - (153 * mp + 2) / 5 + 1;
+    long m = mp < 10 ? mp + 3 : mp - 9;
+    return part == 0 ? yoe + era * 400 + (m <= 2) : part == 1 ? m : d;
+  }
+};
+
+class RTC_DS3231 {
+public:
+  float getTemperature() { return 23.0f; }
+};
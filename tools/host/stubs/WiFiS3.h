@@ -0,0 +1,40 @@
+#pragma once
+#include <Arduino.h>
+#define WL_CONNECTED 3
+
+/** Defined by the harness: one fake client at a time */
+class WiFiClient : public Client {
+public:
+  WiFiClient();
+  int connect(IPAddress ip, uint16_t port) override;
+  int connect(const char* host, uint16_t port) override;
+  uint8_t connected() override;
+  void stop() override;
+  operator bool() override;
+  int read(uint8_t* buffer, size_t size) override;
+  int read() override;
+  int available() override;
+  int peek() override;
+  size_t write(uint8_t b) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  using Print::write;
+  bool operator==(const WiFiClient& other) const;
+  bool operator!=(const WiFiClient& other) const { return !(*this == other); }
+  IPAddress remoteIP() { return IPAddress(); }
+};
+
+class WiFiServer {
+public:
+  WiFiServer(int port);
+  void begin();
+  WiFiClient accept();
+  WiFiClient available() { return accept(); }
+};
+
+class WiFiClass {
+public:
+  int status() { return WL_CONNECTED; }
+  IPAddress localIP() { return IPAddress(); }
+  long RSSI() { return -60; }
+};
+extern WiFiClass WiFi;
@@ -0,0 +1,9 @@
+#pragma once
+#include "secrets.h.template"
+
+/** MQTT settings of secrets.cpp, defined by the harness that needs them */
+extern const char* mqttServer;
+extern const char* mqttPort;
+extern const char* mqttClientId;
+extern const char* mqttUsername;
+extern const char* mqttPassword;
@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+"""
+Estimate the capacity of the compressed data log ring
+(firmware/smart-led-clock/tsring.h) and check the encoding round-trips.
+
+The block format of tsring.cpp is reproduced byte for byte: a keyframe
+header per block (timestamp, raw values, used, count) followed by records
+of varint(zigzag(delta-of-delta ts) << 1 | maskChanged), an optional
+varint(mask) and varint(zigzag(value delta)) per valid channel.
+
+A synthetic 5-minute series (daily temperature/humidity cycles, filtered
+sensor noise, RTC clock jitter, occasional outdoor sensor dropouts) is
+encoded until the ring wraps. The script prints bytes per point, points
+held in TSRING_BYTES and the outage coverage; it exits non-zero if a
+decoded point differs from the input.
+
+Usage: python3 tools/tsring_capacity.py [days]
+"""
+import math
+import random
+import struct
+import sys
+
+TSRING_BYTES = 8192
+BLOCK_SIZE = 256
+CHANNELS = 6                   # tIn, hIn, tOut, hOut, aqi, tRtc
+INVALID = -32768               # SENSOR_VALUE_INVALID
+INTERVAL = 300                 # DATALOG_INTERVAL_WIFI_DOWN (s)
+HEADER = struct.Struct("<I%dhHH" % CHANNELS)   # TsBlockHeader (packed the same way)
+RAW_POINT = 4 + 2 * CHANNELS   # decoded DataPoint
+
+
+def zigzag(v):
+    return ((v << 1) ^ (v >> 31)) & 0xFFFFFFFF
+
+
+def unzigzag(u):
+    return (u >> 1) ^ -(u & 1)
+
+
+def varint(v):
+    out = bytearray()
+    while v >= 0x80:
+        out.append((v & 0x7F) | 0x80)
+        v >>= 7
+    out.append(v)
+    return out
+
+
+def read_varint(buf, pos):
+    v = shift = 0
+    while True:
+        b = buf[pos]
+        pos += 1
+        v |= (b & 0x7F) << shift
+        shift += 7
+        if not b & 0x80:
+            return v, pos
+
+
+def mask_of(values):
+    return sum(1 << ch for ch, v in enumerate(values) if v != INVALID)
+
+
+def keyframe_state(ts, values):
+    return [ts, 0, [v if v != INVALID else 0 for v in values], mask_of(values)]
+
+
+def encode_record(state, ts, values):
+    delta = ts - state[0]
+    dod = delta - state[1]
+    mask = mask_of(values)
+    out = varint((zigzag(dod) << 1) | (mask != state[3]))
+    if mask != state[3]:
+        out += varint(mask)
+    for ch in range(CHANNELS):
+        if mask >> ch & 1:
+            out += varint(zigzag(values[ch] - state[2][ch]))
+            state[2][ch] = values[ch]
+    state[0], state[1], state[3] = ts, delta, mask
+    return out
+
+
+def decode_block(block):
+    ts, *rest = HEADER.unpack_from(block)
+    values, used, count = list(rest[:CHANNELS]), rest[CHANNELS], rest[CHANNELS + 1]
+    points = [(ts, values[:])]
+    state = keyframe_state(ts, values)
+    pos = HEADER.size
+    for _ in range(count - 1):
+        tag, pos = read_varint(block, pos)
+        state[1] += unzigzag(tag >> 1)
+        state[0] += state[1]
+        if tag & 1:
+            state[3], pos = read_varint(block, pos)
+        point = []
+        for ch in range(CHANNELS):
+            if state[3] >> ch & 1:
+                d, pos = read_varint(block, pos)
+                state[2][ch] += unzigzag(d)
+                point.append(state[2][ch])
+            else:
+                point.append(INVALID)
+        points.append((state[0], point))
+    assert pos == used, "block length mismatch"
+    return points
+
+
+def synthetic_series(days, seed=1):
+    rnd = random.Random(seed)
+    ts = 1760000000
+    aqi = 40.0
+    outage = 0
+    for _ in range(days * 86400 // INTERVAL):
+        ts += INTERVAL + (rnd.random() < 0.02) * rnd.choice((-1, 1))
+        day = 2 * math.pi * (ts % 86400) / 86400
+        aqi = min(300, max(0, aqi + rnd.gauss(0, 1.5)))
+        outage = outage - 1 if outage else (rnd.random() < 0.005) * rnd.randint(1, 6)
+        values = [
+            round(215 + 15 * math.sin(day) + rnd.gauss(0, 0.7)),
+            round(450 + 40 * math.cos(day) + rnd.gauss(0, 2)),
+            round(100 + 60 * math.sin(day - 1) + rnd.gauss(0, 1)),
+            round(750 - 120 * math.sin(day - 1) + rnd.gauss(0, 3)),
+            round(aqi),
+            round(240 + 12 * math.sin(day) + rnd.gauss(0, 0.5)),
+        ]
+        if outage:
+            values[2] = values[3] = INVALID
+        yield ts, values
+
+
+def main():
+    days = int(sys.argv[1]) if len(sys.argv) > 1 else 10
+    blocks = []                # list of [bytearray, count]
+    state = None
+    total = 0
+    expected = []
+
+    for ts, values in synthetic_series(days):
+        total += 1
+        expected.append((ts, values))
+        if blocks:
+            trial = [state[0], state[1], state[2][:], state[3]]
+            rec = encode_record(trial, ts, values)
+            if len(blocks[-1][0]) + len(rec) <= BLOCK_SIZE:
+                blocks[-1][0] += rec
+                blocks[-1][1] += 1
+                state = trial
+                continue
+        if len(blocks) == TSRING_BYTES // BLOCK_SIZE:
+            blocks.pop(0)
+        blocks.append([bytearray(HEADER.pack(ts, *values, 0, 0)), 1])
+        state = keyframe_state(ts, values)
+
+    held = sum(count for _, count in blocks)
+    used = sum(len(block) for block, _ in blocks)
+
+    decoded = []
+    for block, count in blocks:
+        buf = bytearray(block)
+        buf[HEADER.size - 4:HEADER.size] = struct.pack("<HH", len(block), count)
+        decoded += decode_block(buf)
+    ok = decoded == expected[-held:]
+
+    print(f"Points encoded: {total}, held in ring: {held} ({TSRING_BYTES} bytes, {used} used)")
+    print(f"Bytes per point: {used / held:.2f} (raw DataPoint: {RAW_POINT})")
+    print(f"Compression: {RAW_POINT * held / used:.2f}x")
+    print(f"Outage coverage at {INTERVAL // 60} min: {held * INTERVAL / 86400:.1f} days "
+          f"(raw array in the same bytes: {TSRING_BYTES // RAW_POINT * INTERVAL / 86400:.1f} days)")
+    if not ok:
+        print("FAIL: decoded points differ from input", file=sys.stderr)
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())